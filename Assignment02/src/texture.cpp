@@ -3,11 +3,65 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
 
 #include "GL/glew.h"
 
 //#include <GLFW/glfw3.h>
 
+// sRGB encoding <-> linear light
+static float srgbToLinear(float c){
+	return c <= 0.04045f ? c / 12.92f : powf((c + 0.055f) / 1.055f, 2.4f);
+}
+static float linearToSrgb(float c){
+	return c <= 0.0031308f ? c * 12.92f : 1.055f * powf(c, 1.0f / 2.4f) - 0.055f;
+}
+
+// Uploads a 24bpp image (rows padded to 4 bytes, as in a BMP file) with its mip levels built here instead of
+// by glGenerateMipmap, which would average the gamma-encoded bytes and darken every smaller level. Each level
+// is the 2x2 box average of the one above it, in linear light.
+static void uploadMipChain(const unsigned char * data, unsigned int width, unsigned int height){
+
+	glTexImage2D(GL_TEXTURE_2D, 0,GL_RGB, width, height, 0, GL_BGR, GL_UNSIGNED_BYTE, data);
+
+	// the current level in linear light, 3 floats per texel
+	float * level = new float [width*height*3];
+	unsigned int pitch = (width*3 + 3) & ~3u;
+	for (unsigned int y=0; y<height; y++)
+		for (unsigned int x=0; x<width*3; x++)
+			level[y*width*3 + x] = srgbToLinear(data[y*pitch + x] / 255.0f);
+
+	int mip = 1;
+	while (width > 1 || height > 1){
+		unsigned int w = width > 1 ? width/2 : 1;
+		unsigned int h = height > 1 ? height/2 : 1;
+		pitch = (w*3 + 3) & ~3u;
+		float * smaller = new float [w*h*3];
+		unsigned char * encoded = new unsigned char [pitch*h];
+		for (unsigned int y=0; y<h; y++){
+			// of an odd size, the last row and column are left out
+			unsigned int y0 = y*height/h, y1 = height > 1 ? y0+1 : y0;
+			for (unsigned int x=0; x<w; x++){
+				unsigned int x0 = x*width/w, x1 = width > 1 ? x0+1 : x0;
+				for (int c=0; c<3; c++){
+					float sum = level[(y0*width + x0)*3 + c] + level[(y0*width + x1)*3 + c]
+					          + level[(y1*width + x0)*3 + c] + level[(y1*width + x1)*3 + c];
+					smaller[(y*w + x)*3 + c] = sum * 0.25f;
+					encoded[y*pitch + x*3 + c] = (unsigned char)(linearToSrgb(sum * 0.25f) * 255.0f + 0.5f);
+				}
+			}
+		}
+		glTexImage2D(GL_TEXTURE_2D, mip, GL_RGB, w, h, 0, GL_BGR, GL_UNSIGNED_BYTE, encoded);
+		delete [] encoded;
+		delete [] level;
+		level = smaller;
+		width = w;
+		height = h;
+		mip++;
+	}
+	delete [] level;
+}
+
 
 GLuint loadBMP_custom(const char * imagepath){
 
@@ -73,8 +127,8 @@ GLuint loadBMP_custom(const char * imagepath){
 	// "Bind" the newly created texture : all future texture functions will modify this texture
 	glBindTexture(GL_TEXTURE_2D, textureID);
 
-	// Give the image to OpenGL
-	glTexImage2D(GL_TEXTURE_2D, 0,GL_RGB, width, height, 0, GL_BGR, GL_UNSIGNED_BYTE, data);
+	// Give the image to OpenGL, with its mip levels
+	uploadMipChain(data, width, height);
 
 	// OpenGL has now copied the data. Free our own version
 	delete [] data;
@@ -88,8 +142,7 @@ GLuint loadBMP_custom(const char * imagepath){
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-	// ... which requires mipmaps. Generate them automatically.
-	glGenerateMipmap(GL_TEXTURE_2D);
+	// ... which requires mipmaps, uploaded along with the image above.
 
 	printf("%d x %d image read.", width, height);
 
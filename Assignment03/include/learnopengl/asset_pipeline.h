@@ -0,0 +1,206 @@
+#ifndef ASSET_PIPELINE_H
+#define ASSET_PIPELINE_H
+
+#include "GL/glew.h"
+
+#include <learnopengl/parallel.h>
+#include <learnopengl/texture_cache.h>
+#include <learnopengl/texture_streamer.h>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// startup loading split in two: the CPU side of every asset (file reads, image decodes, model import) runs on
+// worker threads, and its GL side (uploads, shader compiles) runs on the GL thread as soon as that input is
+// ready, in poll() or finish(). Everything is queued up front, so startup takes about as long as the slowest
+// asset instead of the sum of all of them. Texture pixels don't wait for finish(): they stream in over the
+// next frames, as the frame loop keeps calling poll().
+class AssetPipeline
+{
+public:
+    explicit AssetPipeline(unsigned int threads = workerCount())
+    {
+        for (unsigned int t = 0; t < threads; ++t)
+            workers.push_back(std::thread([this]() { work(); }));
+    }
+
+    // jobs that haven't started yet are dropped; their futures report a broken promise
+    ~AssetPipeline()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        jobAvailable.notify_all();
+        for (unsigned int t = 0; t < workers.size(); ++t)
+            workers[t].join();
+    }
+
+    AssetPipeline(const AssetPipeline &) = delete;
+    AssetPipeline &operator=(const AssetPipeline &) = delete;
+
+    // runs load() on a worker and then upload(result) on the GL thread. If load() throws, upload() is skipped
+    // and the exception is rethrown on the GL thread by the poll() or finish() that would have run it.
+    template <typename Load, typename Upload>
+    void add(Load load, Upload upload)
+    {
+        typedef typename std::decay<decltype(load())>::type Result;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++pending;
+        }
+        push([this, load, upload]()
+        {
+            std::function<void()> step;
+            try
+            {
+                std::shared_ptr<Result> result = std::make_shared<Result>(load());
+                step = [result, upload]() { upload(*result); };
+            }
+            catch (...)
+            {
+                std::exception_ptr error = std::current_exception();
+                step = [error]() { std::rethrow_exception(error); };
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                steps.push_back(step);
+            }
+            stepReady.notify_one();
+        });
+    }
+
+    // runs load() on a worker without a GL step; the result is picked up through the future whenever it's
+    // needed (finish() doesn't wait for it).
+    template <typename Load>
+    std::shared_future<typename std::decay<decltype(std::declval<Load>()())>::type> async(Load load)
+    {
+        typedef typename std::decay<decltype(load())>::type Result;
+        std::shared_ptr<std::packaged_task<Result()> > task = std::make_shared<std::packaged_task<Result()> >(load);
+        std::shared_future<Result> result = task->get_future().share();
+        push([task]() { (*task)(); });
+        return result;
+    }
+
+    // decodes an image file on a worker (unless the texture cache has it already); textureID is set once it has
+    // been decoded, and the pixels stream in from there. The pipeline holds the texture until releaseTextures()
+    // or its end.
+    void addTexture(const std::string &path, unsigned int &textureID, const TextureParams &params = TextureParams())
+    {
+        add([path, params]() { return textureCache().acquire(path, params); }, [this, &textureID](const TextureHandle &texture)
+        {
+            textureID = textureStreamer().upload(texture);
+            textures.push_back(texture);
+        });
+    }
+
+    // GL thread: the streamer of addTexture(), for other loaders (Model::Upload) to stream their textures through
+    TextureStreamer &textureStreamer()
+    {
+        if (!streamer)
+            streamer.reset(new TextureStreamer());
+        return *streamer;
+    }
+
+    // GL thread: lets go of the addTexture() textures, deleting those nothing else uses, and of the streamer
+    void releaseTextures()
+    {
+        streamer.reset();
+        textures.clear();
+    }
+
+    // GL thread: runs the GL step of every job that has finished so far, then streams one frame's budget of
+    // texture pixels. Returns true once no job is pending (textures may still be streaming). A failed job
+    // throws from here; the steps after it run in the next poll().
+    bool poll()
+    {
+        std::deque<std::function<void()> > ready;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ready.swap(steps);
+        }
+        while (!ready.empty())
+        {
+            std::function<void()> step = ready.front();
+            ready.pop_front();
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                --pending;
+            }
+            try
+            {
+                step();
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                steps.insert(steps.begin(), ready.begin(), ready.end());
+                throw;
+            }
+        }
+        if (streamer)
+            streamer->update();
+        std::lock_guard<std::mutex> lock(mutex);
+        return pending == 0;
+    }
+
+    // GL thread: waits for every add()ed job, running GL steps in the order their inputs become ready. Throws
+    // what a failed job threw.
+    void finish()
+    {
+        while (!poll())
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            stepReady.wait(lock, [this]() { return !steps.empty(); });
+        }
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable jobAvailable, stepReady;
+    std::deque<std::function<void()> > jobs;   // CPU side, picked up by the workers
+    std::deque<std::function<void()> > steps;  // GL side of finished jobs, run by poll()
+    std::vector<std::thread> workers;
+    std::vector<TextureHandle> textures;       // of addTexture(), only touched on the GL thread
+    std::unique_ptr<TextureStreamer> streamer; // made on the GL thread when first needed
+    size_t pending = 0;                        // add()ed jobs whose GL step hasn't run yet
+    bool stopping = false;
+
+    void push(const std::function<void()> &job)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            jobs.push_back(job);
+        }
+        jobAvailable.notify_one();
+    }
+
+    void work()
+    {
+        onWorkerThread() = true;
+        for (;;)
+        {
+            std::function<void()> job;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                jobAvailable.wait(lock, [this]() { return stopping || !jobs.empty(); });
+                if (stopping)
+                    return;
+                job = jobs.front();
+                jobs.pop_front();
+            }
+            job();
+        }
+    }
+};
+#endif
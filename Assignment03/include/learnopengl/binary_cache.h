@@ -0,0 +1,137 @@
+#ifndef BINARY_CACHE_H
+#define BINARY_CACHE_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <fstream>
+
+// 64-bit FNV-1a hash, used to build cache keys from file contents and settings.
+class Fnv1a64
+{
+public:
+    uint64_t value;
+
+    Fnv1a64() : value(14695981039346656037ull) {}
+
+    // hashes a raw block of bytes into the running value
+    void update(const void *data, size_t size)
+    {
+        const unsigned char *bytes = (const unsigned char *)data;
+        for (size_t i = 0; i < size; ++i)
+        {
+            value ^= bytes[i];
+            value *= 1099511628211ull;
+        }
+    }
+    // hashes a plain value (integers, floats, enums)
+    template <typename T>
+    void updateValue(const T &v)
+    {
+        update(&v, sizeof(T));
+    }
+    void updateString(const std::string &s)
+    {
+        updateValue((uint64_t)s.size());
+        update(s.data(), s.size());
+    }
+    // hashes the full contents of a file; returns false if the file couldn't be read.
+    bool updateFile(const std::string &path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            return false;
+        char buffer[64 * 1024];
+        while (file)
+        {
+            file.read(buffer, sizeof(buffer));
+            update(buffer, (size_t)file.gcount());
+        }
+        return true;
+    }
+};
+
+// Sequential writer for versioned binary cache files.
+class BinaryWriter
+{
+public:
+    BinaryWriter(const std::string &path) : file(path, std::ios::binary | std::ios::trunc) {}
+
+    bool good() const { return file.good(); }
+
+    void write(const void *data, size_t size)
+    {
+        file.write((const char *)data, size);
+    }
+    template <typename T>
+    void writeValue(const T &v)
+    {
+        write(&v, sizeof(T));
+    }
+    void writeString(const std::string &s)
+    {
+        writeValue((uint32_t)s.size());
+        write(s.data(), s.size());
+    }
+
+private:
+    std::ofstream file;
+};
+
+// Sequential reader matching BinaryWriter. Once a read fails every following read fails as well,
+// so callers only need to check good() after reading a whole block.
+class BinaryReader
+{
+public:
+    BinaryReader(const std::string &path) : file(path, std::ios::binary) {}
+
+    bool good() const { return file.good(); }
+
+    bool read(void *data, size_t size)
+    {
+        file.read((char *)data, size);
+        return file.good();
+    }
+    template <typename T>
+    bool readValue(T &v)
+    {
+        return read(&v, sizeof(T));
+    }
+    bool readString(std::string &s)
+    {
+        uint32_t size = 0;
+        if (!readValue(size))
+            return false;
+        s.resize(size);
+        return size == 0 || read(&s[0], size);
+    }
+
+private:
+    std::ifstream file;
+};
+
+// every cache file starts with this header; files with a different magic, version or key are ignored.
+struct BinaryCacheHeader {
+    char     magic[4];
+    uint32_t version;
+    uint64_t key;
+};
+
+inline void writeCacheHeader(BinaryWriter &writer, const char magic[4], uint32_t version, uint64_t key)
+{
+    BinaryCacheHeader header;
+    memcpy(header.magic, magic, 4);
+    header.version = version;
+    header.key = key;
+    writer.writeValue(header);
+}
+
+inline bool readCacheHeader(BinaryReader &reader, const char magic[4], uint32_t version, uint64_t key)
+{
+    BinaryCacheHeader header;
+    if (!reader.readValue(header))
+        return false;
+    return memcmp(header.magic, magic, 4) == 0 && header.version == version && header.key == key;
+}
+#endif
@@ -0,0 +1,280 @@
+#ifndef GEOMETRY_ARENA_H
+#define GEOMETRY_ARENA_H
+
+#include "GL/glew.h"
+
+#include <learnopengl/index_buffer.h>
+#include <learnopengl/vertex_format.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+// the meshes of a model (or of several, sharing one arena) suballocated from one vertex buffer and one 16-bit
+// index buffer behind a single VAO. Each frame the draws are collected into a command buffer and submitted
+// with one glMultiDrawElementsIndirect per material batch (GL 4.3); with a 3.3 context the same commands go
+// out as glDrawElementsBaseVertex calls, still without rebinding anything in between.
+//
+// what differs per draw (the bounds of quantized positions) comes from an instanced attribute the command
+// selects through its baseInstance: locations 5 and 6 of 2.2.2.pbr.vs.
+
+// the layout glMultiDrawElementsIndirect reads
+struct DrawElementsIndirectCommand {
+    GLuint count;
+    GLuint instanceCount;
+    GLuint firstIndex;
+    GLint  baseVertex;
+    GLuint baseInstance;
+};
+
+// per-draw attributes, locations 5 (offset) and 6 (scale)
+struct ArenaDrawBounds {
+    glm::vec3 offset;
+    glm::vec3 scale;
+};
+
+// where a mesh lives in the arena: per LOD (0 the full mesh) one command per 16-bit index chunk
+struct ArenaMesh {
+    GLint baseVertex = 0;
+    std::vector<std::vector<DrawElementsIndirectCommand>> lods;
+    VertexBounds bounds;
+};
+
+template <typename V>
+class GeometryArena
+{
+public:
+    // whether the indirect path is there; otherwise draw() falls back to a loop of base vertex draws. The
+    // commands select their bounds by baseInstance, which needs GL 4.2 / ARB_base_instance as well.
+    static bool indirectSupported()
+    {
+        return (GLEW_VERSION_4_3 || GLEW_ARB_multi_draw_indirect) && (GLEW_VERSION_4_2 || GLEW_ARB_base_instance);
+    }
+
+    // only 8 and 16-bit (possibly chunked) indices fit; 32-bit meshes keep their own buffers
+    static bool fits(const PackedIndices &indices)
+    {
+        return indices.type != GL_UNSIGNED_INT;
+    }
+
+    ~GeometryArena()
+    {
+        if (VAO)
+        {
+            glDeleteVertexArrays(1, &VAO);
+            unsigned int buffers[4] = { VBO, EBO, drawBuffer, indirectBuffer };
+            glDeleteBuffers(4, buffers);
+        }
+    }
+
+    // makes room for that much more geometry up front, so adding it doesn't grow the buffers repeatedly
+    void reserve(size_t vertices, size_t indices)
+    {
+        create();
+        grow(VBO, GL_ARRAY_BUFFER, vertexCapacity, vertexCount + vertices, sizeof(V));
+        grow(EBO, GL_ELEMENT_ARRAY_BUFFER, indexCapacity, indexCount + indices, sizeof(uint16_t));
+    }
+
+    // copies a mesh in (GL thread only); the indices are widened to 16-bit where they're 8-bit
+    ArenaMesh add(const V *vertices, unsigned int count, const PackedIndices &indices, const VertexBounds &bounds)
+    {
+        reserve(count, indices.count());
+        ArenaMesh mesh;
+        mesh.bounds = bounds;
+        mesh.baseVertex = (GLint)vertexCount;
+
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glBufferSubData(GL_ARRAY_BUFFER, vertexCount * sizeof(V), count * sizeof(V), vertices);
+        vertexCount += count;
+        addLod(mesh, indices);
+        return mesh;
+    }
+
+    // copies another index list over the vertices of mesh in, as its next LOD
+    void addLod(ArenaMesh &mesh, const PackedIndices &indices)
+    {
+        reserve(0, indices.count());
+        std::vector<uint16_t> wide;
+        const uint16_t *narrow = (const uint16_t *)indices.data();
+        if (indices.type == GL_UNSIGNED_BYTE)
+        {
+            wide.assign(indices.data(), indices.data() + indices.size());
+            narrow = wide.data();
+        }
+        glBindBuffer(GL_COPY_WRITE_BUFFER, EBO); // not GL_ELEMENT_ARRAY_BUFFER, which is a bound VAO's state
+        glBufferSubData(GL_COPY_WRITE_BUFFER, indexCount * sizeof(uint16_t), indices.count() * sizeof(uint16_t), narrow);
+        std::vector<DrawElementsIndirectCommand> commands;
+        for (size_t c = 0; c < indices.chunks.size(); ++c)
+        {
+            const IndexChunk &chunk = indices.chunks[c];
+            DrawElementsIndirectCommand command = { chunk.count, 1, (GLuint)(indexCount + chunk.first), mesh.baseVertex + chunk.baseVertex, 0 };
+            commands.push_back(command);
+        }
+        mesh.lods.push_back(commands);
+        indexCount += indices.count();
+    }
+
+    // per frame: beginFrame(), addDraw() for everything to draw (batch by batch), upload(), then draw() each
+    // batch's range of commands
+    void beginFrame()
+    {
+        commands.clear();
+        draws.clear();
+    }
+
+    unsigned int commandCount() const { return (unsigned int)commands.size(); }
+
+    // draws indices [first, first + count) of a LOD's list only: a part per chunk it spans
+    void addDraw(const ArenaMesh &mesh, unsigned int lod, unsigned int first, unsigned int count)
+    {
+        ArenaDrawBounds bounds = { mesh.bounds.offset, mesh.bounds.scale };
+        const std::vector<DrawElementsIndirectCommand> &lodCommands = mesh.lods[std::min(lod, (unsigned int)mesh.lods.size() - 1)];
+        if (lodCommands.empty())
+            return;
+        // the chunks are back to back from the first
+        GLuint start = lodCommands[0].firstIndex + first, end = start + count;
+        for (size_t c = 0; c < lodCommands.size(); ++c)
+        {
+            GLuint begin = std::max(start, lodCommands[c].firstIndex);
+            GLuint stop = std::min(end, lodCommands[c].firstIndex + lodCommands[c].count);
+            if (begin >= stop)
+                continue;
+            DrawElementsIndirectCommand command = lodCommands[c];
+            command.firstIndex = begin;
+            command.count = stop - begin;
+            command.baseInstance = (GLuint)draws.size();
+            commands.push_back(command);
+            draws.push_back(bounds);
+        }
+    }
+
+    void addDraw(const ArenaMesh &mesh, unsigned int lod = 0)
+    {
+        ArenaDrawBounds bounds = { mesh.bounds.offset, mesh.bounds.scale };
+        const std::vector<DrawElementsIndirectCommand> &lodCommands = mesh.lods[std::min(lod, (unsigned int)mesh.lods.size() - 1)];
+        for (size_t c = 0; c < lodCommands.size(); ++c)
+        {
+            commands.push_back(lodCommands[c]);
+            commands.back().baseInstance = (GLuint)draws.size();
+            draws.push_back(bounds);
+        }
+    }
+
+    // the frame's commands and bounds to the GPU; the fallback draws from the CPU copies and skips it
+    void upload()
+    {
+        if (commands.empty() || !indirect)
+            return;
+        // orphaned every frame, so the driver doesn't wait for last frame's draws
+        glBindBuffer(GL_ARRAY_BUFFER, drawBuffer);
+        glBufferData(GL_ARRAY_BUFFER, draws.size() * sizeof(ArenaDrawBounds), draws.data(), GL_STREAM_DRAW);
+        if (indirect)
+        {
+            glBindBuffer(GL_DRAW_INDIRECT_BUFFER, indirectBuffer);
+            glBufferData(GL_DRAW_INDIRECT_BUFFER, commands.size() * sizeof(DrawElementsIndirectCommand), commands.data(), GL_STREAM_DRAW);
+        }
+    }
+
+    void bind()
+    {
+        glBindVertexArray(VAO);
+        if (indirect)
+            glBindBuffer(GL_DRAW_INDIRECT_BUFFER, indirectBuffer);
+    }
+
+    // draws commands [first, first + count) of this frame; the arena has to be bound
+    void draw(unsigned int first, unsigned int count)
+    {
+        if (count == 0)
+            return;
+        if (indirect)
+        {
+            glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_SHORT, (void*)(first * sizeof(DrawElementsIndirectCommand)), count, 0);
+            return;
+        }
+        // no baseInstance before GL 4.2: the per-draw attributes are set as current values instead
+        for (unsigned int i = first; i < first + count; ++i)
+        {
+            const DrawElementsIndirectCommand &command = commands[i];
+            glVertexAttrib3fv(5, &draws[command.baseInstance].offset.x);
+            glVertexAttrib3fv(6, &draws[command.baseInstance].scale.x);
+            glDrawElementsBaseVertex(GL_TRIANGLES, command.count, GL_UNSIGNED_SHORT, (void*)(command.firstIndex * sizeof(uint16_t)),
+                                     command.baseVertex);
+        }
+    }
+
+    size_t vertexBytes() const { return vertexCount * sizeof(V); }
+    size_t indexBytes() const { return indexCount * sizeof(uint16_t); }
+
+private:
+    unsigned int VAO = 0, VBO = 0, EBO = 0, drawBuffer = 0, indirectBuffer = 0;
+    size_t vertexCount = 0, vertexCapacity = 0;
+    size_t indexCount = 0, indexCapacity = 0;
+    bool indirect = false;
+    std::vector<DrawElementsIndirectCommand> commands;
+    std::vector<ArenaDrawBounds> draws;
+
+    void create()
+    {
+        if (VAO)
+            return;
+        indirect = indirectSupported();
+        glGenVertexArrays(1, &VAO);
+        glGenBuffers(1, &VBO);
+        glGenBuffers(1, &EBO);
+        if (indirect)
+        {
+            glGenBuffers(1, &drawBuffer);
+            glGenBuffers(1, &indirectBuffer);
+        }
+        glBindVertexArray(VAO);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+        setupAttributes();
+        glBindVertexArray(0);
+    }
+
+    // (re)points the VAO's attributes at the current buffers
+    void setupAttributes()
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        VertexFormat<V>::Attribs::enable(sizeof(V));
+        if (indirect)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, drawBuffer);
+            glEnableVertexAttribArray(5);
+            glVertexAttribPointer(5, 3, GL_FLOAT, GL_FALSE, sizeof(ArenaDrawBounds), (void*)offsetof(ArenaDrawBounds, offset));
+            glVertexAttribDivisor(5, 1);
+            glEnableVertexAttribArray(6);
+            glVertexAttribPointer(6, 3, GL_FLOAT, GL_FALSE, sizeof(ArenaDrawBounds), (void*)offsetof(ArenaDrawBounds, scale));
+            glVertexAttribDivisor(6, 1);
+        }
+    }
+
+    // grows a buffer to at least `needed` elements, keeping its contents (GL 3.1 buffer copies)
+    void grow(unsigned int &buffer, GLenum target, size_t &capacity, size_t needed, size_t elementSize)
+    {
+        if (needed <= capacity)
+            return;
+        size_t newCapacity = std::max(needed, capacity * 2);
+        unsigned int bigger;
+        glGenBuffers(1, &bigger);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, bigger);
+        glBufferData(GL_COPY_WRITE_BUFFER, newCapacity * elementSize, nullptr, GL_STATIC_DRAW);
+        if (capacity > 0)
+        {
+            glBindBuffer(GL_COPY_READ_BUFFER, buffer);
+            glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, (target == GL_ARRAY_BUFFER ? vertexCount : indexCount) * elementSize);
+        }
+        glDeleteBuffers(1, &buffer);
+        buffer = bigger;
+        capacity = newCapacity;
+
+        glBindVertexArray(VAO);
+        if (target == GL_ELEMENT_ARRAY_BUFFER)
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+        else
+            setupAttributes();
+        glBindVertexArray(0);
+    }
+};
+#endif
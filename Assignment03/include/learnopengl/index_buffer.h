@@ -0,0 +1,156 @@
+#ifndef INDEX_BUFFER_H
+#define INDEX_BUFFER_H
+
+#include "GL/glew.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// index buffers in the narrowest type that fits: 8-bit for up to 255 vertices, 16-bit for up to 65535, and
+// otherwise still 16-bit where a triangle list can be cut into chunks whose vertices each span fewer than
+// 65535 (drawn with glDrawElementsBaseVertex). Meshes whose vertices are ordered by first use
+// (optimizeVertexFetch) chunk well; when they don't, the indices stay 32-bit. The largest value of each
+// type is kept free as the primitive restart index.
+
+// marks a strip or fan restart in 32-bit source indices; packIndices() maps it to the packed type's
+const unsigned int PRIMITIVE_RESTART = 0xFFFFFFFFu;
+
+// a range of the packed indices drawn with its own base vertex
+struct IndexChunk {
+    uint32_t first;      // in indices of the packed type
+    uint32_t count;
+    int32_t  baseVertex;
+};
+
+// triangle lists with fewer triangles per chunk than this on average are left 32-bit
+const unsigned int INDEX_CHUNK_MIN_TRIANGLES = 1024;
+
+struct PackedIndices {
+    GLenum type = GL_UNSIGNED_INT;
+    std::vector<IndexChunk> chunks;
+    std::vector<unsigned char> bytes;
+    // the packed data can live elsewhere instead (a mapped MeshCache); it has to stay valid until uploaded
+    const unsigned char *external = nullptr;
+    size_t externalSize = 0;
+
+    const unsigned char *data() const { return external ? external : bytes.data(); }
+    size_t size() const { return external ? externalSize : bytes.size(); }
+    unsigned int count() const
+    {
+        unsigned int total = 0;
+        for (size_t i = 0; i < chunks.size(); ++i)
+            total += chunks[i].count;
+        return total;
+    }
+};
+
+inline unsigned int indexTypeSize(GLenum type)
+{
+    return type == GL_UNSIGNED_BYTE ? 1 : (type == GL_UNSIGNED_SHORT ? 2 : 4);
+}
+
+inline unsigned int restartIndex(GLenum type)
+{
+    return type == GL_UNSIGNED_BYTE ? 0xFFu : (type == GL_UNSIGNED_SHORT ? 0xFFFFu : 0xFFFFFFFFu);
+}
+
+// sets up primitive restart for drawing indices of type (GL 3.1)
+inline void enablePrimitiveRestart(GLenum type)
+{
+    glEnable(GL_PRIMITIVE_RESTART);
+    glPrimitiveRestartIndex(restartIndex(type));
+}
+
+template <typename T>
+void appendIndices(std::vector<unsigned char> &bytes, const unsigned int *indices, size_t count, unsigned int base)
+{
+    size_t at = bytes.size();
+    bytes.resize(at + count * sizeof(T));
+    T *out = (T *)&bytes[at];
+    for (size_t i = 0; i < count; ++i)
+        out[i] = indices[i] == PRIMITIVE_RESTART ? (T)~(T)0 : (T)(indices[i] - base);
+}
+
+inline void appendIndices(std::vector<unsigned char> &bytes, GLenum type, const unsigned int *indices, size_t count, unsigned int base)
+{
+    if (type == GL_UNSIGNED_BYTE)
+        appendIndices<uint8_t>(bytes, indices, count, base);
+    else if (type == GL_UNSIGNED_SHORT)
+        appendIndices<uint16_t>(bytes, indices, count, base);
+    else
+        appendIndices<uint32_t>(bytes, indices, count, base);
+}
+
+// packs indices into vertexCount vertices for drawing as mode; only GL_TRIANGLES lists are chunked
+inline PackedIndices packIndices(const std::vector<unsigned int> &indices, unsigned int vertexCount, GLenum mode = GL_TRIANGLES)
+{
+    PackedIndices packed;
+    if (vertexCount <= 0xFFu)
+        packed.type = GL_UNSIGNED_BYTE;
+    else if (vertexCount <= 0xFFFFu)
+        packed.type = GL_UNSIGNED_SHORT;
+    else if (mode == GL_TRIANGLES && indices.size() >= 3)
+    {
+        // cut the list where the next triangle would take a chunk's vertex span past 16 bits
+        std::vector<IndexChunk> chunks;
+        unsigned int lo = ~0u, hi = 0, first = 0;
+        bool fits = true;
+        for (unsigned int t = 0; t + 3 <= indices.size(); t += 3)
+        {
+            unsigned int triLo = std::min(indices[t], std::min(indices[t + 1], indices[t + 2]));
+            unsigned int triHi = std::max(indices[t], std::max(indices[t + 1], indices[t + 2]));
+            unsigned int newLo = std::min(lo, triLo), newHi = std::max(hi, triHi);
+            fits = fits && triHi - triLo < 0xFFFFu;
+            if (t > first && newHi - newLo >= 0xFFFFu)
+            {
+                chunks.push_back({ first, t - first, (int32_t)lo });
+                first = t;
+                newLo = triLo;
+                newHi = triHi;
+            }
+            lo = newLo;
+            hi = newHi;
+        }
+        chunks.push_back({ first, (unsigned int)(indices.size() / 3 * 3) - first, (int32_t)lo });
+        if (fits && chunks.size() * INDEX_CHUNK_MIN_TRIANGLES * 3 <= indices.size())
+        {
+            packed.type = GL_UNSIGNED_SHORT;
+            packed.chunks = chunks;
+            for (size_t c = 0; c < chunks.size(); ++c)
+                appendIndices(packed.bytes, packed.type, &indices[chunks[c].first], chunks[c].count, chunks[c].baseVertex);
+            return packed;
+        }
+    }
+    packed.chunks.push_back({ 0, (uint32_t)indices.size(), 0 });
+    if (!indices.empty())
+        appendIndices(packed.bytes, packed.type, indices.data(), indices.size(), 0);
+    return packed;
+}
+
+// draws indices [first, first + count) of the packed indices of the bound VAO, whose element buffer holds
+// packed.data() at byteOffset; a range across chunks is drawn a part per chunk
+inline void drawPackedRange(GLenum mode, const PackedIndices &packed, unsigned int first, unsigned int count, size_t byteOffset = 0)
+{
+    unsigned int size = indexTypeSize(packed.type);
+    for (size_t c = 0; c < packed.chunks.size(); ++c)
+    {
+        const IndexChunk &chunk = packed.chunks[c];
+        unsigned int begin = std::max(first, chunk.first), end = std::min(first + count, chunk.first + chunk.count);
+        if (begin >= end)
+            continue;
+        void *offset = (void *)(byteOffset + begin * size);
+        if (chunk.baseVertex == 0)
+            glDrawElements(mode, end - begin, packed.type, offset);
+        else
+            glDrawElementsBaseVertex(mode, end - begin, packed.type, offset, chunk.baseVertex);
+    }
+}
+
+// draws all the packed indices
+inline void drawPackedIndices(GLenum mode, const PackedIndices &packed, size_t byteOffset = 0)
+{
+    drawPackedRange(mode, packed, 0, packed.count(), byteOffset);
+}
+#endif
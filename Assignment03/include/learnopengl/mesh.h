@@ -6,9 +6,13 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
+#include <learnopengl/index_buffer.h>
+#include <learnopengl/meshlet.h>
 #include <learnopengl/shader.h>
+#include <learnopengl/vertex_format.h>
 
 #include <string>
+#include <utility>
 #include <vector>
 using namespace std;
 
@@ -25,72 +29,258 @@ struct Vertex {
     glm::vec3 Bitangent;
 };
 
+// the full float layout, as imported
+template <>
+struct VertexFormat<Vertex>
+{
+    typedef VertexAttribs<
+        VertexAttrib<0, 3, GL_FLOAT, GL_FALSE, offsetof(Vertex, Position)>,
+        VertexAttrib<1, 3, GL_FLOAT, GL_FALSE, offsetof(Vertex, Normal)>,
+        VertexAttrib<2, 2, GL_FLOAT, GL_FALSE, offsetof(Vertex, TexCoords)>,
+        VertexAttrib<3, 3, GL_FLOAT, GL_FALSE, offsetof(Vertex, Tangent)>,
+        VertexAttrib<4, 3, GL_FLOAT, GL_FALSE, offsetof(Vertex, Bitangent)>
+    > Attribs;
+    static const uint32_t id = 0;
+    static const bool quantizedPosition = false;
+    static const VertexNormalEncoding normalEncoding = NORMAL_FLOAT;
+
+    static Vertex pack(const Vertex &v, const VertexBounds &)
+    {
+        return v;
+    }
+};
+
 struct Texture {
     unsigned int id;
     string type;
     string path;
 };
 
-class Mesh {
+// binds a texture set to units 0, 1, ... and points the samplers at them, named by the texture_diffuseN
+// convention (see Model::processMaterial). The names are built once and their locations looked up once per
+// shader program, not on every draw.
+class SamplerBinding
+{
 public:
-    // mesh Data
-    vector<Vertex>       vertices;
-    vector<unsigned int> indices;
-    vector<Texture>      textures;
-    unsigned int VAO;
-
-    // constructor
-    Mesh(vector<Vertex> vertices, vector<unsigned int> indices, vector<Texture> textures)
+    void bind(Shader &shader, const vector<Texture> &textures)
     {
-        this->vertices = vertices;
-        this->indices = indices;
-        this->textures = textures;
-
-        // now that we have all the required data, set the vertex buffers and its attribute pointers.
-        setupMesh();
+        if (names.size() != textures.size())
+        {
+            names = samplerNames(textures);
+            program = 0;
+        }
+        if (program != shader.ID)
+        {
+            program = shader.ID;
+            locations.resize(names.size());
+            for (unsigned int i = 0; i < names.size(); i++)
+                locations[i] = glGetUniformLocation(shader.ID, names[i].c_str());
+        }
+        for (unsigned int i = 0; i < textures.size(); i++)
+        {
+            glActiveTexture(GL_TEXTURE0 + i); // active proper texture unit before binding
+            // now set the sampler to the correct texture unit
+            glUniform1i(locations[i], i);
+            // and finally bind the texture
+            glBindTexture(GL_TEXTURE_2D, textures[i].id);
+        }
     }
 
-    // render the mesh
-    void Draw(Shader &shader) 
+    static vector<string> samplerNames(const vector<Texture> &textures)
     {
-        // bind appropriate textures
         unsigned int diffuseNr  = 1;
         unsigned int specularNr = 1;
         unsigned int normalNr   = 1;
         unsigned int heightNr   = 1;
-        for(unsigned int i = 0; i < textures.size(); i++)
+        vector<string> names;
+        for (unsigned int i = 0; i < textures.size(); i++)
         {
-            glActiveTexture(GL_TEXTURE0 + i); // active proper texture unit before binding
             // retrieve texture number (the N in diffuse_textureN)
             string number;
-            string name = textures[i].type;
+            const string &name = textures[i].type;
             if(name == "texture_diffuse")
                 number = std::to_string(diffuseNr++);
             else if(name == "texture_specular")
-                number = std::to_string(specularNr++); // transfer unsigned int to stream
+                number = std::to_string(specularNr++);
             else if(name == "texture_normal")
-                number = std::to_string(normalNr++); // transfer unsigned int to stream
-             else if(name == "texture_height")
-                number = std::to_string(heightNr++); // transfer unsigned int to stream
+                number = std::to_string(normalNr++);
+            else if(name == "texture_height")
+                number = std::to_string(heightNr++);
+            names.push_back(name + number);
+        }
+        return names;
+    }
 
-            // now set the sampler to the correct texture unit
-            glUniform1i(glGetUniformLocation(shader.ID, (name + number).c_str()), i);
-            // and finally bind the texture
-            glBindTexture(GL_TEXTURE_2D, textures[i].id);
+private:
+    vector<string> names;
+    unsigned int program = 0;
+    vector<GLint> locations;
+};
+
+// sets the uniforms that tell the vertex shader how to decode a vertex layout (see VertexFormat), with their
+// locations looked up once per shader program like SamplerBinding's
+class VertexFormatUniforms
+{
+public:
+    void set(Shader &shader, bool quantizedPosition, int normalEncoding)
+    {
+        if (program != shader.ID)
+        {
+            program = shader.ID;
+            quantizedPositionLocation = glGetUniformLocation(shader.ID, "quantizedPosition");
+            normalEncodingLocation = glGetUniformLocation(shader.ID, "normalEncoding");
         }
+        glUniform1i(quantizedPositionLocation, (int)quantizedPosition);
+        glUniform1i(normalEncodingLocation, normalEncoding);
+    }
+
+    // back to the float layout of the other draws
+    void reset(Shader &shader)
+    {
+        set(shader, false, NORMAL_FLOAT);
+    }
+
+private:
+    unsigned int program = 0;
+    GLint quantizedPositionLocation = -1, normalEncodingLocation = -1;
+};
+
+// a coarser index list over the vertices of a mesh (mesh_simplify.h)
+struct MeshLod {
+    PackedIndices indices;
+    float error;            // in the mesh's units
+    size_t byteOffset = 0;  // where it is in the mesh's element buffer, once uploaded
+};
+
+// a mesh with vertices of layout V (see vertex_format.h); Mesh is the full float layout.
+template <typename V>
+class BasicMesh {
+public:
+    // mesh Data
+    vector<V>            vertices;
+    vector<unsigned int> indices;
+    vector<Texture>      textures;
+    VertexBounds         bounds; // what quantized positions are relative to
+    PackedIndices        packedIndices; // the indices as uploaded: 8/16-bit where they fit, in chunks if needed
+    vector<MeshLod>      lods;          // below the full mesh, coarsest last; set before the upload
+    glm::vec3            sphereCenter = glm::vec3(0.0f); // bounding sphere the LOD is selected by
+    float                sphereRadius = 0.0f;
+    vector<Meshlet>      meshlets;      // of the full indices, for culling (meshlet.h)
+    unsigned int indexCount;
+    unsigned int VAO;
+
+    // constructor; with upload false no GL calls are made (e.g. on a loader thread) until Upload() is called.
+    BasicMesh(vector<V> vertices, vector<unsigned int> indices, vector<Texture> textures, bool upload = true, VertexBounds bounds = VertexBounds())
+    {
+        this->vertices = std::move(vertices);
+        this->indices = std::move(indices);
+        this->textures = std::move(textures);
+        this->bounds = bounds;
+        this->indexCount = (unsigned int)this->indices.size();
+        this->packedIndices = packIndices(this->indices, (unsigned int)this->vertices.size());
+
+        // now that we have all the required data, set the vertex buffers and its attribute pointers.
+        if (upload)
+            setupMesh();
+    }
+
+    // constructor over vertices and packed indices owned elsewhere (e.g. a mapped MeshCache), which have to stay
+    // valid until the buffers are created; vertices and indices stay empty.
+    BasicMesh(const V *vertexData, unsigned int vertexCount, PackedIndices packed, vector<Texture> textures, bool upload = true,
+              VertexBounds bounds = VertexBounds())
+        : textures(textures), bounds(bounds), packedIndices(std::move(packed)), externalVertices(vertexData), externalVertexCount(vertexCount)
+    {
+        indexCount = packedIndices.count();
+        if (upload)
+            setupMesh();
+    }
+
+    // creates the buffers of a mesh constructed with upload false (GL thread only)
+    void Upload()
+    {
+        setupMesh();
+    }
+
+    // render the mesh, at a LOD: 0 is the full mesh, l the l-th of lods. With ranges only those index
+    // ranges of the full mesh are drawn (its visible meshlets).
+    void Draw(Shader &shader, unsigned int lod = 0, const vector<IndexRange> *ranges = nullptr) 
+    {
+        // bind appropriate textures
+        samplers.bind(shader, textures);
         
+        // how the vertex shader decodes this layout
+        formatUniforms.set(shader, VertexFormat<V>::quantizedPosition, VertexFormat<V>::normalEncoding);
+        if (VertexFormat<V>::quantizedPosition)
+        {
+            // locations 5 and 6 have no array here, so every vertex reads these values
+            glVertexAttrib3fv(5, &bounds.offset.x);
+            glVertexAttrib3fv(6, &bounds.scale.x);
+        }
+
         // draw mesh
         glBindVertexArray(VAO);
-        glDrawElements(GL_TRIANGLES, indices.size(), GL_UNSIGNED_INT, 0);
+        if ((lod == 0 || lod > lods.size()) && ranges)
+        {
+            for (unsigned int r = 0; r < ranges->size(); r++)
+                drawPackedRange(GL_TRIANGLES, packedIndices, (*ranges)[r].first, (*ranges)[r].count);
+        }
+        else if (lod == 0 || lod > lods.size())
+            drawPackedIndices(GL_TRIANGLES, packedIndices);
+        else
+            drawPackedIndices(GL_TRIANGLES, lods[lod - 1].indices, lods[lod - 1].byteOffset);
         glBindVertexArray(0);
 
         // always good practice to set everything back to defaults once configured.
         glActiveTexture(GL_TEXTURE0);
+        formatUniforms.reset(shader);
+    }
+
+    // the vertices, wherever they are (valid until uploaded for the external-data constructor)
+    const V *vertexData() const { return externalVertices ? externalVertices : vertices.data(); }
+    unsigned int vertexCount() const { return externalVertices ? externalVertexCount : (unsigned int)vertices.size(); }
+
+    // the LOD errors, the full mesh's (0) first
+    vector<float> lodErrors() const
+    {
+        vector<float> errors(1, 0.0f);
+        for (unsigned int l = 0; l < lods.size(); l++)
+            errors.push_back(lods[l].error);
+        return errors;
+    }
+
+    // drops the external data once it's been copied elsewhere (e.g. into a GeometryArena)
+    void releaseExternalData()
+    {
+        externalVertices = nullptr;
+        packedIndices.external = nullptr;
+        packedIndices.externalSize = 0;
+        for (unsigned int l = 0; l < lods.size(); l++)
+        {
+            lods[l].indices.external = nullptr;
+            lods[l].indices.externalSize = 0;
+        }
+    }
+
+    // drops the CPU copies of the vertices and indices (of the LODs too) once they've been copied into a
+    // GeometryArena; the chunk tables, the meshlets and the bounds stay for culling and LOD selection
+    void releaseGeometry()
+    {
+        releaseExternalData();
+        vector<V>().swap(vertices);
+        vector<unsigned int>().swap(indices);
+        std::vector<unsigned char>().swap(packedIndices.bytes);
+        for (unsigned int l = 0; l < lods.size(); l++)
+            std::vector<unsigned char>().swap(lods[l].indices.bytes);
     }
 
 private:
     // render data 
     unsigned int VBO, EBO;
+    // geometry of the external-data constructor
+    const V *externalVertices = nullptr;
+    unsigned int externalVertexCount = 0;
+    SamplerBinding samplers;
+    VertexFormatUniforms formatUniforms;
 
     // initializes all the buffer objects/arrays
     void setupMesh()
@@ -106,29 +296,32 @@ private:
         // A great thing about structs is that their memory layout is sequential for all its items.
         // The effect is that we can simply pass a pointer to the struct and it translates perfectly to a glm::vec3/2 array which
         // again translates to 3/2 floats which translates to a byte array.
-        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), &vertices[0], GL_STATIC_DRAW);  
+        if (externalVertices)
+            glBufferData(GL_ARRAY_BUFFER, externalVertexCount * sizeof(V), externalVertices, GL_STATIC_DRAW);
+        else
+            glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(V), &vertices[0], GL_STATIC_DRAW);  
 
+        // the LODs follow the full indices in the same buffer, each aligned to 4 bytes whatever its type
+        size_t indexBytes = packedIndices.size();
+        for (unsigned int l = 0; l < lods.size(); l++)
+        {
+            lods[l].byteOffset = (indexBytes + 3) & ~(size_t)3;
+            indexBytes = lods[l].byteOffset + lods[l].indices.size();
+        }
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), &indices[0], GL_STATIC_DRAW);
-
-        // set the vertex attribute pointers
-        // vertex Positions
-        glEnableVertexAttribArray(0);	
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
-        // vertex normals
-        glEnableVertexAttribArray(1);	
-        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Normal));
-        // vertex texture coords
-        glEnableVertexAttribArray(2);	
-        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, TexCoords));
-        // vertex tangent
-        glEnableVertexAttribArray(3);
-        glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Tangent));
-        // vertex bitangent
-        glEnableVertexAttribArray(4);
-        glVertexAttribPointer(4, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Bitangent));
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexBytes, nullptr, GL_STATIC_DRAW);
+        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, packedIndices.size(), packedIndices.data());
+        for (unsigned int l = 0; l < lods.size(); l++)
+            glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, lods[l].byteOffset, lods[l].indices.size(), lods[l].indices.data());
+        // the external data may go away once it's in the buffers
+        releaseExternalData();
+
+        // set the vertex attribute pointers, as the layout describes them
+        VertexFormat<V>::Attribs::enable(sizeof(V));
 
         glBindVertexArray(0);
     }
 };
+
+typedef BasicMesh<Vertex> Mesh;
 #endif
@@ -0,0 +1,369 @@
+#ifndef MESH_CACHE_H
+#define MESH_CACHE_H
+
+#include <learnopengl/binary_cache.h>
+#include <learnopengl/mapped_file.h>
+#include <learnopengl/mesh.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+// a model's import result (what Model builds from the Assimp scene) as one binary file next to the model:
+// the interleaved vertices and the indices of all meshes back to back, a table of the meshes, and the
+// material textures of each. Loading maps the file and the meshes upload straight from the mapping, so
+// neither Assimp nor a copy of the geometry is involved.
+//
+// layout: BinaryCacheHeader, MeshCacheInfo, MeshCacheEntry[meshCount], MeshCacheLod[lodCount],
+// Meshlet[meshletCount], IndexChunk[chunkCount], (type, path) string pairs of the textures, (path, uint64_t hash)
+// of the files the import read besides the model, then the vertex array (in the layout the model uses) at
+// vertexOffset and the packed indices (index_buffer.h) of every mesh and its LODs at indexOffset.
+
+// bump whenever the layout of the file or the meaning of its contents changes.
+const uint32_t MESH_CACHE_VERSION = 6;
+const char MESH_CACHE_MAGIC[4] = { 'M', 'S', 'H', 'C' };
+
+struct MeshCacheInfo {
+    uint32_t meshCount;
+    uint32_t textureCount;
+    uint32_t chunkCount;
+    uint32_t lodCount;
+    uint32_t meshletCount;
+    uint32_t dependencyCount;
+    uint64_t vertexOffset, vertexCount; // byte offset from the start of the file, count in vertices
+    uint64_t indexOffset, indexBytes;
+};
+
+// one mesh; the counts are into the shared arrays
+struct MeshCacheEntry {
+    uint32_t firstVertex, vertexCount;
+    uint64_t firstIndexByte, indexBytes;
+    uint32_t indexType;
+    uint32_t firstChunk, chunkCount;
+    uint32_t firstTexture, textureCount;
+    float boundsOffset[3], boundsScale[3]; // VertexBounds of quantized positions
+    float sphere[4];                       // bounding sphere: center, radius
+    uint32_t firstLod, lodCount;
+    uint32_t firstMeshlet, meshletCount;   // of the full indices
+};
+
+// one LOD of a mesh, its indices laid out like the mesh's own
+struct MeshCacheLod {
+    uint64_t firstIndexByte, indexBytes;
+    uint32_t indexType;
+    uint32_t firstChunk, chunkCount;
+    float error;
+};
+
+inline std::string meshCachePath(const std::string &modelPath)
+{
+    return modelPath + ".meshcache";
+}
+
+// key of a model's cache: the model file, the import flags, whether the meshes were optimized and LODs and
+// meshlets built, and the vertex layout. The other files the import read (an .mtl, say) are listed in the cache
+// with their hashes and checked when it's opened; textures aren't part of it, they're loaded on every load.
+template <typename V>
+uint64_t meshCacheKey(const std::string &modelPath, unsigned int importFlags, bool optimized, bool lods, bool meshlets)
+{
+    Fnv1a64 hash;
+    hash.updateValue(MESH_CACHE_VERSION);
+    hash.updateString(modelPath);
+    hash.updateFile(modelPath);
+    hash.updateValue(importFlags);
+    hash.updateValue(optimized);
+    hash.updateValue(lods);
+    hash.updateValue(meshlets);
+    hash.updateValue(VertexFormat<V>::id);
+    hash.updateValue((uint32_t)sizeof(V));
+    return hash.value;
+}
+
+// hash of a file the import read; a missing file has one too, so the cache goes stale once it shows up
+inline uint64_t meshCacheDependencyHash(const std::string &path)
+{
+    Fnv1a64 hash;
+    hash.updateValue(hash.updateFile(path));
+    return hash.value;
+}
+
+// writes the meshes of a freshly imported model; dependencies are the files the import read besides the model
+template <typename V>
+bool writeMeshCache(const std::string &path, uint64_t key, const std::vector<BasicMesh<V>> &meshes,
+                    const std::vector<std::string> &dependencies)
+{
+    MeshCacheInfo info = {};
+    info.meshCount = (uint32_t)meshes.size();
+    info.dependencyCount = (uint32_t)dependencies.size();
+    std::vector<MeshCacheEntry> entries;
+    std::vector<MeshCacheLod> lods;
+    std::vector<const PackedIndices *> indexLists; // in the order they're in the file
+    size_t stringBytes = 0;
+    // every index list starts aligned to 4 bytes, whatever the type of the one before
+    auto place = [&](const PackedIndices &indices, uint64_t &firstIndexByte, uint64_t &indexBytes, uint32_t &firstChunk, uint32_t &chunkCount)
+    {
+        info.indexBytes = (info.indexBytes + 3) & ~(uint64_t)3;
+        firstIndexByte = info.indexBytes;
+        indexBytes = indices.size();
+        firstChunk = info.chunkCount;
+        chunkCount = (uint32_t)indices.chunks.size();
+        info.indexBytes += indexBytes;
+        info.chunkCount += chunkCount;
+        indexLists.push_back(&indices);
+    };
+    for (unsigned int i = 0; i < meshes.size(); ++i)
+    {
+        const BasicMesh<V> &mesh = meshes[i];
+        MeshCacheEntry entry = {};
+        entry.firstVertex = (uint32_t)info.vertexCount;
+        entry.vertexCount = (uint32_t)mesh.vertices.size();
+        place(mesh.packedIndices, entry.firstIndexByte, entry.indexBytes, entry.firstChunk, entry.chunkCount);
+        entry.indexType = mesh.packedIndices.type;
+        entry.firstLod = info.lodCount;
+        entry.lodCount = (uint32_t)mesh.lods.size();
+        for (unsigned int l = 0; l < mesh.lods.size(); ++l)
+        {
+            MeshCacheLod lod = {};
+            place(mesh.lods[l].indices, lod.firstIndexByte, lod.indexBytes, lod.firstChunk, lod.chunkCount);
+            lod.indexType = mesh.lods[l].indices.type;
+            lod.error = mesh.lods[l].error;
+            lods.push_back(lod);
+        }
+        info.lodCount += entry.lodCount;
+        entry.firstMeshlet = info.meshletCount;
+        entry.meshletCount = (uint32_t)mesh.meshlets.size();
+        info.meshletCount += entry.meshletCount;
+        entry.firstTexture = info.textureCount;
+        entry.textureCount = (uint32_t)mesh.textures.size();
+        for (int k = 0; k < 3; ++k)
+        {
+            entry.boundsOffset[k] = mesh.bounds.offset[k];
+            entry.boundsScale[k] = mesh.bounds.scale[k];
+            entry.sphere[k] = mesh.sphereCenter[k];
+        }
+        entry.sphere[3] = mesh.sphereRadius;
+        entries.push_back(entry);
+        info.vertexCount += entry.vertexCount;
+        info.textureCount += entry.textureCount;
+        for (unsigned int t = 0; t < mesh.textures.size(); ++t)
+            stringBytes += 2 * sizeof(uint32_t) + mesh.textures[t].type.size() + mesh.textures[t].path.size();
+    }
+    for (size_t d = 0; d < dependencies.size(); ++d)
+        stringBytes += sizeof(uint32_t) + dependencies[d].size() + sizeof(uint64_t);
+    // the arrays start 16-byte aligned, so they can be read in place
+    size_t tableEnd = sizeof(BinaryCacheHeader) + sizeof(MeshCacheInfo) + entries.size() * sizeof(MeshCacheEntry) +
+                      lods.size() * sizeof(MeshCacheLod) + info.meshletCount * sizeof(Meshlet) + info.chunkCount * sizeof(IndexChunk) + stringBytes;
+    info.vertexOffset = (tableEnd + 15) & ~(size_t)15;
+    info.indexOffset = (info.vertexOffset + info.vertexCount * sizeof(V) + 15) & ~(uint64_t)15;
+
+    BinaryWriter writer(path);
+    if (!writer.good())
+        return false;
+    writeCacheHeader(writer, MESH_CACHE_MAGIC, MESH_CACHE_VERSION, key);
+    writer.writeValue(info);
+    if (!entries.empty())
+        writer.write(&entries[0], entries.size() * sizeof(MeshCacheEntry));
+    if (!lods.empty())
+        writer.write(&lods[0], lods.size() * sizeof(MeshCacheLod));
+    for (unsigned int i = 0; i < meshes.size(); ++i)
+        if (!meshes[i].meshlets.empty())
+            writer.write(&meshes[i].meshlets[0], meshes[i].meshlets.size() * sizeof(Meshlet));
+    for (size_t i = 0; i < indexLists.size(); ++i)
+        if (!indexLists[i]->chunks.empty())
+            writer.write(&indexLists[i]->chunks[0], indexLists[i]->chunks.size() * sizeof(IndexChunk));
+    for (unsigned int i = 0; i < meshes.size(); ++i)
+        for (unsigned int t = 0; t < meshes[i].textures.size(); ++t)
+        {
+            writer.writeString(meshes[i].textures[t].type);
+            writer.writeString(meshes[i].textures[t].path);
+        }
+    for (size_t d = 0; d < dependencies.size(); ++d)
+    {
+        writer.writeString(dependencies[d]);
+        writer.writeValue(meshCacheDependencyHash(dependencies[d]));
+    }
+    const char padding[16] = {};
+    writer.write(padding, info.vertexOffset - tableEnd);
+    for (unsigned int i = 0; i < meshes.size(); ++i)
+        if (!meshes[i].vertices.empty())
+            writer.write(&meshes[i].vertices[0], meshes[i].vertices.size() * sizeof(V));
+    writer.write(padding, info.indexOffset - (info.vertexOffset + info.vertexCount * sizeof(V)));
+    uint64_t written = 0;
+    for (size_t i = 0; i < indexLists.size(); ++i)
+    {
+        uint64_t aligned = (written + 3) & ~(uint64_t)3;
+        writer.write(padding, aligned - written);
+        writer.write(indexLists[i]->data(), indexLists[i]->size());
+        written = aligned + indexLists[i]->size();
+    }
+    return writer.good();
+}
+
+// a mapped cache file, validated against its key and its own table. The vertex pointer and the indices()
+// point into the mapping and stay valid as long as the MeshCache does.
+template <typename V>
+class MeshCache
+{
+public:
+    struct Texture {
+        std::string type, path;
+    };
+
+    std::vector<MeshCacheEntry> entries;
+    std::vector<MeshCacheLod> lods;
+    std::vector<Meshlet> meshlets;
+    std::vector<IndexChunk> chunks;
+    std::vector<Texture> textures;
+    const V *vertices = nullptr;
+
+    // opens path; valid() is false for a missing, stale or damaged file, and when a file the import read has
+    // changed since
+    MeshCache(const std::string &path, uint64_t key) : file(path)
+    {
+        const unsigned char *data = file.data();
+        size_t size = file.size(), at = 0;
+        BinaryCacheHeader header;
+        MeshCacheInfo info;
+        if (!take(&header, sizeof(header), at) || memcmp(header.magic, MESH_CACHE_MAGIC, 4) != 0 ||
+            header.version != MESH_CACHE_VERSION || header.key != key || !take(&info, sizeof(info), at))
+            return;
+        // every count is checked against the file size before anything is allocated from it
+        if (info.meshCount > size / sizeof(MeshCacheEntry) || info.textureCount > size / (2 * sizeof(uint32_t)) ||
+            info.dependencyCount > size / (sizeof(uint32_t) + sizeof(uint64_t)) ||
+            info.chunkCount > size / sizeof(IndexChunk) || info.lodCount > size / sizeof(MeshCacheLod) ||
+            info.meshletCount > size / sizeof(Meshlet) ||
+            info.vertexOffset > size || info.vertexCount > (size - info.vertexOffset) / sizeof(V) ||
+            info.indexOffset > size || info.indexBytes > size - info.indexOffset ||
+            info.vertexOffset % 16 != 0 || info.indexOffset % 16 != 0)
+            return;
+        entries.resize(info.meshCount);
+        if (!entries.empty() && !take(&entries[0], entries.size() * sizeof(MeshCacheEntry), at))
+            return;
+        lods.resize(info.lodCount);
+        if (!lods.empty() && !take(&lods[0], lods.size() * sizeof(MeshCacheLod), at))
+            return;
+        meshlets.resize(info.meshletCount);
+        if (!meshlets.empty() && !take(&meshlets[0], meshlets.size() * sizeof(Meshlet), at))
+            return;
+        chunks.resize(info.chunkCount);
+        if (!chunks.empty() && !take(&chunks[0], chunks.size() * sizeof(IndexChunk), at))
+            return;
+        textures.resize(info.textureCount);
+        for (unsigned int t = 0; t < textures.size(); ++t)
+            if (!takeString(textures[t].type, at) || !takeString(textures[t].path, at))
+                return;
+        for (uint32_t d = 0; d < info.dependencyCount; ++d)
+        {
+            std::string dependency;
+            uint64_t hash = 0;
+            if (!takeString(dependency, at) || !take(&hash, sizeof(hash), at) || meshCacheDependencyHash(dependency) != hash)
+                return;
+        }
+        for (unsigned int i = 0; i < entries.size(); ++i)
+        {
+            const MeshCacheEntry &entry = entries[i];
+            if ((uint64_t)entry.firstVertex + entry.vertexCount > info.vertexCount ||
+                !validIndices(info, entry.firstIndexByte, entry.indexBytes, entry.indexType, entry.firstChunk, entry.chunkCount) ||
+                (uint64_t)entry.firstLod + entry.lodCount > info.lodCount ||
+                (uint64_t)entry.firstMeshlet + entry.meshletCount > info.meshletCount ||
+                (uint64_t)entry.firstTexture + entry.textureCount > info.textureCount)
+                return;
+        }
+        for (unsigned int l = 0; l < lods.size(); ++l)
+            if (!validIndices(info, lods[l].firstIndexByte, lods[l].indexBytes, lods[l].indexType, lods[l].firstChunk, lods[l].chunkCount))
+                return;
+        vertices = (const V *)(data + info.vertexOffset);
+        indexData = data + info.indexOffset;
+        ok = true;
+    }
+
+    bool valid() const { return ok; }
+
+    // the packed indices of a mesh, pointing into the mapping
+    PackedIndices indices(const MeshCacheEntry &entry) const
+    {
+        return indices(entry.firstIndexByte, entry.indexBytes, entry.indexType, entry.firstChunk, entry.chunkCount);
+    }
+
+    // the LODs of a mesh, their indices pointing into the mapping
+    std::vector<MeshLod> meshLods(const MeshCacheEntry &entry) const
+    {
+        std::vector<MeshLod> result;
+        for (uint32_t l = entry.firstLod; l < entry.firstLod + entry.lodCount; ++l)
+        {
+            MeshLod lod;
+            lod.indices = indices(lods[l].firstIndexByte, lods[l].indexBytes, lods[l].indexType, lods[l].firstChunk, lods[l].chunkCount);
+            lod.error = lods[l].error;
+            result.push_back(lod);
+        }
+        return result;
+    }
+
+    // the meshlets of a mesh; their ranges are checked against its index count
+    std::vector<Meshlet> meshMeshlets(const MeshCacheEntry &entry) const
+    {
+        std::vector<Meshlet> result(meshlets.begin() + entry.firstMeshlet, meshlets.begin() + entry.firstMeshlet + entry.meshletCount);
+        uint32_t indexCount = indices(entry).count();
+        for (size_t m = 0; m < result.size(); ++m)
+            if (result[m].firstIndex > indexCount || result[m].indexCount > indexCount - result[m].firstIndex)
+                return std::vector<Meshlet>();
+        return result;
+    }
+
+    static VertexBounds bounds(const MeshCacheEntry &entry)
+    {
+        VertexBounds bounds;
+        bounds.offset = glm::vec3(entry.boundsOffset[0], entry.boundsOffset[1], entry.boundsOffset[2]);
+        bounds.scale = glm::vec3(entry.boundsScale[0], entry.boundsScale[1], entry.boundsScale[2]);
+        return bounds;
+    }
+
+    static glm::vec3 sphereCenter(const MeshCacheEntry &entry)
+    {
+        return glm::vec3(entry.sphere[0], entry.sphere[1], entry.sphere[2]);
+    }
+
+private:
+    MappedFile file;
+    const unsigned char *indexData = nullptr;
+    bool ok = false;
+
+    static bool validIndices(const MeshCacheInfo &info, uint64_t firstIndexByte, uint64_t indexBytes, uint32_t indexType,
+                             uint32_t firstChunk, uint32_t chunkCount)
+    {
+        return firstIndexByte <= info.indexBytes && indexBytes <= info.indexBytes - firstIndexByte &&
+               (uint64_t)firstChunk + chunkCount <= info.chunkCount &&
+               (indexType == GL_UNSIGNED_BYTE || indexType == GL_UNSIGNED_SHORT || indexType == GL_UNSIGNED_INT);
+    }
+
+    PackedIndices indices(uint64_t firstIndexByte, uint64_t indexBytes, uint32_t indexType, uint32_t firstChunk, uint32_t chunkCount) const
+    {
+        PackedIndices packed;
+        packed.type = indexType;
+        packed.chunks.assign(chunks.begin() + firstChunk, chunks.begin() + firstChunk + chunkCount);
+        packed.external = indexData + firstIndexByte;
+        packed.externalSize = (size_t)indexBytes;
+        return packed;
+    }
+
+    bool take(void *out, size_t bytes, size_t &at) const
+    {
+        if (!file.data() || bytes > file.size() - at)
+            return false;
+        memcpy(out, file.data() + at, bytes);
+        at += bytes;
+        return true;
+    }
+    bool takeString(std::string &s, size_t &at) const
+    {
+        uint32_t length = 0;
+        if (!take(&length, sizeof(length), at) || length > file.size() - at)
+            return false;
+        s.assign((const char *)file.data() + at, length);
+        at += length;
+        return true;
+    }
+};
+#endif
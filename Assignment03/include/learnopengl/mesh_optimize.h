@@ -0,0 +1,262 @@
+#ifndef MESH_OPTIMIZE_H
+#define MESH_OPTIMIZE_H
+
+#include <learnopengl/mesh.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// import-time optimization of an indexed triangle list, in the order Model applies it:
+// weldVertices() merges bit-identical vertices, optimizeVertexCache() reorders the triangles for the
+// post-transform vertex cache (Tom Forsyth's "Linear-Speed Vertex Cache Optimisation") and
+// optimizeVertexFetch() renumbers the vertices in the order the triangles first use them, so the vertex
+// fetches walk the buffer front to back. analyzeVertexCache() measures the result.
+
+// post-transform cache statistics of a simulated FIFO cache: ACMR is vertex shader runs per triangle (0.5 is
+// the ideal for a large regular grid, 3 the worst), ATVR per unique vertex (1 is ideal).
+struct VertexCacheStats {
+    float acmr = 0.0f;
+    float atvr = 0.0f;
+    unsigned int transformed = 0;
+};
+
+// cache size of analyzeVertexCache(); about what current GPUs reuse across a draw
+const unsigned int VERTEX_CACHE_ANALYSIS_SIZE = 16;
+// cache size optimizeVertexCache() scores for
+const unsigned int VERTEX_CACHE_OPTIMIZE_SIZE = 32;
+
+inline VertexCacheStats analyzeVertexCache(const std::vector<unsigned int> &indices, unsigned int vertexCount,
+                                           unsigned int cacheSize = VERTEX_CACHE_ANALYSIS_SIZE)
+{
+    VertexCacheStats stats;
+    // a vertex is in the FIFO while it was inserted less than cacheSize insertions ago
+    std::vector<unsigned int> insertedAt(vertexCount, 0);
+    unsigned int insertions = 0;
+    for (size_t i = 0; i < indices.size(); ++i)
+    {
+        unsigned int v = indices[i];
+        if (insertedAt[v] == 0 || insertions - insertedAt[v] >= cacheSize)
+            insertedAt[v] = ++insertions;
+    }
+    stats.transformed = insertions;
+    if (indices.size() >= 3)
+        stats.acmr = (float)insertions / (indices.size() / 3);
+    if (vertexCount > 0)
+        stats.atvr = (float)insertions / vertexCount;
+    return stats;
+}
+
+// merges vertices whose bytes are identical and remaps the indices; returns the new vertex count
+inline unsigned int weldVertices(std::vector<Vertex> &vertices, std::vector<unsigned int> &indices)
+{
+    // open addressing over the unique vertices, at most half full
+    size_t tableSize = 1;
+    while (tableSize < vertices.size() * 2)
+        tableSize *= 2;
+    const unsigned int empty = ~0u;
+    std::vector<unsigned int> table(tableSize, empty);
+    std::vector<unsigned int> remap(vertices.size());
+    unsigned int unique = 0;
+    for (unsigned int v = 0; v < vertices.size(); ++v)
+    {
+        const unsigned char *bytes = (const unsigned char *)&vertices[v];
+        uint64_t hash = 14695981039346656037ull;
+        for (size_t b = 0; b < sizeof(Vertex); ++b)
+            hash = (hash ^ bytes[b]) * 1099511628211ull;
+        size_t slot = (size_t)hash & (tableSize - 1);
+        while (table[slot] != empty && memcmp(&vertices[table[slot]], bytes, sizeof(Vertex)) != 0)
+            slot = (slot + 1) & (tableSize - 1);
+        if (table[slot] == empty)
+        {
+            // unique vertices are compacted in place; unique <= v, so this never overwrites one still to be read
+            vertices[unique] = vertices[v];
+            table[slot] = unique++;
+        }
+        remap[v] = table[slot];
+    }
+    vertices.resize(unique);
+    for (size_t i = 0; i < indices.size(); ++i)
+        indices[i] = remap[indices[i]];
+    return unique;
+}
+
+// Forsyth's vertex score: vertices in the cache score by their position (the last triangle's three equally,
+// as they'll be hit next whatever the order), and vertices with few triangles left score higher so they're
+// finished off instead of leaving isolated triangles behind.
+inline float forsythVertexScore(int cachePosition, unsigned int remainingTriangles)
+{
+    if (remainingTriangles == 0)
+        return -1.0f;
+    float score = 0.0f;
+    if (cachePosition >= 0)
+    {
+        if (cachePosition < 3)
+            score = 0.75f;
+        else
+            score = std::pow(1.0f - (float)(cachePosition - 3) / (VERTEX_CACHE_OPTIMIZE_SIZE - 3), 1.5f);
+    }
+    return score + 2.0f * std::pow((float)remainingTriangles, -0.5f);
+}
+
+// reorders the triangles of a triangle list for the post-transform cache; the vertices aren't touched
+inline void optimizeVertexCache(std::vector<unsigned int> &indices, unsigned int vertexCount)
+{
+    unsigned int triangleCount = (unsigned int)(indices.size() / 3);
+    if (triangleCount == 0)
+        return;
+
+    // triangles of every vertex; the first `remaining[v]` of them are the ones not emitted yet
+    std::vector<unsigned int> remaining(vertexCount, 0), firstTriangle(vertexCount + 1, 0);
+    for (size_t i = 0; i < triangleCount * 3; ++i)
+        ++remaining[indices[i]];
+    for (unsigned int v = 0; v < vertexCount; ++v)
+        firstTriangle[v + 1] = firstTriangle[v] + remaining[v];
+    std::vector<unsigned int> vertexTriangles(triangleCount * 3), filled(vertexCount, 0);
+    for (unsigned int t = 0; t < triangleCount; ++t)
+        for (int k = 0; k < 3; ++k)
+        {
+            unsigned int v = indices[t * 3 + k];
+            vertexTriangles[firstTriangle[v] + filled[v]++] = t;
+        }
+
+    std::vector<int> cachePosition(vertexCount, -1);
+    std::vector<float> vertexScore(vertexCount);
+    for (unsigned int v = 0; v < vertexCount; ++v)
+        vertexScore[v] = forsythVertexScore(-1, remaining[v]);
+    // start with the best triangle overall
+    unsigned int bestTriangle = 0;
+    float bestScore = -1.0f;
+    for (unsigned int t = 0; t < triangleCount; ++t)
+    {
+        float score = vertexScore[indices[t * 3]] + vertexScore[indices[t * 3 + 1]] + vertexScore[indices[t * 3 + 2]];
+        if (score > bestScore)
+        {
+            bestScore = score;
+            bestTriangle = t;
+        }
+    }
+    std::vector<bool> emitted(triangleCount, false);
+
+    std::vector<unsigned int> output;
+    output.reserve(triangleCount * 3);
+    std::vector<unsigned int> cache, nextCache;
+    unsigned int deadEndCursor = 0;
+    for (unsigned int n = 0; n < triangleCount; ++n)
+    {
+        if (bestTriangle == ~0u)
+        {
+            // nothing in the cache has triangles left: restart from the first triangle not emitted yet
+            while (emitted[deadEndCursor])
+                ++deadEndCursor;
+            bestTriangle = deadEndCursor;
+        }
+        unsigned int t = bestTriangle;
+        emitted[t] = true;
+        const unsigned int *tri = &indices[t * 3];
+        output.insert(output.end(), tri, tri + 3);
+
+        // drop the triangle from its vertices' lists
+        for (int k = 0; k < 3; ++k)
+        {
+            unsigned int v = tri[k];
+            unsigned int *list = &vertexTriangles[firstTriangle[v]];
+            for (unsigned int j = 0; j < remaining[v]; ++j)
+                if (list[j] == t)
+                {
+                    list[j] = list[--remaining[v]];
+                    break;
+                }
+        }
+
+        // the triangle's vertices move to the front of the cache, the oldest entries fall out of it
+        nextCache.assign(tri, tri + 3);
+        for (unsigned int j = 0; j < cache.size(); ++j)
+            if (cache[j] != tri[0] && cache[j] != tri[1] && cache[j] != tri[2])
+                nextCache.push_back(cache[j]);
+        for (unsigned int j = 0; j < nextCache.size(); ++j)
+        {
+            unsigned int v = nextCache[j];
+            cachePosition[v] = j < VERTEX_CACHE_OPTIMIZE_SIZE ? (int)j : -1;
+            vertexScore[v] = forsythVertexScore(cachePosition[v], remaining[v]);
+        }
+        if (nextCache.size() > VERTEX_CACHE_OPTIMIZE_SIZE)
+            nextCache.resize(VERTEX_CACHE_OPTIMIZE_SIZE);
+        cache.swap(nextCache);
+
+        // rescore the triangles of the cached vertices; the next triangle is the best of them
+        bestTriangle = ~0u;
+        bestScore = -1.0f;
+        for (unsigned int j = 0; j < cache.size(); ++j)
+        {
+            unsigned int v = cache[j];
+            for (unsigned int k = 0; k < remaining[v]; ++k)
+            {
+                unsigned int candidate = vertexTriangles[firstTriangle[v] + k];
+                const unsigned int *c = &indices[candidate * 3];
+                float score = vertexScore[c[0]] + vertexScore[c[1]] + vertexScore[c[2]];
+                if (score > bestScore)
+                {
+                    bestScore = score;
+                    bestTriangle = candidate;
+                }
+            }
+        }
+    }
+    indices.swap(output);
+}
+
+// renumbers the vertices in the order the indices first reference them; unreferenced vertices are dropped
+inline void optimizeVertexFetch(std::vector<Vertex> &vertices, std::vector<unsigned int> &indices)
+{
+    const unsigned int unassigned = ~0u;
+    std::vector<unsigned int> remap(vertices.size(), unassigned);
+    std::vector<Vertex> ordered;
+    ordered.reserve(vertices.size());
+    for (size_t i = 0; i < indices.size(); ++i)
+    {
+        unsigned int &target = remap[indices[i]];
+        if (target == unassigned)
+        {
+            target = (unsigned int)ordered.size();
+            ordered.push_back(vertices[indices[i]]);
+        }
+        indices[i] = target;
+    }
+    vertices.swap(ordered);
+}
+
+// before/after figures of one or more optimized meshes
+struct MeshOptimizeReport {
+    unsigned long long verticesBefore = 0, verticesAfter = 0;
+    unsigned long long transformedBefore = 0, transformedAfter = 0;
+    unsigned long long triangles = 0;
+
+    void add(const MeshOptimizeReport &other)
+    {
+        verticesBefore += other.verticesBefore;
+        verticesAfter += other.verticesAfter;
+        transformedBefore += other.transformedBefore;
+        transformedAfter += other.transformedAfter;
+        triangles += other.triangles;
+    }
+};
+
+// the whole stage on one triangle list
+inline MeshOptimizeReport optimizeMesh(std::vector<Vertex> &vertices, std::vector<unsigned int> &indices)
+{
+    MeshOptimizeReport report;
+    report.verticesBefore = vertices.size();
+    report.triangles = indices.size() / 3;
+    report.transformedBefore = analyzeVertexCache(indices, (unsigned int)vertices.size()).transformed;
+
+    weldVertices(vertices, indices);
+    optimizeVertexCache(indices, (unsigned int)vertices.size());
+    optimizeVertexFetch(vertices, indices);
+
+    report.verticesAfter = vertices.size();
+    report.transformedAfter = analyzeVertexCache(indices, (unsigned int)vertices.size()).transformed;
+    return report;
+}
+#endif
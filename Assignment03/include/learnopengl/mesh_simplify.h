@@ -0,0 +1,335 @@
+#ifndef MESH_SIMPLIFY_H
+#define MESH_SIMPLIFY_H
+
+#include <learnopengl/mesh.h>
+#include <learnopengl/mesh_optimize.h>
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// import-time level of detail: simplifyMesh() decimates a triangle list by edge collapses ordered by quadric
+// error (Garland and Heckbert, "Surface Simplification Using Quadric Error Metrics"), buildLodChain() makes
+// the coarser index lists of a mesh with it, and selectLod() picks the one to draw from the projected size of
+// the mesh.
+//
+// the collapses only ever move a vertex onto a neighbour, so every LOD indexes the vertices of the full mesh
+// and shares its vertex buffer. Vertices on a seam (a position shared by several vertices with different
+// normals or UVs) or on an open border are never moved, which keeps seams and silhouettes closed.
+
+// LODs made per mesh at most, the full mesh included
+const unsigned int MESH_LOD_MAX_LEVELS = 5;
+// each LOD aims at this fraction of the triangles of the one before
+const float MESH_LOD_REDUCTION = 0.5f;
+// a LOD that doesn't get below this fraction of the one before ends the chain (the locked seams dominate)
+const float MESH_LOD_MIN_REDUCTION = 0.8f;
+// LODs whose error exceeds this fraction of the mesh's bounding radius aren't made
+const float MESH_LOD_MAX_ERROR = 0.25f;
+
+// the bounding sphere LODs are selected by
+struct BoundingSphere {
+    glm::vec3 center = glm::vec3(0.0f);
+    float radius = 0.0f;
+
+    template <typename Source>
+    static BoundingSphere of(const std::vector<Source> &vertices)
+    {
+        BoundingSphere sphere;
+        if (vertices.empty())
+            return sphere;
+        glm::vec3 lo = vertices[0].Position, hi = vertices[0].Position;
+        for (size_t i = 1; i < vertices.size(); ++i)
+        {
+            lo = glm::min(lo, vertices[i].Position);
+            hi = glm::max(hi, vertices[i].Position);
+        }
+        sphere.center = (lo + hi) * 0.5f;
+        for (size_t i = 0; i < vertices.size(); ++i)
+            sphere.radius = std::max(sphere.radius, glm::length(vertices[i].Position - sphere.center));
+        return sphere;
+    }
+};
+
+// the symmetric 4x4 matrix of the squared distances to a set of planes, weighted by triangle area; weight is
+// the total, so evaluate() / weight is a mean squared distance
+struct Quadric {
+    double a00 = 0, a01 = 0, a02 = 0, a11 = 0, a12 = 0, a22 = 0;
+    double b0 = 0, b1 = 0, b2 = 0, c = 0;
+    double weight = 0;
+
+    void addPlane(const glm::dvec3 &n, double d, double w)
+    {
+        a00 += w * n.x * n.x; a01 += w * n.x * n.y; a02 += w * n.x * n.z;
+        a11 += w * n.y * n.y; a12 += w * n.y * n.z; a22 += w * n.z * n.z;
+        b0 += w * n.x * d; b1 += w * n.y * d; b2 += w * n.z * d;
+        c += w * d * d;
+        weight += w;
+    }
+
+    void add(const Quadric &q)
+    {
+        a00 += q.a00; a01 += q.a01; a02 += q.a02; a11 += q.a11; a12 += q.a12; a22 += q.a22;
+        b0 += q.b0; b1 += q.b1; b2 += q.b2; c += q.c;
+        weight += q.weight;
+    }
+
+    double evaluate(const glm::vec3 &p) const
+    {
+        double x = p.x, y = p.y, z = p.z;
+        double e = a00 * x * x + a11 * y * y + a22 * z * z + 2.0 * (a01 * x * y + a02 * x * z + a12 * y * z) +
+                   2.0 * (b0 * x + b1 * y + b2 * z) + c;
+        return std::max(e, 0.0);
+    }
+};
+
+// which vertices may not move: seam vertices and those on an open edge, both found on the welded positions
+inline std::vector<bool> lockedVertices(const std::vector<Vertex> &vertices, const std::vector<unsigned int> &indices)
+{
+    unsigned int vertexCount = (unsigned int)vertices.size();
+    // the first vertex of every position (open addressing, as weldVertices())
+    size_t tableSize = 1;
+    while (tableSize < vertexCount * 2)
+        tableSize *= 2;
+    const unsigned int empty = ~0u;
+    std::vector<unsigned int> table(tableSize, empty), position(vertexCount);
+    std::vector<unsigned int> shared(vertexCount, 0);
+    for (unsigned int v = 0; v < vertexCount; ++v)
+    {
+        const unsigned char *bytes = (const unsigned char *)&vertices[v].Position;
+        uint64_t hash = 14695981039346656037ull;
+        for (size_t b = 0; b < sizeof(glm::vec3); ++b)
+            hash = (hash ^ bytes[b]) * 1099511628211ull;
+        size_t slot = (size_t)hash & (tableSize - 1);
+        while (table[slot] != empty && memcmp(&vertices[table[slot]].Position, bytes, sizeof(glm::vec3)) != 0)
+            slot = (slot + 1) & (tableSize - 1);
+        if (table[slot] == empty)
+            table[slot] = v;
+        position[v] = table[slot];
+        ++shared[position[v]];
+    }
+    std::vector<bool> locked(vertexCount, false);
+    for (unsigned int v = 0; v < vertexCount; ++v)
+        locked[v] = shared[position[v]] > 1;
+
+    // an edge between two positions used by one triangle only is open; the edges are sorted to count them
+    std::vector<uint64_t> edges;
+    edges.reserve(indices.size());
+    for (size_t t = 0; t + 3 <= indices.size(); t += 3)
+        for (int k = 0; k < 3; ++k)
+        {
+            unsigned int a = position[indices[t + k]], b = position[indices[t + (k + 1) % 3]];
+            edges.push_back(((uint64_t)std::min(a, b) << 32) | std::max(a, b));
+        }
+    std::sort(edges.begin(), edges.end());
+    std::vector<bool> border(vertexCount, false);
+    for (size_t i = 0; i < edges.size();)
+    {
+        size_t j = i;
+        while (j < edges.size() && edges[j] == edges[i])
+            ++j;
+        if (j - i == 1)
+        {
+            border[(unsigned int)(edges[i] >> 32)] = true;
+            border[(unsigned int)(edges[i] & 0xFFFFFFFFu)] = true;
+        }
+        i = j;
+    }
+    for (unsigned int v = 0; v < vertexCount; ++v)
+        locked[v] = locked[v] || border[position[v]];
+    return locked;
+}
+
+// collapses edges of a triangle list until it has at most targetIndexCount indices or the next collapse
+// would exceed maxError (a distance, in the units of the positions). Returns the new indices, over the same
+// vertices; error gets the largest error of the collapses made.
+inline std::vector<unsigned int> simplifyMesh(const std::vector<Vertex> &vertices, const std::vector<unsigned int> &source,
+                                              size_t targetIndexCount, float maxError, float *error = nullptr)
+{
+    unsigned int vertexCount = (unsigned int)vertices.size();
+    std::vector<unsigned int> indices(source.begin(), source.begin() + source.size() / 3 * 3);
+    std::vector<bool> locked = lockedVertices(vertices, indices);
+
+    std::vector<Quadric> quadrics(vertexCount);
+    for (size_t t = 0; t < indices.size(); t += 3)
+    {
+        glm::dvec3 p0 = glm::dvec3(vertices[indices[t]].Position);
+        glm::dvec3 p1 = glm::dvec3(vertices[indices[t + 1]].Position);
+        glm::dvec3 p2 = glm::dvec3(vertices[indices[t + 2]].Position);
+        glm::dvec3 n = glm::cross(p1 - p0, p2 - p0);
+        double area = glm::length(n);
+        if (area <= 0.0)
+            continue;
+        n /= area;
+        for (int k = 0; k < 3; ++k)
+            quadrics[indices[t + k]].addPlane(n, -glm::dot(n, p0), area * 0.5);
+    }
+
+    struct Collapse {
+        unsigned int from, to;
+        float cost;
+    };
+    double limit = (double)maxError * maxError;
+    float largest = 0.0f;
+    std::vector<unsigned int> remap(vertexCount), vertexTriangles, firstTriangle(vertexCount + 1);
+    std::vector<Collapse> collapses;
+    std::vector<bool> touched(vertexCount);
+    while (indices.size() > targetIndexCount)
+    {
+        unsigned int triangleCount = (unsigned int)(indices.size() / 3);
+        // triangles of every vertex
+        std::fill(firstTriangle.begin(), firstTriangle.end(), 0);
+        for (size_t i = 0; i < indices.size(); ++i)
+            ++firstTriangle[indices[i] + 1];
+        for (unsigned int v = 0; v < vertexCount; ++v)
+            firstTriangle[v + 1] += firstTriangle[v];
+        vertexTriangles.resize(indices.size());
+        std::vector<unsigned int> filled(firstTriangle.begin(), firstTriangle.end() - 1);
+        for (unsigned int t = 0; t < triangleCount; ++t)
+            for (int k = 0; k < 3; ++k)
+                vertexTriangles[filled[indices[t * 3 + k]]++] = t;
+
+        // every edge, both ways, costed by the error of moving its first vertex onto the second
+        collapses.clear();
+        for (unsigned int t = 0; t < triangleCount; ++t)
+            for (int k = 0; k < 3; ++k)
+            {
+                unsigned int a = indices[t * 3 + k], b = indices[t * 3 + (k + 1) % 3];
+                for (int way = 0; way < 2; ++way, std::swap(a, b))
+                {
+                    if (locked[a])
+                        continue;
+                    Quadric q = quadrics[a];
+                    q.add(quadrics[b]);
+                    double cost = q.weight > 0.0 ? q.evaluate(vertices[b].Position) / q.weight : 0.0;
+                    if (cost <= limit)
+                        collapses.push_back({ a, b, (float)cost });
+                }
+            }
+        std::sort(collapses.begin(), collapses.end(), [](const Collapse &x, const Collapse &y) { return x.cost < y.cost; });
+
+        // the cheapest collapses whose one-rings don't overlap, so each sees the triangles as they are; a
+        // collapse removes about two triangles
+        for (unsigned int v = 0; v < vertexCount; ++v)
+            remap[v] = v;
+        std::fill(touched.begin(), touched.end(), false);
+        size_t wanted = (indices.size() - targetIndexCount) / 6 + 1, made = 0;
+        for (size_t c = 0; c < collapses.size() && made < wanted; ++c)
+        {
+            const Collapse &collapse = collapses[c];
+            if (touched[collapse.from] || touched[collapse.to])
+                continue;
+            // moving `from` mustn't flip any of its triangles that stay
+            const glm::vec3 &target = vertices[collapse.to].Position;
+            bool flips = false;
+            for (unsigned int j = firstTriangle[collapse.from]; j < firstTriangle[collapse.from + 1] && !flips; ++j)
+            {
+                const unsigned int *tri = &indices[vertexTriangles[j] * 3];
+                if (tri[0] == collapse.to || tri[1] == collapse.to || tri[2] == collapse.to)
+                    continue;
+                glm::vec3 p[3], q[3];
+                for (int k = 0; k < 3; ++k)
+                {
+                    p[k] = vertices[tri[k]].Position;
+                    q[k] = tri[k] == collapse.from ? target : p[k];
+                }
+                glm::vec3 before = glm::cross(p[1] - p[0], p[2] - p[0]);
+                glm::vec3 after = glm::cross(q[1] - q[0], q[2] - q[0]);
+                flips = glm::dot(before, after) <= 0.0f;
+            }
+            if (flips)
+                continue;
+            remap[collapse.from] = collapse.to;
+            quadrics[collapse.to].add(quadrics[collapse.from]);
+            largest = std::max(largest, collapse.cost);
+            ++made;
+            // the one-ring of `from` is settled for this pass
+            for (unsigned int j = firstTriangle[collapse.from]; j < firstTriangle[collapse.from + 1]; ++j)
+                for (int k = 0; k < 3; ++k)
+                    touched[indices[vertexTriangles[j] * 3 + k]] = true;
+        }
+        if (made == 0)
+            break;
+
+        // apply the collapses and drop the triangles that degenerated
+        size_t kept = 0;
+        for (size_t t = 0; t < indices.size(); t += 3)
+        {
+            unsigned int a = remap[indices[t]], b = remap[indices[t + 1]], c = remap[indices[t + 2]];
+            if (a == b || b == c || a == c)
+                continue;
+            indices[kept++] = a;
+            indices[kept++] = b;
+            indices[kept++] = c;
+        }
+        indices.resize(kept);
+    }
+    if (error)
+        *error = std::sqrt(largest);
+    return indices;
+}
+
+// an index list of a coarser LOD and its error (a distance in the mesh's units)
+struct SimplifiedLod {
+    std::vector<unsigned int> indices;
+    float error;
+};
+
+// the LODs below the full mesh, finest first, each cache-optimized; stops early when a LOD can't be
+// simplified much further or would be too coarse
+inline std::vector<SimplifiedLod> buildLodChain(const std::vector<Vertex> &vertices, const std::vector<unsigned int> &indices)
+{
+    std::vector<SimplifiedLod> lods;
+    float maxError = BoundingSphere::of(vertices).radius * MESH_LOD_MAX_ERROR;
+    const std::vector<unsigned int> *previous = &indices;
+    float previousError = 0.0f;
+    while (lods.size() + 1 < MESH_LOD_MAX_LEVELS)
+    {
+        size_t target = (size_t)(previous->size() / 3 * MESH_LOD_REDUCTION) * 3;
+        if (target < 3)
+            break;
+        SimplifiedLod lod;
+        // each level starts from the one before, so the chain is nested and the errors only grow
+        lod.indices = simplifyMesh(vertices, *previous, target, maxError, &lod.error);
+        lod.error = std::max(lod.error, previousError);
+        if (lod.indices.empty() || lod.indices.size() > previous->size() * MESH_LOD_MIN_REDUCTION)
+            break;
+        optimizeVertexCache(lod.indices, (unsigned int)vertices.size());
+        lods.push_back(std::move(lod));
+        previous = &lods.back().indices;
+        previousError = lods.back().error;
+    }
+    return lods;
+}
+
+// how the LODs of a draw are picked: the coarsest whose error, projected at the distance of the mesh's
+// bounding sphere, stays within maxPixelError pixels
+struct LodView {
+    glm::vec3 eye;
+    float pixelsPerUnit;      // at distance 1: viewport height / (2 tan(fovy / 2))
+    float maxPixelError = 1.0f;
+
+    LodView(const glm::vec3 &eye, float fovy, float viewportHeight, float maxPixelError = 1.0f)
+        : eye(eye), pixelsPerUnit(viewportHeight / (2.0f * std::tan(fovy * 0.5f))), maxPixelError(maxPixelError)
+    {
+    }
+};
+
+// errors[l] of LOD l (0 for the full mesh); sphere and scale are the mesh's bounds in world space
+inline unsigned int selectLod(const float *errors, unsigned int count, const glm::vec3 &center, float radius, float scale,
+                              const LodView &view)
+{
+    // the nearest point of the sphere; from inside it everything is drawn in full
+    float distance = glm::length(center - view.eye) - radius;
+    if (distance <= 0.0f)
+        return 0;
+    float unitsPerPixel = distance / (view.pixelsPerUnit * scale);
+    unsigned int lod = 0;
+    while (lod + 1 < count && errors[lod + 1] <= view.maxPixelError * unitsPerPixel)
+        ++lod;
+    return lod;
+}
+#endif
@@ -0,0 +1,219 @@
+#ifndef MESHLET_H
+#define MESHLET_H
+
+#include <glm/glm.hpp>
+#include <learnopengl/simd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// meshlets: a mesh's full index list cut into consecutive runs of triangles with at most
+// MESHLET_MAX_VERTICES distinct vertices and MESHLET_MAX_TRIANGLES triangles, each with a bounding sphere
+// and a cone bounding its triangles' normals. Every frame cullMeshlets() rejects the ones outside the view
+// frustum or facing entirely away from the camera, four at a time, and visibleRanges() merges the survivors
+// into the index ranges that are drawn. Since the cut follows the vertex cache order (optimizeVertexCache),
+// the runs are spatially compact.
+//
+// the cone test culls like glCullFace(GL_BACK) would, so it assumes meshes are seen from the front
+// (counter-clockwise) side only.
+
+const unsigned int MESHLET_MAX_VERTICES = 64;
+const unsigned int MESHLET_MAX_TRIANGLES = 124;
+
+struct Meshlet {
+    glm::vec3 center;
+    float radius;
+    glm::vec3 coneAxis;
+    float coneCutoff;       // 1 when the normals spread too far to ever cull it
+    uint32_t firstIndex;    // into the mesh's full index list
+    uint32_t indexCount;
+};
+
+// cuts a triangle list into meshlets; positions(v) gives the position of vertex v
+template <typename Position>
+std::vector<Meshlet> buildMeshlets(const std::vector<unsigned int> &indices, unsigned int vertexCount, Position positions)
+{
+    std::vector<Meshlet> meshlets;
+    // the meshlet a vertex was last counted in, + 1
+    std::vector<unsigned int> seen(vertexCount, 0);
+    size_t triangleCount = indices.size() / 3;
+    size_t first = 0;
+    while (first < triangleCount)
+    {
+        unsigned int id = (unsigned int)meshlets.size() + 1, vertices = 0;
+        size_t end = first;
+        for (; end < triangleCount && end - first < MESHLET_MAX_TRIANGLES; ++end)
+        {
+            unsigned int added = 0;
+            for (int k = 0; k < 3; ++k)
+                added += seen[indices[end * 3 + k]] != id;
+            if (vertices + added > MESHLET_MAX_VERTICES)
+                break;
+            for (int k = 0; k < 3; ++k)
+                if (seen[indices[end * 3 + k]] != id)
+                {
+                    seen[indices[end * 3 + k]] = id;
+                    ++vertices;
+                }
+        }
+
+        Meshlet meshlet;
+        meshlet.firstIndex = (uint32_t)(first * 3);
+        meshlet.indexCount = (uint32_t)((end - first) * 3);
+        // sphere around the box of the vertices
+        glm::vec3 lo(positions(indices[first * 3])), hi = lo;
+        for (size_t i = first * 3; i < end * 3; ++i)
+        {
+            lo = glm::min(lo, positions(indices[i]));
+            hi = glm::max(hi, positions(indices[i]));
+        }
+        meshlet.center = (lo + hi) * 0.5f;
+        meshlet.radius = 0.0f;
+        for (size_t i = first * 3; i < end * 3; ++i)
+            meshlet.radius = std::max(meshlet.radius, glm::length(positions(indices[i]) - meshlet.center));
+        // cone: the mean of the unit face normals, as wide as the normal furthest from it
+        std::vector<glm::vec3> normals;
+        glm::vec3 sum(0.0f);
+        for (size_t t = first; t < end; ++t)
+        {
+            glm::vec3 p0 = positions(indices[t * 3]), p1 = positions(indices[t * 3 + 1]), p2 = positions(indices[t * 3 + 2]);
+            glm::vec3 n = glm::cross(p1 - p0, p2 - p0);
+            float length = glm::length(n);
+            if (length <= 0.0f)
+                continue;
+            normals.push_back(n / length);
+            sum += normals.back();
+        }
+        float sumLength = glm::length(sum);
+        meshlet.coneAxis = sumLength > 0.0f ? sum / sumLength : glm::vec3(0.0f, 0.0f, 1.0f);
+        float minDot = sumLength > 0.0f ? 1.0f : -1.0f;
+        for (size_t n = 0; n < normals.size(); ++n)
+            minDot = std::min(minDot, glm::dot(normals[n], meshlet.coneAxis));
+        // a cone past about 84 degrees is hardly ever behind the camera as a whole
+        meshlet.coneCutoff = minDot <= 0.1f ? 1.0f : std::sqrt(1.0f - minDot * minDot);
+        meshlets.push_back(meshlet);
+        first = end;
+    }
+    return meshlets;
+}
+
+// the meshlets' bounds as arrays, for culling four at a time; padded to a multiple of four
+struct MeshletBounds {
+    std::vector<float> centerX, centerY, centerZ, radius;
+    std::vector<float> axisX, axisY, axisZ, cutoff;
+
+    size_t count = 0;
+
+    void build(const std::vector<Meshlet> &meshlets)
+    {
+        count = meshlets.size();
+        size_t padded = (count + 3) & ~(size_t)3;
+        std::vector<float> *arrays[8] = { &centerX, &centerY, &centerZ, &radius, &axisX, &axisY, &axisZ, &cutoff };
+        for (int a = 0; a < 8; ++a)
+            arrays[a]->assign(padded, 0.0f);
+        for (size_t m = 0; m < count; ++m)
+        {
+            centerX[m] = meshlets[m].center.x;
+            centerY[m] = meshlets[m].center.y;
+            centerZ[m] = meshlets[m].center.z;
+            radius[m] = meshlets[m].radius;
+            axisX[m] = meshlets[m].coneAxis.x;
+            axisY[m] = meshlets[m].coneAxis.y;
+            axisZ[m] = meshlets[m].coneAxis.z;
+            cutoff[m] = meshlets[m].coneCutoff;
+        }
+    }
+};
+
+// what meshlets are culled against, in the mesh's own space
+struct CullView {
+    glm::vec4 planes[6]; // inside where dot(plane.xyz, p) + plane.w >= 0, normalized
+    glm::vec3 eye;
+
+    // from the model-view-projection matrix of the draw (Gribb and Hartmann) and the camera position in the
+    // mesh's space; the model matrix may rotate, translate and scale uniformly
+    CullView(const glm::mat4 &modelViewProjection, const glm::vec3 &modelSpaceEye) : eye(modelSpaceEye)
+    {
+        glm::mat4 m = glm::transpose(modelViewProjection);
+        for (int i = 0; i < 3; ++i)
+        {
+            planes[i * 2] = m[3] + m[i];
+            planes[i * 2 + 1] = m[3] - m[i];
+        }
+        for (int p = 0; p < 6; ++p)
+            planes[p] /= glm::length(glm::vec3(planes[p]));
+    }
+
+    bool sphereVisible(const glm::vec3 &center, float radius) const
+    {
+        for (int p = 0; p < 6; ++p)
+            if (glm::dot(glm::vec3(planes[p]), center) + planes[p].w < -radius)
+                return false;
+        return true;
+    }
+};
+
+// visible[m] = whether meshlet m survives (0 or 1); visible is sized to bounds.count
+inline void cullMeshlets(const MeshletBounds &bounds, const CullView &view, std::vector<unsigned char> &visible)
+{
+    visible.resize(bounds.centerX.size());
+    size_t m = 0;
+#ifdef SIMD_SSE2
+    for (; m < bounds.centerX.size(); m += 4)
+    {
+        __m128 cx = _mm_loadu_ps(&bounds.centerX[m]), cy = _mm_loadu_ps(&bounds.centerY[m]), cz = _mm_loadu_ps(&bounds.centerZ[m]);
+        __m128 r = _mm_loadu_ps(&bounds.radius[m]);
+        __m128 negR = _mm_sub_ps(_mm_setzero_ps(), r);
+        // outside a plane: dot(plane, center) < -radius
+        __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (int p = 0; p < 6; ++p)
+        {
+            const glm::vec4 &plane = view.planes[p];
+            __m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(cx, _mm_set1_ps(plane.x)), _mm_mul_ps(cy, _mm_set1_ps(plane.y))),
+                                  _mm_add_ps(_mm_mul_ps(cz, _mm_set1_ps(plane.z)), _mm_set1_ps(plane.w)));
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(d, negR));
+        }
+        // facing away: dot(center - eye, axis) >= cutoff * |center - eye| + radius
+        __m128 vx = _mm_sub_ps(cx, _mm_set1_ps(view.eye.x)), vy = _mm_sub_ps(cy, _mm_set1_ps(view.eye.y)), vz = _mm_sub_ps(cz, _mm_set1_ps(view.eye.z));
+        __m128 along = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, _mm_loadu_ps(&bounds.axisX[m])), _mm_mul_ps(vy, _mm_loadu_ps(&bounds.axisY[m]))),
+                                  _mm_mul_ps(vz, _mm_loadu_ps(&bounds.axisZ[m])));
+        __m128 distance = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz)));
+        __m128 away = _mm_cmpge_ps(along, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&bounds.cutoff[m]), distance), r));
+        int mask = _mm_movemask_ps(_mm_andnot_ps(away, inside));
+        for (int k = 0; k < 4; ++k)
+            visible[m + k] = (mask >> k) & 1;
+    }
+#endif
+    for (; m < bounds.centerX.size(); ++m)
+    {
+        glm::vec3 center(bounds.centerX[m], bounds.centerY[m], bounds.centerZ[m]);
+        glm::vec3 axis(bounds.axisX[m], bounds.axisY[m], bounds.axisZ[m]);
+        glm::vec3 toCenter = center - view.eye;
+        bool away = glm::dot(toCenter, axis) >= bounds.cutoff[m] * glm::length(toCenter) + bounds.radius[m];
+        visible[m] = view.sphereVisible(center, bounds.radius[m]) && !away;
+    }
+    visible.resize(bounds.count);
+}
+
+// an index range of a mesh, in indices
+struct IndexRange {
+    uint32_t first, count;
+};
+
+// the index ranges of the visible meshlets, neighbours merged
+inline void visibleRanges(const std::vector<Meshlet> &meshlets, const std::vector<unsigned char> &visible, std::vector<IndexRange> &ranges)
+{
+    ranges.clear();
+    for (size_t m = 0; m < meshlets.size(); ++m)
+    {
+        if (!visible[m])
+            continue;
+        if (!ranges.empty() && ranges.back().first + ranges.back().count == meshlets[m].firstIndex)
+            ranges.back().count += meshlets[m].indexCount;
+        else
+            ranges.push_back({ meshlets[m].firstIndex, meshlets[m].indexCount });
+    }
+}
+#endif
@@ -0,0 +1,246 @@
+#ifndef MIP_CHAIN_H
+#define MIP_CHAIN_H
+
+#include <learnopengl/parallel.h>
+#include <learnopengl/simd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// mip chains built on the CPU instead of with glGenerateMipmap, which averages whatever is stored: gamma-encoded
+// color comes out too dark, and averaged normals too short. Here every level is reduced from the one above it
+// in float, in linear light for color and as vectors (renormalized when stored) for normals, with a separable
+// 2:1 kernel: a box or a Kaiser-windowed sinc, which keeps more detail with less aliasing. Texels wrap around
+// the edges, like the GL_REPEAT the textures are sampled with.
+
+// what a texture's texels hold, which decides how its mips are filtered
+enum TextureContent {
+    TEXTURE_CONTENT_DATA,   // filtered as stored: metallic, roughness, ao, height
+    TEXTURE_CONTENT_COLOR,  // sRGB-encoded color (the alpha stays linear)
+    TEXTURE_CONTENT_NORMAL  // tangent-space normals in rgb
+};
+
+enum MipFilter {
+    MIP_FILTER_BOX,
+    MIP_FILTER_KAISER
+};
+
+// kernel of every mip chain; part of the mip cache key
+const MipFilter MIP_FILTER = MIP_FILTER_KAISER;
+// half width of the Kaiser window, in texels of the smaller level, and its alpha (higher: smoother, blurrier)
+const float MIP_KAISER_WIDTH = 3.0f;
+const float MIP_KAISER_ALPHA = 4.0f;
+
+// levels of a full chain down to 1x1
+inline int mipChainLength(int width, int height)
+{
+    int levels = 1;
+    while ((width | height) >> levels)
+        ++levels;
+    return levels;
+}
+
+inline float srgbToLinear(float c)
+{
+    return c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+}
+
+inline float linearToSrgb(float c)
+{
+    return c <= 0.0031308f ? c * 12.92f : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f;
+}
+
+// a 2:1 reduction along one axis: texel x of the smaller level is the sum of weights[t] * texel 2x + first + t
+struct MipKernel {
+    int first = 0;
+    std::vector<float> weights;
+
+    // keeps a length-1 axis as it is
+    static MipKernel identity()
+    {
+        MipKernel kernel;
+        kernel.weights.push_back(1.0f);
+        return kernel;
+    }
+
+    static MipKernel make(MipFilter filter)
+    {
+        MipKernel kernel;
+        if (filter == MIP_FILTER_BOX)
+        {
+            kernel.weights.assign(2, 0.5f);
+            return kernel;
+        }
+        // the smaller texel's center is between source texels 2x and 2x + 1; d is the distance to it in
+        // smaller texels
+        const float pi = 3.14159265358979f;
+        int reach = (int)std::ceil(MIP_KAISER_WIDTH * 2.0f - 0.5f);
+        kernel.first = 1 - reach;
+        float sum = 0.0f;
+        for (int o = kernel.first; o <= reach; ++o)
+        {
+            float d = (o - 0.5f) * 0.5f;
+            float ratio = d / MIP_KAISER_WIDTH;
+            float window = ratio * ratio < 1.0f ? besselI0(MIP_KAISER_ALPHA * std::sqrt(1.0f - ratio * ratio)) / besselI0(MIP_KAISER_ALPHA) : 0.0f;
+            float sinc = std::sin(pi * d) / (pi * d);
+            kernel.weights.push_back(sinc * window);
+            sum += kernel.weights.back();
+        }
+        for (size_t t = 0; t < kernel.weights.size(); ++t)
+            kernel.weights[t] /= sum;
+        return kernel;
+    }
+
+private:
+    // modified Bessel function of the first kind, order 0 (power series)
+    static float besselI0(float x)
+    {
+        float sum = 1.0f, term = 1.0f;
+        for (int k = 1; k < 32 && term > sum * 1e-7f; ++k)
+        {
+            term *= (x * x * 0.25f) / (float)(k * k);
+            sum += term;
+        }
+        return sum;
+    }
+};
+
+// dst[x] = sum of weights[t] * src[2x + first + t] for x in [0, count); src indexable from first to
+// 2 * count + first + weights.size() + 6 (the reads of the last group of four)
+inline void reduceRow(const float *src, const MipKernel &kernel, float *dst, int count)
+{
+    int x = 0;
+#ifdef SIMD_SSE2
+    for (; x + 4 <= count; x += 4)
+    {
+        __m128 sum = _mm_setzero_ps();
+        for (size_t t = 0; t < kernel.weights.size(); ++t)
+        {
+            const float *at = src + 2 * x + kernel.first + (int)t;
+            // every other texel of eight: 2x, 2x + 2, 2x + 4, 2x + 6
+            __m128 even = _mm_shuffle_ps(_mm_loadu_ps(at), _mm_loadu_ps(at + 4), _MM_SHUFFLE(2, 0, 2, 0));
+            sum = _mm_add_ps(sum, _mm_mul_ps(even, _mm_set1_ps(kernel.weights[t])));
+        }
+        _mm_storeu_ps(dst + x, sum);
+    }
+#endif
+    for (; x < count; ++x)
+    {
+        float sum = 0.0f;
+        for (size_t t = 0; t < kernel.weights.size(); ++t)
+            sum += kernel.weights[t] * src[2 * x + kernel.first + (int)t];
+        dst[x] = sum;
+    }
+}
+
+// dst[i] += weight * src[i]
+inline void accumulateRow(const float *src, float weight, float *dst, int count)
+{
+    int i = 0;
+#ifdef SIMD_SSE2
+    __m128 w = _mm_set1_ps(weight);
+    for (; i + 4 <= count; i += 4)
+        _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(_mm_loadu_ps(src + i), w)));
+#endif
+    for (; i < count; ++i)
+        dst[i] += weight * src[i];
+}
+
+// one channel's texels of a level, in float
+typedef std::vector<float> MipPlane;
+
+// the next smaller level of a channel: each of its rows the vertical kernel over the source rows, then the
+// horizontal one over that (rows in parallel on large levels, unless the caller already runs on a worker: the
+// texture decodes of the asset pipeline and Model::decodeTextures)
+inline MipPlane reducePlane(const MipPlane &plane, int width, int height, MipFilter filter)
+{
+    int smallWidth = std::max(1, width / 2), smallHeight = std::max(1, height / 2);
+    MipKernel horizontal = width > 1 ? MipKernel::make(filter) : MipKernel::identity();
+    MipKernel vertical = height > 1 ? MipKernel::make(filter) : MipKernel::identity();
+    int pad = -horizontal.first;
+    int paddedWidth = pad + 2 * smallWidth + (int)horizontal.weights.size() + 8;
+    MipPlane small((size_t)smallWidth * smallHeight);
+    auto reduceRows = [&](int firstRow, int endRow)
+    {
+        std::vector<float> column(width), padded(paddedWidth);
+        for (int y = firstRow; y < endRow; ++y)
+        {
+            std::fill(column.begin(), column.end(), 0.0f);
+            for (size_t t = 0; t < vertical.weights.size(); ++t)
+            {
+                int row = ((2 * y + vertical.first + (int)t) % height + height) % height;
+                accumulateRow(&plane[(size_t)row * width], vertical.weights[t], column.data(), width);
+            }
+            for (int i = 0; i < paddedWidth; ++i)
+                padded[i] = column[((i - pad) % width + width) % width];
+            reduceRow(padded.data() + pad, horizontal, &small[(size_t)y * smallWidth], smallWidth);
+        }
+    };
+    const int rowsPerTask = 16;
+    if ((size_t)smallWidth * smallHeight < 128 * 128 || onWorkerThread())
+        reduceRows(0, smallHeight);
+    else
+        parallelFor((unsigned int)((smallHeight + rowsPerTask - 1) / rowsPerTask), [&](unsigned int task)
+        {
+            reduceRows((int)task * rowsPerTask, std::min(smallHeight, ((int)task + 1) * rowsPerTask));
+        });
+    return small;
+}
+
+// the full mip chain of 8-bit texels (components per texel, rows tightly packed), level 0 first and each level
+// right after the one before, down to 1x1
+inline std::vector<unsigned char> buildMipChain(const unsigned char *pixels, int width, int height, int components,
+                                                TextureContent content, MipFilter filter = MIP_FILTER)
+{
+    size_t texels = (size_t)width * height;
+    std::vector<unsigned char> chain(pixels, pixels + texels * components);
+    int gammaChannels = content == TEXTURE_CONTENT_COLOR ? (components >= 3 ? 3 : 1) : 0;
+    bool normals = content == TEXTURE_CONTENT_NORMAL && components >= 3;
+
+    float toLinear[256];
+    for (int v = 0; v < 256; ++v)
+        toLinear[v] = srgbToLinear(v / 255.0f);
+    std::vector<MipPlane> planes(components, MipPlane(texels));
+    for (int c = 0; c < components; ++c)
+        for (size_t i = 0; i < texels; ++i)
+        {
+            unsigned char v = pixels[i * components + c];
+            planes[c][i] = c < gammaChannels ? toLinear[v] : (normals && c < 3 ? v / 127.5f - 1.0f : v / 255.0f);
+        }
+
+    int levels = mipChainLength(width, height);
+    for (int level = 1; level < levels; ++level)
+    {
+        for (int c = 0; c < components; ++c)
+            planes[c] = reducePlane(planes[c], width, height, filter);
+        width = std::max(1, width / 2);
+        height = std::max(1, height / 2);
+        texels = (size_t)width * height;
+
+        // stored as the level 0 texels were; the float planes go on to the next level as they are
+        size_t at = chain.size();
+        chain.resize(at + texels * components);
+        for (size_t i = 0; i < texels; ++i)
+        {
+            float value[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            for (int c = 0; c < components; ++c)
+                value[c] = planes[c][i];
+            if (normals)
+            {
+                float length = std::sqrt(value[0] * value[0] + value[1] * value[1] + value[2] * value[2]);
+                for (int c = 0; c < 3; ++c)
+                    value[c] = length > 0.0f ? (value[c] / length) * 0.5f + 0.5f : (c == 2 ? 1.0f : 0.5f);
+            }
+            for (int c = 0; c < components; ++c)
+            {
+                float v = std::min(std::max(value[c], 0.0f), 1.0f);
+                if (c < gammaChannels)
+                    v = linearToSrgb(v);
+                chain[at + i * components + c] = (unsigned char)(v * 255.0f + 0.5f);
+            }
+        }
+    }
+    return chain;
+}
+#endif
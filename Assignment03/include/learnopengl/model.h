@@ -7,143 +7,516 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <stb_image.h>
 #include <assimp/Importer.hpp>
+#include <assimp/DefaultIOSystem.h>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
 
 #include <learnopengl/mesh.h>
 #include <learnopengl/shader.h>
+#include <learnopengl/asset_pipeline.h>
+#include <learnopengl/geometry_arena.h>
+#include <learnopengl/mesh_cache.h>
+#include <learnopengl/mesh_optimize.h>
+#include <learnopengl/mesh_simplify.h>
+#include <learnopengl/parallel.h>
+#include <learnopengl/texture_cache.h>
+#include <learnopengl/texture_streamer.h>
 
+#include <algorithm>
+#include <cstring>
 #include <string>
 #include <fstream>
 #include <sstream>
 #include <iostream>
 #include <map>
+#include <unordered_map>
 #include <vector>
 using namespace std;
 
+// post-processing of every import; part of the mesh cache key
+const unsigned int MODEL_IMPORT_FLAGS = aiProcess_Triangulate | aiProcess_GenSmoothNormals | aiProcess_FlipUVs | aiProcess_CalcTangentSpace;
+// weld, cache-order and fetch-order the triangles of every imported mesh (mesh_optimize.h)
+const bool MODEL_OPTIMIZE_MESHES = true;
+// build simplified LODs of every imported mesh (mesh_simplify.h), which Draw() picks from by projected size
+const bool MODEL_BUILD_LODS = true;
+// cut every imported mesh into meshlets (meshlet.h), which Draw() culls against the view when given one
+const bool MODEL_BUILD_MESHLETS = true;
+// vertex layout of the uploaded meshes (vertex_format.h): Vertex, PackedVertex or PackedTangentVertex
+typedef PackedVertex ModelVertex;
+typedef BasicMesh<ModelVertex> ModelMesh;
+typedef GeometryArena<ModelVertex> ModelArena;
+
 unsigned int TextureFromFile(const char *path, const string &directory, bool gamma = false);
 
+// Assimp's file system, noting every file an import opens besides the model (an .mtl, say) for the mesh cache
+class RecordingIOSystem : public Assimp::DefaultIOSystem
+{
+public:
+    explicit RecordingIOSystem(const string &modelPath) : model(modelPath) {}
+
+    vector<string> opened;
+
+    Assimp::IOStream *Open(const char *file, const char *mode = "rb") override
+    {
+        // files that don't open count too: once there, they'd change the import
+        if (!ComparePaths(file, model.c_str()) && std::find(opened.begin(), opened.end(), file) == opened.end())
+            opened.push_back(file);
+        return Assimp::DefaultIOSystem::Open(file, mode);
+    }
+
+private:
+    string model;
+};
+
 class Model 
 {
 public:
     // model data 
     vector<Texture> textures_loaded;	// stores all the textures loaded so far, optimization to make sure textures aren't loaded more than once.
-    vector<Mesh>    meshes;
+    vector<ModelMesh> meshes;
+    std::shared_ptr<ModelArena> arena; // where the meshes' geometry lives, see uploadGeometry()
     string directory;
     bool gammaCorrection;
 
     // constructor, expects a filepath to a 3D model.
-    Model(string const &path, bool gamma = false) : gammaCorrection(gamma)
+    // with deferUpload the import and the texture decoding make no GL calls, so the model can be constructed
+    // on a loader thread; Upload() then creates its buffers and textures on the GL thread.
+    Model(string const &path, bool gamma = false, bool deferUpload = false) : gammaCorrection(gamma), deferred(deferUpload)
     {
         loadModel(path);
     }
 
-    // draws the model, and thus all its meshes
-    void Draw(Shader &shader)
+    // with a scene arena the model's geometry goes into it, next to that of other models sharing it; with a
+    // streamer the textures stream in through it over the next frames
+    void Upload(std::shared_ptr<ModelArena> sceneArena = nullptr, TextureStreamer *streamer = nullptr)
     {
+        for(unsigned int j = 0; j < textures_loaded.size(); j++)
+        {
+            const TextureHandle &handle = textureHandles[textures_loaded[j].path];
+            textures_loaded[j].id = streamer ? streamer->upload(handle) : textureCache().upload(handle);
+        }
+        // the meshes hold copies of their textures, which still have no names
         for(unsigned int i = 0; i < meshes.size(); i++)
-            meshes[i].Draw(shader);
+            for(unsigned int t = 0; t < meshes[i].textures.size(); t++)
+                meshes[i].textures[t].id = textureHandles[meshes[i].textures[t].path]->id;
+        uploadGeometry(sceneArena);
+        deferred = false;
+    }
+
+    // draws the model, and thus all its meshes: the ones in the arena with one multi-draw per material batch
+    void Draw(Shader &shader)
+    {
+        draw(shader, nullptr, nullptr, nullptr);
+    }
+
+    // draws the model with the given model matrix (as set on the shader), each mesh at the LOD its projected
+    // size calls for
+    void Draw(Shader &shader, const glm::mat4 &model, const LodView &view)
+    {
+        draw(shader, &model, &view, nullptr);
+    }
+
+    // as above, and culls the meshes and the meshlets of their full LODs against the view frustum and by
+    // facing; viewProjection is the camera's, view.eye its position
+    void Draw(Shader &shader, const glm::mat4 &model, const LodView &view, const glm::mat4 &viewProjection)
+    {
+        draw(shader, &model, &view, &viewProjection);
     }
     
 private:
+    // meshes sharing the same textures, drawn with one multi-draw
+    struct MaterialBatch {
+        vector<unsigned int> meshes;
+        SamplerBinding samplers;
+        unsigned int firstCommand = 0, commandCount = 0; // this frame's
+    };
+
+    bool deferred;
+    unordered_map<string, TextureHandle> textureHandles; // of textures_loaded, by path; the model's hold on them
+    std::shared_ptr<MeshCache<ModelVertex>> meshCache; // mapped geometry of the meshes until they're uploaded
+    vector<bool> inArena;           // per mesh; the others (32-bit indices) keep their own buffers
+    vector<ArenaMesh> arenaMeshes;  // per mesh, where it is in the arena
+    vector<MaterialBatch> batches;
+    VertexFormatUniforms formatUniforms; // of the arena draws
+    vector<vector<float>> lodErrors; // per mesh, per LOD
+    vector<unsigned int> drawLods;   // per mesh, this draw's
+    vector<MeshletBounds> meshletBounds; // per mesh
+    vector<unsigned char> drawMeshes;   // per mesh, whether this draw has it at all
+    vector<vector<IndexRange>> drawRanges; // per mesh, this draw's visible meshlets
+    vector<unsigned char> meshletVisible;
+
+    // without a view every mesh is drawn in full, without a view-projection nothing is culled
+    void draw(Shader &shader, const glm::mat4 *model, const LodView *view, const glm::mat4 *viewProjection)
+    {
+        drawLods.assign(meshes.size(), 0);
+        drawMeshes.assign(meshes.size(), 1);
+        drawRanges.resize(meshes.size());
+        if (model && view)
+        {
+            float scale = std::max(glm::length(glm::vec3((*model)[0])), std::max(glm::length(glm::vec3((*model)[1])), glm::length(glm::vec3((*model)[2]))));
+            for(unsigned int i = 0; i < meshes.size(); i++)
+            {
+                glm::vec3 center = glm::vec3(*model * glm::vec4(meshes[i].sphereCenter, 1.0f));
+                drawLods[i] = selectLod(lodErrors[i].data(), (unsigned int)lodErrors[i].size(), center, meshes[i].sphereRadius * scale, scale, *view);
+            }
+        }
+        if (model && view && viewProjection)
+        {
+            // culled in the model's space, where the bounds are
+            CullView cull(*viewProjection * *model, glm::vec3(glm::inverse(*model) * glm::vec4(view->eye, 1.0f)));
+            for(unsigned int i = 0; i < meshes.size(); i++)
+            {
+                drawRanges[i].clear();
+                drawMeshes[i] = cull.sphereVisible(meshes[i].sphereCenter, meshes[i].sphereRadius);
+                // the coarser LODs are small enough on screen to draw whole
+                if (drawMeshes[i] && drawLods[i] == 0 && !meshes[i].meshlets.empty())
+                {
+                    cullMeshlets(meshletBounds[i], cull, meshletVisible);
+                    visibleRanges(meshes[i].meshlets, meshletVisible, drawRanges[i]);
+                    drawMeshes[i] = !drawRanges[i].empty() ? 2 : 0;
+                }
+            }
+        }
+        if (!batches.empty())
+        {
+            // this frame's commands
+            arena->beginFrame();
+            for(unsigned int b = 0; b < batches.size(); b++)
+            {
+                batches[b].firstCommand = arena->commandCount();
+                for(unsigned int i = 0; i < batches[b].meshes.size(); i++)
+                {
+                    unsigned int m = batches[b].meshes[i];
+                    if (drawMeshes[m] == 2)
+                        for(unsigned int r = 0; r < drawRanges[m].size(); r++)
+                            arena->addDraw(arenaMeshes[m], 0, drawRanges[m][r].first, drawRanges[m][r].count);
+                    else if (drawMeshes[m])
+                        arena->addDraw(arenaMeshes[m], drawLods[m]);
+                }
+                batches[b].commandCount = arena->commandCount() - batches[b].firstCommand;
+            }
+            arena->upload();
+
+            formatUniforms.set(shader, VertexFormat<ModelVertex>::quantizedPosition, VertexFormat<ModelVertex>::normalEncoding);
+            arena->bind();
+            for(unsigned int b = 0; b < batches.size(); b++)
+            {
+                batches[b].samplers.bind(shader, meshes[batches[b].meshes[0]].textures);
+                arena->draw(batches[b].firstCommand, batches[b].commandCount);
+            }
+            glBindVertexArray(0);
+            glActiveTexture(GL_TEXTURE0);
+            formatUniforms.reset(shader);
+        }
+        for(unsigned int i = 0; i < meshes.size(); i++)
+            if (!inArena[i] && drawMeshes[i])
+                meshes[i].Draw(shader, drawLods[i], drawMeshes[i] == 2 ? &drawRanges[i] : nullptr);
+    }
+
     // loads a model with supported ASSIMP extensions from file and stores the resulting meshes in the meshes vector.
+    // the import result is kept in a mesh cache next to the file, which later loads map instead of importing.
     void loadModel(string const &path)
     {
+        // retrieve the directory path of the filepath
+        directory = path.substr(0, path.find_last_of('/'));
+
+        uint64_t cacheKey = meshCacheKey<ModelVertex>(path, MODEL_IMPORT_FLAGS, MODEL_OPTIMIZE_MESHES, MODEL_BUILD_LODS, MODEL_BUILD_MESHLETS);
+        if (loadMeshCache(meshCachePath(path), cacheKey))
+        {
+            if (deferred)
+                decodeTextures();
+            else
+                uploadGeometry(nullptr);
+            return;
+        }
+
         // read file via ASSIMP
         Assimp::Importer importer;
-        const aiScene* scene = importer.ReadFile(path, aiProcess_Triangulate | aiProcess_GenSmoothNormals | aiProcess_FlipUVs | aiProcess_CalcTangentSpace);
+        RecordingIOSystem *io = new RecordingIOSystem(path); // the importer owns it
+        importer.SetIOHandler(io);
+        const aiScene* scene = importer.ReadFile(path, MODEL_IMPORT_FLAGS);
         // check for errors
         if(!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) // if is Not Zero
         {
             cout << "ERROR::ASSIMP:: " << importer.GetErrorString() << endl;
             return;
         }
-        // retrieve the directory path of the filepath
-        directory = path.substr(0, path.find_last_of('/'));
 
         // process ASSIMP's root node recursively
-        processNode(scene->mRootNode, scene);
+        processMeshes(scene->mRootNode, scene, path);
+
+        if (!writeMeshCache(meshCachePath(path), cacheKey, meshes, io->opened))
+            cout << "Mesh cache: couldn't write " << meshCachePath(path) << endl;
+        if (deferred)
+            decodeTextures();
+        else
+            uploadGeometry(nullptr);
+    }
+
+    // decodes the textures the materials named, all at once in parallel (deferred loads only; otherwise each
+    // is decoded as it's uploaded)
+    void decodeTextures()
+    {
+        vector<TextureHandle> handles;
+        for(unsigned int j = 0; j < textures_loaded.size(); j++)
+            handles.push_back(textureHandles[textures_loaded[j].path]);
+        parallelFor((unsigned int)handles.size(), [&](unsigned int j) { textureCache().decode(handles[j]); });
     }
 
-    // processes a node in a recursive fashion. Processes each individual mesh located at the node and repeats this process on its children nodes (if any).
-    void processNode(aiNode *node, const aiScene *scene)
+    // copies the meshes into the arena (a new one unless sceneArena is given) and groups them into material
+    // batches; meshes that don't fit it create their own buffers (GL thread only)
+    void uploadGeometry(std::shared_ptr<ModelArena> sceneArena)
     {
-        // process each mesh located at the current node
+        arena = sceneArena ? sceneArena : std::make_shared<ModelArena>();
+        size_t vertexTotal = 0, indexTotal = 0;
+        inArena.assign(meshes.size(), false);
+        lodErrors.resize(meshes.size());
+        meshletBounds.resize(meshes.size());
+        for(unsigned int i = 0; i < meshes.size(); i++)
+        {
+            lodErrors[i] = meshes[i].lodErrors();
+            meshletBounds[i].build(meshes[i].meshlets);
+            // all the LODs or none
+            bool fits = ModelArena::fits(meshes[i].packedIndices);
+            for(unsigned int l = 0; l < meshes[i].lods.size(); l++)
+                fits = fits && ModelArena::fits(meshes[i].lods[l].indices);
+            if (!fits)
+                continue;
+            inArena[i] = true;
+            vertexTotal += meshes[i].vertexCount();
+            indexTotal += meshes[i].packedIndices.count();
+            for(unsigned int l = 0; l < meshes[i].lods.size(); l++)
+                indexTotal += meshes[i].lods[l].indices.count();
+        }
+        arena->reserve(vertexTotal, indexTotal);
+
+        arenaMeshes.assign(meshes.size(), ArenaMesh());
+        for(unsigned int i = 0; i < meshes.size(); i++)
+        {
+            if (!inArena[i])
+            {
+                meshes[i].Upload();
+                continue;
+            }
+            ModelMesh &mesh = meshes[i];
+            arenaMeshes[i] = arena->add(mesh.vertexData(), mesh.vertexCount(), mesh.packedIndices, mesh.bounds);
+            for(unsigned int l = 0; l < mesh.lods.size(); l++)
+                arena->addLod(arenaMeshes[i], mesh.lods[l].indices);
+            mesh.releaseGeometry();
+
+            // the batch with the same textures, in the same order
+            unsigned int b = 0;
+            for(; b < batches.size(); b++)
+            {
+                const vector<Texture> &other = meshes[batches[b].meshes[0]].textures;
+                bool same = other.size() == mesh.textures.size();
+                for(unsigned int t = 0; same && t < other.size(); t++)
+                    same = other[t].id == mesh.textures[t].id && other[t].type == mesh.textures[t].type;
+                if (same)
+                    break;
+            }
+            if (b == batches.size())
+                batches.push_back(MaterialBatch());
+            batches[b].meshes.push_back(i);
+        }
+        // the meshes of a cached model upload straight from the mapped file, which can go now
+        meshCache.reset();
+    }
+
+    // builds the meshes from a cache written by an earlier import; false if there's no valid one
+    bool loadMeshCache(const string &cachePath, uint64_t key)
+    {
+        std::shared_ptr<MeshCache<ModelVertex>> cache = std::make_shared<MeshCache<ModelVertex>>(cachePath, key);
+        if (!cache->valid())
+            return false;
+        for (unsigned int i = 0; i < cache->entries.size(); i++)
+        {
+            const MeshCacheEntry &entry = cache->entries[i];
+            vector<Texture> textures;
+            for (unsigned int t = entry.firstTexture; t < entry.firstTexture + entry.textureCount; t++)
+                textures.push_back(loadTexture(cache->textures[t].path, cache->textures[t].type));
+            meshes.push_back(ModelMesh(cache->vertices + entry.firstVertex, entry.vertexCount, cache->indices(entry), textures, false,
+                                       MeshCache<ModelVertex>::bounds(entry)));
+            meshes.back().lods = cache->meshLods(entry);
+            meshes.back().sphereCenter = MeshCache<ModelVertex>::sphereCenter(entry);
+            meshes.back().sphereRadius = entry.sphere[3];
+            meshes.back().meshlets = cache->meshMeshlets(entry);
+        }
+        meshCache = cache;
+        return true;
+    }
+
+    // processes a node in a recursive fashion. Gathers each individual mesh located at the node and repeats this process on its children nodes (if any).
+    void processNode(aiNode *node, const aiScene *scene, vector<aiMesh *> &found)
+    {
+        // gather each mesh located at the current node
         for(unsigned int i = 0; i < node->mNumMeshes; i++)
         {
             // the node object only contains indices to index the actual objects in the scene. 
             // the scene contains all the data, node is just to keep stuff organized (like relations between nodes).
-            aiMesh* mesh = scene->mMeshes[node->mMeshes[i]];
-            meshes.push_back(processMesh(mesh, scene));
+            found.push_back(scene->mMeshes[node->mMeshes[i]]);
         }
-        // after we've processed all of the meshes (if any) we then recursively process each of the children nodes
+        // after we've gathered all of the meshes (if any) we then recursively process each of the children nodes
         for(unsigned int i = 0; i < node->mNumChildren; i++)
         {
-            processNode(node->mChildren[i], scene);
+            processNode(node->mChildren[i], scene, found);
         }
 
     }
 
-    Mesh processMesh(aiMesh *mesh, const aiScene *scene)
+    // converts the meshes of the whole node tree. The vertices and indices of every mesh are converted (and
+    // optimized) in parallel; the textures are loaded before (textures_loaded is shared) and the meshes are
+    // created after, in node order, so their GL objects are made on this thread.
+    void processMeshes(aiNode *root, const aiScene *scene, const string &path)
     {
-        // data to fill
-        vector<Vertex> vertices;
-        vector<unsigned int> indices;
-        vector<Texture> textures;
+        vector<aiMesh *> found;
+        processNode(root, scene, found);
 
-        // walk through each of the mesh's vertices
-        for(unsigned int i = 0; i < mesh->mNumVertices; i++)
-        {
-            Vertex vertex;
-            glm::vec3 vector; // we declare a placeholder vector since assimp uses its own vector class that doesn't directly convert to glm's vec3 class so we transfer the data to this placeholder glm::vec3 first.
-            // positions
-            vector.x = mesh->mVertices[i].x;
-            vector.y = mesh->mVertices[i].y;
-            vector.z = mesh->mVertices[i].z;
-            vertex.Position = vector;
-            // normals
-            if (mesh->HasNormals())
+        vector<vector<Texture>> textures(found.size());
+        for(unsigned int i = 0; i < found.size(); i++)
+            textures[i] = processMaterial(scene->mMaterials[found[i]->mMaterialIndex]);
+
+        vector<vector<Vertex>> vertices(found.size());
+        vector<vector<unsigned int>> indices(found.size());
+        vector<MeshOptimizeReport> reports(found.size());
+        vector<vector<SimplifiedLod>> lods(found.size());
+        vector<BoundingSphere> spheres(found.size());
+        vector<vector<Meshlet>> meshlets(found.size());
+        parallelFor((unsigned int)found.size(), [&](unsigned int i)
+        {
+            processMesh(found[i], vertices[i], indices[i]);
+            // only pure triangle lists; points and lines stay as they are
+            if (MODEL_OPTIMIZE_MESHES && found[i]->mPrimitiveTypes == aiPrimitiveType_TRIANGLE)
+                reports[i] = optimizeMesh(vertices[i], indices[i]);
+            if (MODEL_BUILD_LODS && found[i]->mPrimitiveTypes == aiPrimitiveType_TRIANGLE)
+                lods[i] = buildLodChain(vertices[i], indices[i]);
+            spheres[i] = BoundingSphere::of(vertices[i]);
+            if (MODEL_BUILD_MESHLETS && found[i]->mPrimitiveTypes == aiPrimitiveType_TRIANGLE)
             {
-                vector.x = mesh->mNormals[i].x;
-                vector.y = mesh->mNormals[i].y;
-                vector.z = mesh->mNormals[i].z;
-                vertex.Normal = vector;
+                const vector<Vertex> &full = vertices[i];
+                meshlets[i] = buildMeshlets(indices[i], (unsigned int)full.size(), [&](unsigned int v) { return full[v].Position; });
             }
-            // texture coordinates
-            if(mesh->mTextureCoords[0]) // does the mesh contain texture coordinates?
+        });
+        if (MODEL_OPTIMIZE_MESHES)
+        {
+            MeshOptimizeReport total;
+            for(unsigned int i = 0; i < reports.size(); i++)
+                total.add(reports[i]);
+            if (total.triangles > 0)
+                cout << "Optimized " << path << ": " << total.verticesBefore << " -> " << total.verticesAfter << " vertices, ACMR "
+                     << (double)total.transformedBefore / total.triangles << " -> " << (double)total.transformedAfter / total.triangles << ", ATVR "
+                     << (double)total.transformedBefore / total.verticesBefore << " -> " << (double)total.transformedAfter / total.verticesAfter << endl;
+        }
+
+        // packed into the model's vertex layout last, from the optimized full vertices
+        vector<vector<ModelVertex>> packed(found.size());
+        vector<VertexBounds> bounds(found.size());
+        parallelFor((unsigned int)found.size(), [&](unsigned int i)
+        {
+            packed[i] = packVertices<ModelVertex>(vertices[i], bounds[i]);
+            vector<Vertex>().swap(vertices[i]);
+        });
+        size_t fullBytes = 0, packedBytes = 0;
+        for(unsigned int i = 0; i < found.size(); i++)
+        {
+            fullBytes += packed[i].size() * sizeof(Vertex);
+            packedBytes += packed[i].size() * sizeof(ModelVertex);
+        }
+        if (sizeof(ModelVertex) != sizeof(Vertex))
+            cout << "Packed " << path << " into " << sizeof(ModelVertex) << "-byte vertices: " << fullBytes / 1024 << " -> " << packedBytes / 1024 << " KB" << endl;
+
+        if (MODEL_BUILD_LODS)
+        {
+            // triangles of each level over all meshes; meshes with fewer LODs count their coarsest
+            vector<size_t> triangles(MESH_LOD_MAX_LEVELS, 0);
+            for(unsigned int i = 0; i < found.size(); i++)
+                for(unsigned int l = 0; l < MESH_LOD_MAX_LEVELS; l++)
+                    triangles[l] += (l == 0 || lods[i].empty() ? indices[i].size() : lods[i][std::min(l, (unsigned int)lods[i].size()) - 1].indices.size()) / 3;
+            cout << "LODs of " << path << ": triangles";
+            for(unsigned int l = 0; l < MESH_LOD_MAX_LEVELS; l++)
+                cout << (l ? " -> " : " ") << triangles[l];
+            cout << endl;
+        }
+
+        meshes.reserve(meshes.size() + found.size());
+        for(unsigned int i = 0; i < found.size(); i++)
+        {
+            unsigned int vertexCount = (unsigned int)packed[i].size();
+            meshes.push_back(ModelMesh(std::move(packed[i]), std::move(indices[i]), std::move(textures[i]), false, bounds[i]));
+            for(unsigned int l = 0; l < lods[i].size(); l++)
             {
-                glm::vec2 vec;
-                // a vertex can contain up to 8 different texture coordinates. We thus make the assumption that we won't 
-                // use models where a vertex can have multiple texture coordinates so we always take the first set (0).
-                vec.x = mesh->mTextureCoords[0][i].x; 
-                vec.y = mesh->mTextureCoords[0][i].y;
-                vertex.TexCoords = vec;
-                // tangent
-                vector.x = mesh->mTangents[i].x;
-                vector.y = mesh->mTangents[i].y;
-                vector.z = mesh->mTangents[i].z;
-                vertex.Tangent = vector;
-                // bitangent
-                vector.x = mesh->mBitangents[i].x;
-                vector.y = mesh->mBitangents[i].y;
-                vector.z = mesh->mBitangents[i].z;
-                vertex.Bitangent = vector;
+                MeshLod lod;
+                lod.indices = packIndices(lods[i][l].indices, vertexCount);
+                lod.error = lods[i][l].error;
+                meshes.back().lods.push_back(lod);
             }
-            else
-                vertex.TexCoords = glm::vec2(0.0f, 0.0f);
+            meshes.back().sphereCenter = spheres[i].center;
+            meshes.back().sphereRadius = spheres[i].radius;
+            meshes.back().meshlets = std::move(meshlets[i]);
+        }
+    }
 
-            vertices.push_back(vertex);
+    // the vertices and indices of one mesh; touches nothing but its arguments, so meshes convert concurrently.
+    void processMesh(const aiMesh *mesh, vector<Vertex> &vertices, vector<unsigned int> &indices)
+    {
+        // assimp's vectors are three floats like glm's, so the attributes are copied as they are
+        static_assert(sizeof(aiVector3D) == sizeof(glm::vec3), "aiVector3D has to be three floats");
+
+        // walk through each of the mesh's vertices
+        vertices.resize(mesh->mNumVertices);
+        Vertex *vertex = vertices.data();
+        unsigned int count = mesh->mNumVertices;
+        // positions
+        for(unsigned int i = 0; i < count; i++)
+            memcpy(&vertex[i].Position, &mesh->mVertices[i], sizeof(glm::vec3));
+        // normals
+        if (mesh->HasNormals())
+        {
+            for(unsigned int i = 0; i < count; i++)
+                memcpy(&vertex[i].Normal, &mesh->mNormals[i], sizeof(glm::vec3));
         }
+        // texture coordinates
+        if(mesh->mTextureCoords[0]) // does the mesh contain texture coordinates?
+        {
+            // a vertex can contain up to 8 different texture coordinates. We thus make the assumption that we won't 
+            // use models where a vertex can have multiple texture coordinates so we always take the first set (0).
+            for(unsigned int i = 0; i < count; i++)
+                memcpy(&vertex[i].TexCoords, &mesh->mTextureCoords[0][i], sizeof(glm::vec2));
+            // tangent and bitangent
+            if (mesh->HasTangentsAndBitangents())
+            {
+                for(unsigned int i = 0; i < count; i++)
+                {
+                    memcpy(&vertex[i].Tangent, &mesh->mTangents[i], sizeof(glm::vec3));
+                    memcpy(&vertex[i].Bitangent, &mesh->mBitangents[i], sizeof(glm::vec3));
+                }
+            }
+        }
+        else
+        {
+            for(unsigned int i = 0; i < count; i++)
+                vertex[i].TexCoords = glm::vec2(0.0f, 0.0f);
+        }
+
         // now wak through each of the mesh's faces (a face is a mesh its triangle) and retrieve the corresponding vertex indices.
+        size_t indexCount = 0;
+        for(unsigned int i = 0; i < mesh->mNumFaces; i++)
+            indexCount += mesh->mFaces[i].mNumIndices;
+        indices.resize(indexCount);
+        unsigned int *index = indices.data();
         for(unsigned int i = 0; i < mesh->mNumFaces; i++)
         {
-            aiFace face = mesh->mFaces[i];
+            const aiFace &face = mesh->mFaces[i];
             // retrieve all indices of the face and store them in the indices vector
-            for(unsigned int j = 0; j < face.mNumIndices; j++)
-                indices.push_back(face.mIndices[j]);        
+            memcpy(index, face.mIndices, face.mNumIndices * sizeof(unsigned int));
+            index += face.mNumIndices;
         }
-        // process materials
-        aiMaterial* material = scene->mMaterials[mesh->mMaterialIndex];    
+    }
+
+    // process materials
+    vector<Texture> processMaterial(aiMaterial *material)
+    {
+        vector<Texture> textures;
         // we assume a convention for sampler names in the shaders. Each diffuse texture should be named
         // as 'texture_diffuseN' where N is a sequential number ranging from 1 to MAX_SAMPLER_NUMBER. 
         // Same applies to other texture as the following list summarizes:
@@ -163,9 +536,7 @@ private:
         // 4. height maps
         std::vector<Texture> heightMaps = loadMaterialTextures(material, aiTextureType_AMBIENT, "texture_height");
         textures.insert(textures.end(), heightMaps.begin(), heightMaps.end());
-        
-        // return a mesh object created from the extracted mesh data
-        return Mesh(vertices, indices, textures);
+        return textures;
     }
 
     // checks all material textures of a given type and loads the textures if they're not loaded yet.
@@ -177,69 +548,49 @@ private:
         {
             aiString str;
             mat->GetTexture(type, i, &str);
-            // check if texture was loaded before and if so, continue to next iteration: skip loading a new texture
-            bool skip = false;
-            for(unsigned int j = 0; j < textures_loaded.size(); j++)
-            {
-                if(std::strcmp(textures_loaded[j].path.data(), str.C_Str()) == 0)
-                {
-                    textures.push_back(textures_loaded[j]);
-                    skip = true; // a texture with the same filepath has already been loaded, continue to next one. (optimization)
-                    break;
-                }
-            }
-            if(!skip)
-            {   // if texture hasn't been loaded already, load it
-                Texture texture;
-                texture.id = TextureFromFile(str.C_Str(), this->directory);
-                texture.type = typeName;
-                texture.path = str.C_Str();
-                textures.push_back(texture);
-                textures_loaded.push_back(texture);  // store it as texture loaded for entire model, to ensure we won't unnecesery load duplicate textures.
-            }
+            textures.push_back(loadTexture(str.C_Str(), typeName));
         }
         return textures;
     }
+
+    // a material texture by its path relative to the model, from the texture cache, so models and materials
+    // sharing a file share the texture
+    Texture loadTexture(const string &path, const string &typeName)
+    {
+        Texture texture;
+        texture.type = typeName;
+        texture.path = path;
+        TextureHandle &handle = textureHandles[path];
+        bool loaded = (bool)handle;
+        if(!loaded)
+        {
+            TextureParams params;
+            params.srgb = gammaCorrection && typeName == "texture_diffuse";
+            if (typeName == "texture_diffuse")
+                params.content = TEXTURE_CONTENT_COLOR;
+            else if (typeName == "texture_normal")
+                params.content = TEXTURE_CONTENT_NORMAL;
+            handle = textureCache().acquire(this->directory + '/' + path, params, false);
+        }
+        // deferred, the texture gets its name in Upload()
+        texture.id = deferred ? 0 : textureCache().upload(handle);
+        if(!loaded)
+            textures_loaded.push_back(texture);
+        return texture;
+    }
 };
 
 
+// a texture by name only: it stays in the texture cache for the rest of the process
 unsigned int TextureFromFile(const char *path, const string &directory, bool gamma)
 {
     string filename = string(path);
     filename = directory + '/' + filename;
 
-    unsigned int textureID;
-    glGenTextures(1, &textureID);
-
-    int width, height, nrComponents;
-    unsigned char *data = stbi_load(filename.c_str(), &width, &height, &nrComponents, 0);
-    if (data)
-    {
-        GLenum format;
-        if (nrComponents == 1)
-            format = GL_RED;
-        else if (nrComponents == 3)
-            format = GL_RGB;
-        else if (nrComponents == 4)
-            format = GL_RGBA;
-
-        glBindTexture(GL_TEXTURE_2D, textureID);
-        glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
-        glGenerateMipmap(GL_TEXTURE_2D);
-
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-        stbi_image_free(data);
-    }
-    else
-    {
-        std::cout << "Texture failed to load at path: " << path << std::endl;
-        stbi_image_free(data);
-    }
-
-    return textureID;
+    TextureParams params;
+    params.srgb = gamma;
+    TextureHandle texture = textureCache().acquire(filename, params);
+    textureCache().keep(texture);
+    return textureCache().upload(texture);
 }
 #endif
@@ -0,0 +1,54 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// number of worker threads to use for CPU-side processing (at least one).
+inline unsigned int workerCount()
+{
+    unsigned int count = std::thread::hardware_concurrency();
+    return count == 0 ? 1 : count;
+}
+
+// set on threads that already run alongside others (parallelFor's and the asset pipeline's workers), so work
+// that would split itself up again with parallelFor runs serially there instead of starting threads per call
+inline bool &onWorkerThread()
+{
+    static thread_local bool worker = false;
+    return worker;
+}
+
+// calls task(i) for every i in [0, count) spread over all cores. Work items are handed out through an
+// atomic counter so uneven items (e.g. cubemap tiles near the poles) still balance out. Blocks until done.
+template <typename Task>
+void parallelFor(unsigned int count, const Task &task)
+{
+    unsigned int threads = workerCount();
+    if (threads > count)
+        threads = count;
+    if (threads <= 1)
+    {
+        for (unsigned int i = 0; i < count; ++i)
+            task(i);
+        return;
+    }
+
+    std::atomic<unsigned int> next(0);
+    auto worker = [&]()
+    {
+        bool wasWorker = onWorkerThread();
+        onWorkerThread() = true;
+        for (unsigned int i = next++; i < count; i = next++)
+            task(i);
+        onWorkerThread() = wasWorker;
+    };
+    std::vector<std::thread> pool;
+    for (unsigned int t = 1; t < threads; ++t)
+        pool.push_back(std::thread(worker));
+    worker(); // the calling thread works as well
+    for (unsigned int t = 0; t < pool.size(); ++t)
+        pool[t].join();
+}
+#endif
@@ -0,0 +1,10 @@
+#ifndef SIMD_H
+#define SIMD_H
+
+// SIMD_SSE2 is defined where the target has SSE2 (every x86-64 target, and x86 builds that enable it); the
+// SSE2 paths guarded by it all have a scalar fallback that gives the same results.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SIMD_SSE2 1
+#include <emmintrin.h>
+#endif
+#endif
@@ -0,0 +1,398 @@
+#ifndef TEXTURE_CACHE_H
+#define TEXTURE_CACHE_H
+
+#include "GL/glew.h"
+
+#include <stb_image.h>
+#include <learnopengl/binary_cache.h>
+#include <learnopengl/mip_chain.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// one cache of 2D textures for every loader in the process (Model, TextureFromFile, AssetPipeline), keyed by
+// the canonical path of the file and how it's loaded. A texture is decoded once however many models and
+// materials ask for it, uploaded once, and deleted when the last handle to it goes.
+//
+// acquire() (any thread) returns the handle, decoding the file if it isn't in the cache yet; upload() (GL
+// thread) creates the texture on first use and drops the pixels, or TextureStreamer::upload() streams it in.
+// The last handle of an uploaded texture has to go on the GL thread, while the context is current.
+//
+// mip chains are built on the CPU when a file is first decoded (mip_chain.h) and kept in a .mipcache file next
+// to it, so later runs read the finished chain instead of decoding and filtering again.
+
+// build mip chains on the CPU and cache them, rather than glGenerateMipmap at upload
+const bool TEXTURE_CPU_MIPS = true;
+
+// an image decoded by stb_image, with its mip levels when it has them; the pixels are freed with the last copy.
+struct DecodedImage {
+    int width = 0, height = 0, components = 0;
+    int levels = 1;                         // back to back in pixels, rows tightly packed
+    std::shared_ptr<unsigned char> pixels;
+
+    int levelWidth(int level) const { return std::max(1, width >> level); }
+    int levelHeight(int level) const { return std::max(1, height >> level); }
+    size_t levelSize(int level) const { return (size_t)levelWidth(level) * levelHeight(level) * components; }
+    const unsigned char *levelPixels(int level) const
+    {
+        const unsigned char *at = pixels.get();
+        for (int l = 0; l < level; ++l)
+            at += levelSize(l);
+        return at;
+    }
+};
+
+// decoding doesn't touch OpenGL, so it can run on any thread. The flip (rows bottom to top, as OpenGL
+// expects them) is done here rather than through stb_image's global, so decodes with either orientation can
+// run concurrently.
+inline DecodedImage decodeImage(const std::string &path, bool flipVertically = true)
+{
+    DecodedImage image;
+    unsigned char *data = stbi_load(path.c_str(), &image.width, &image.height, &image.components, 0);
+    if (!data)
+    {
+        std::cout << "Texture failed to load at path: " << path << std::endl;
+        return image;
+    }
+    image.pixels.reset(data, stbi_image_free);
+    if (flipVertically)
+    {
+        size_t rowBytes = (size_t)image.width * image.components;
+        std::vector<unsigned char> row(rowBytes);
+        for (int y = 0; y < image.height / 2; ++y)
+        {
+            unsigned char *top = data + y * rowBytes, *bottom = data + (image.height - 1 - y) * rowBytes;
+            memcpy(row.data(), top, rowBytes);
+            memcpy(top, bottom, rowBytes);
+            memcpy(bottom, row.data(), rowBytes);
+        }
+    }
+    return image;
+}
+
+// the pixel format of a decoded image, and the storage format of its texture (sRGB for color maps when srgb is set)
+inline GLenum imageFormat(const DecodedImage &image)
+{
+    GLenum format = GL_RGB;
+    if (image.components == 1)
+        format = GL_RED;
+    else if (image.components == 3)
+        format = GL_RGB;
+    else if (image.components == 4)
+        format = GL_RGBA;
+    return format;
+}
+
+inline GLenum imageInternalFormat(const DecodedImage &image, bool srgb)
+{
+    GLenum format = imageFormat(image);
+    if (srgb && format == GL_RGB)
+        return GL_SRGB8;
+    if (srgb && format == GL_RGBA)
+        return GL_SRGB8_ALPHA8;
+    return format;
+}
+
+// creates a repeating 2D texture from a decoded image (GL thread only), with sRGB storage for color maps when
+// srgb is set and a full mip chain when mips is. A failed decode still gets a texture name, like loadTexture
+// always did.
+inline unsigned int uploadImage(const DecodedImage &image, bool srgb = false, bool mips = true)
+{
+    unsigned int textureID;
+    glGenTextures(1, &textureID);
+    if (!image.pixels)
+        return textureID;
+
+    GLenum format = imageFormat(image), internalFormat = imageInternalFormat(image, srgb);
+    glBindTexture(GL_TEXTURE_2D, textureID);
+    // the levels' rows are tightly packed
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    for (int level = 0; level < (mips ? image.levels : 1); ++level)
+        glTexImage2D(GL_TEXTURE_2D, level, internalFormat, image.levelWidth(level), image.levelHeight(level), 0, format, GL_UNSIGNED_BYTE,
+                     image.levelPixels(level));
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    if (mips && image.levels == 1)
+        glGenerateMipmap(GL_TEXTURE_2D);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, mips ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    return textureID;
+}
+
+// how a texture is loaded; part of its cache key
+struct TextureParams {
+    bool srgb = false;  // color data stored as sRGB, linearized by the sampler
+    bool flip = true;   // rows bottom to top, as every image of the demo is loaded
+    bool mips = true;
+    TextureContent content = TEXTURE_CONTENT_DATA; // how the mips are filtered
+
+    TextureParams() = default;
+    explicit TextureParams(TextureContent content) : content(content) {}
+
+    // sRGB storage means sRGB-encoded color, whatever content says
+    TextureContent filtered() const { return srgb ? TEXTURE_CONTENT_COLOR : content; }
+};
+
+// where the mip chain of a texture file is cached; one file per kind of content, so a file loaded as two
+// kinds doesn't have both written to one file at once
+inline std::string mipCachePath(const std::string &path, const TextureParams &params)
+{
+    static const char *kinds[] = { "data", "color", "normal" };
+    return path + "." + kinds[params.filtered()] + ".mipcache";
+}
+
+const uint32_t MIP_CACHE_VERSION = 1;
+
+// key of a mip cache: the file's path and contents, the orientation, the content and the kernel
+inline uint64_t mipCacheKey(const std::string &path, const TextureParams &params)
+{
+    Fnv1a64 hash;
+    hash.updateValue(MIP_CACHE_VERSION);
+    hash.updateString(path);
+    hash.updateFile(path);
+    hash.updateValue(params.flip);
+    hash.updateValue((uint32_t)params.filtered());
+    hash.updateValue((uint32_t)MIP_FILTER);
+    hash.updateValue(MIP_KAISER_WIDTH);
+    hash.updateValue(MIP_KAISER_ALPHA);
+    return hash.value;
+}
+
+inline bool readMipCache(const std::string &cachePath, uint64_t key, DecodedImage &image)
+{
+    BinaryReader reader(cachePath);
+    int32_t size[4];
+    uint64_t bytes = 0;
+    if (!readCacheHeader(reader, "MIPC", MIP_CACHE_VERSION, key) || !reader.readValue(size) || !reader.readValue(bytes))
+        return false;
+    DecodedImage cached;
+    cached.width = size[0];
+    cached.height = size[1];
+    cached.components = size[2];
+    cached.levels = size[3];
+    if (cached.width <= 0 || cached.height <= 0 || cached.components < 1 || cached.components > 4 ||
+        cached.levels != mipChainLength(cached.width, cached.height) || bytes > ((uint64_t)1 << 34))
+        return false;
+    size_t expected = 0;
+    for (int level = 0; level < cached.levels; ++level)
+        expected += cached.levelSize(level);
+    if (bytes != expected)
+        return false;
+    cached.pixels.reset(new unsigned char[expected], std::default_delete<unsigned char[]>());
+    if (!reader.read(cached.pixels.get(), expected))
+        return false;
+    image = cached;
+    return true;
+}
+
+inline bool writeMipCache(const std::string &cachePath, uint64_t key, const DecodedImage &image)
+{
+    BinaryWriter writer(cachePath);
+    size_t bytes = 0;
+    for (int level = 0; level < image.levels; ++level)
+        bytes += image.levelSize(level);
+    int32_t size[4] = { image.width, image.height, image.components, image.levels };
+    writeCacheHeader(writer, "MIPC", MIP_CACHE_VERSION, key);
+    writer.writeValue(size);
+    writer.writeValue((uint64_t)bytes);
+    writer.write(image.pixels.get(), bytes);
+    return writer.good();
+}
+
+// the image of a texture, with its full mip chain when it has mips (and TEXTURE_CPU_MIPS is set): read from
+// the mip cache when it matches the file, otherwise decoded, filtered and written to it
+inline DecodedImage decodeTexture(const std::string &path, const TextureParams &params)
+{
+    if (!TEXTURE_CPU_MIPS || !params.mips)
+        return decodeImage(path, params.flip);
+    std::string cachePath = mipCachePath(path, params);
+    uint64_t key = mipCacheKey(path, params);
+    DecodedImage image;
+    if (readMipCache(cachePath, key, image))
+        return image;
+
+    image = decodeImage(path, params.flip);
+    if (!image.pixels)
+        return image;
+    std::vector<unsigned char> chain = buildMipChain(image.pixels.get(), image.width, image.height, image.components, params.filtered());
+    image.levels = mipChainLength(image.width, image.height);
+    std::shared_ptr<std::vector<unsigned char>> levels = std::make_shared<std::vector<unsigned char>>(std::move(chain));
+    image.pixels = std::shared_ptr<unsigned char>(levels, levels->data());
+    if (!writeMipCache(cachePath, key, image))
+        std::cout << "Mip cache: couldn't write " << cachePath << std::endl;
+    return image;
+}
+
+// the path with '\' as '/', without "." and empty segments and with ".." resolved where it can be, so the
+// different spellings of one file share an entry; case-insensitive on Windows
+inline std::string canonicalTexturePath(const std::string &path)
+{
+    std::vector<std::string> segments;
+    size_t at = 0;
+    while (at <= path.size())
+    {
+        size_t end = path.find_first_of("/\\", at);
+        if (end == std::string::npos)
+            end = path.size();
+        std::string segment = path.substr(at, end - at);
+        if (segment == ".." && !segments.empty() && segments.back() != "..")
+            segments.pop_back();
+        else if (!segment.empty() && segment != ".")
+            segments.push_back(segment);
+        at = end + 1;
+    }
+    std::string canonical = !path.empty() && (path[0] == '/' || path[0] == '\\') ? "/" : "";
+    for (size_t s = 0; s < segments.size(); ++s)
+        canonical += (s ? "/" : "") + segments[s];
+#ifdef _WIN32
+    std::transform(canonical.begin(), canonical.end(), canonical.begin(), [](char c) { return (char)std::tolower((unsigned char)c); });
+#endif
+    return canonical;
+}
+
+struct TextureEntry {
+    std::string key, path;
+    TextureParams params;
+    unsigned int id = 0;        // once uploaded
+    DecodedImage image;         // until uploaded
+    std::once_flag decoded;
+};
+
+typedef std::shared_ptr<TextureEntry> TextureHandle;
+
+class TextureCache
+{
+public:
+    TextureCache() = default;
+    TextureCache(const TextureCache &) = delete;
+    TextureCache &operator=(const TextureCache &) = delete;
+
+    // handles kept for the rest of the process (keep()) outlive the GL context; they're let go without GL calls
+    ~TextureCache()
+    {
+        std::vector<TextureHandle> last;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            exiting = true;
+            last.swap(kept);
+        }
+    }
+
+    // the texture of a file, decoded on the calling thread when no live handle has it yet; concurrent
+    // acquires of the same texture wait for the one decode. Without decodeNow the decode is left to decode()
+    // or upload().
+    TextureHandle acquire(const std::string &path, const TextureParams &params = TextureParams(), bool decodeNow = true)
+    {
+        std::string canonical = canonicalTexturePath(path);
+        static const char *contents[] = { "|data", "|color", "|normal" };
+        std::string key = canonical + (params.srgb ? "|srgb" : "|linear") + (params.flip ? "|flip" : "") + (params.mips ? "|mips" : "") +
+                          contents[params.content];
+        TextureHandle handle;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            std::weak_ptr<TextureEntry> &slot = entries[key];
+            handle = slot.lock();
+            if (!handle)
+            {
+                handle = TextureHandle(new TextureEntry(), [this](TextureEntry *entry) { release(entry); });
+                handle->key = key;
+                handle->path = canonical;
+                handle->params = params;
+                slot = handle;
+                ++decodes;
+            }
+            else
+                ++hits;
+        }
+        if (decodeNow)
+            decode(handle);
+        return handle;
+    }
+
+    // decodes the file of a texture unless that has been done (any thread)
+    void decode(const TextureHandle &handle)
+    {
+        TextureEntry *entry = handle.get();
+        std::call_once(entry->decoded, [entry]() { entry->image = decodeTexture(entry->path, entry->params); });
+    }
+
+    // the texture's name, created from the decoded pixels on first use (GL thread only)
+    unsigned int upload(const TextureHandle &handle)
+    {
+        if (!handle->id)
+        {
+            decode(handle);
+            handle->id = uploadImage(handle->image, handle->params.srgb, handle->params.mips);
+            handle->image = DecodedImage();
+        }
+        return handle->id;
+    }
+
+    // keeps a texture until the process ends, for callers that only hold on to its name
+    void keep(const TextureHandle &handle)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        kept.push_back(handle);
+    }
+
+    // textures alive, files decoded and acquires served from the cache so far
+    size_t liveCount()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        size_t live = 0;
+        for (auto it = entries.begin(); it != entries.end(); ++it)
+            live += !it->second.expired();
+        return live;
+    }
+    size_t decodeCount()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return decodes;
+    }
+    size_t hitCount()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return hits;
+    }
+
+private:
+    std::mutex mutex;
+    std::unordered_map<std::string, std::weak_ptr<TextureEntry>> entries;
+    std::vector<TextureHandle> kept;
+    size_t decodes = 0, hits = 0;
+    bool exiting = false;
+
+    // the last handle went
+    void release(TextureEntry *entry)
+    {
+        bool deleteTexture;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            // unless the key has been acquired again since, by a new entry
+            auto it = entries.find(entry->key);
+            if (it != entries.end() && it->second.expired())
+                entries.erase(it);
+            deleteTexture = entry->id && !exiting;
+        }
+        if (deleteTexture)
+            glDeleteTextures(1, &entry->id);
+        delete entry;
+    }
+};
+
+// the process-wide cache
+inline TextureCache &textureCache()
+{
+    static TextureCache cache;
+    return cache;
+}
+#endif
@@ -0,0 +1,286 @@
+#ifndef TEXTURE_STREAMER_H
+#define TEXTURE_STREAMER_H
+
+#include "GL/glew.h"
+
+#include <learnopengl/texture_cache.h>
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+
+// size of the pixel buffer ring texture uploads are staged in, and how much of it one update() may fill
+const size_t TEXTURE_STREAM_RING_BYTES = 32 << 20;
+const size_t TEXTURE_STREAM_FRAME_BYTES = 8 << 20;
+
+// streams decoded textures in over several frames instead of uploading each one whole: update() copies up to
+// a byte budget of rows into a ring of pixel unpack buffer, issues glTexSubImage2D from there (so the driver
+// copies them while the frame renders) and fences each piece, and the space of a piece is written again only
+// once its fence has signaled. With GL 4.4 / ARB_buffer_storage the ring stays mapped for good; otherwise each
+// piece maps its range unsynchronized, which the fences make safe.
+//
+// a streamed texture gets its name right away, and its levels (the mip chain of the texture cache, or level 0
+// only and glGenerateMipmap at the end) are defined as their rows go up. Until its last level is in it's
+// incomplete, so it samples black rather than half-loaded.
+class TextureStreamer
+{
+public:
+    explicit TextureStreamer(size_t ringBytes = TEXTURE_STREAM_RING_BYTES, size_t frameBytes = TEXTURE_STREAM_FRAME_BYTES)
+        : ringSize(ringBytes), frameBudget(frameBytes)
+    {
+    }
+
+    TextureStreamer(const TextureStreamer &) = delete;
+    TextureStreamer &operator=(const TextureStreamer &) = delete;
+
+    // textures still streaming stay incomplete; they're deleted with their last handle as usual
+    ~TextureStreamer()
+    {
+        for (size_t r = 0; r < pieces.size(); ++r)
+            glDeleteSync(pieces[r].fence);
+        if (buffer)
+        {
+            if (persistent)
+            {
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer);
+                glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            }
+            glDeleteBuffers(1, &buffer);
+        }
+    }
+
+    // the texture's name (GL thread only), decoding the file first if that hasn't been done; its pixels are
+    // queued for update(). Like TextureCache::upload(), once per texture whoever asks.
+    unsigned int upload(const TextureHandle &texture)
+    {
+        if (texture->id)
+            return texture->id;
+        textureCache().decode(texture);
+        Job job;
+        job.texture = texture;
+        job.image = texture->image;
+        texture->image = DecodedImage();
+        if (!job.image.pixels)
+        {
+            texture->id = uploadImage(job.image);
+            return texture->id;
+        }
+
+        glGenTextures(1, &texture->id);
+        glBindTexture(GL_TEXTURE_2D, texture->id);
+        glTexImage2D(GL_TEXTURE_2D, 0, imageInternalFormat(job.image, texture->params.srgb), job.image.width, job.image.height, 0,
+                     imageFormat(job.image), GL_UNSIGNED_BYTE, nullptr);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        job.levels = texture->params.mips ? job.image.levels : 1;
+        for (int level = 0; level < job.levels; ++level)
+            queuedBytes += rowPitch(job.image, level) * job.image.levelHeight(level);
+        jobs.push_back(job);
+        return texture->id;
+    }
+
+    // per frame (GL thread): stages and uploads up to the frame budget of queued rows, as far as the ring has
+    // room without waiting for the GPU. Returns true once nothing is queued.
+    bool update()
+    {
+        retire();
+        if (jobs.empty())
+            return true;
+        create();
+
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer);
+        size_t budget = frameBudget;
+        while (!jobs.empty() && budget > 0)
+        {
+            Job &job = jobs.front();
+            int width = job.image.levelWidth(job.level), height = job.image.levelHeight(job.level);
+            size_t pitch = rowPitch(job.image, job.level);
+            // at least a row, so rows longer than the budget still go
+            int rows = (int)std::min((size_t)(height - job.nextRow), std::max(budget / pitch, (size_t)1));
+            size_t offset;
+            while (!allocate(rows * pitch, offset) && rows > 1)
+                rows /= 2;
+            if (!allocate(rows * pitch, offset))
+            {
+                if (pieces.empty())
+                    uploadDirect(job);  // a row bigger than the whole ring
+                break;
+            }
+
+            unsigned char *staging = persistent ? mapped + offset
+                : (unsigned char *)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, offset, rows * pitch,
+                                                    GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+            size_t rowBytes = (size_t)width * job.image.components;
+            const unsigned char *source = job.image.levelPixels(job.level) + (size_t)job.nextRow * rowBytes;
+            // rows padded to the default unpack alignment of 4
+            for (int y = 0; y < rows; ++y)
+                memcpy(staging + y * pitch, source + y * rowBytes, rowBytes);
+            if (!persistent)
+                glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+            glBindTexture(GL_TEXTURE_2D, job.texture->id);
+            if (job.nextRow == 0)
+                defineLevel(job);
+            glTexSubImage2D(GL_TEXTURE_2D, job.level, 0, job.nextRow, width, rows, imageFormat(job.image), GL_UNSIGNED_BYTE,
+                            (void*)offset);
+            Piece piece = { offset, offset + rows * pitch, glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0) };
+            pieces.push_back(piece);
+            head = piece.end;
+            budget -= std::min(budget, rows * pitch);
+            queuedBytes -= rows * pitch;
+            advance(job, rows);
+        }
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        return jobs.empty();
+    }
+
+    // bytes of pixels queued and not staged yet
+    size_t pendingBytes() const { return queuedBytes; }
+
+private:
+    // a texture whose rows are being streamed in
+    struct Job {
+        TextureHandle texture;
+        DecodedImage image;
+        int levels = 1;     // to upload
+        int level = 0, nextRow = 0;
+    };
+
+    // a staged range of the ring, in use until its fence signals
+    struct Piece {
+        size_t begin, end;
+        GLsync fence;
+    };
+
+    size_t ringSize, frameBudget;
+    unsigned int buffer = 0;
+    bool persistent = false;
+    unsigned char *mapped = nullptr;  // the whole ring, when persistent
+    size_t head = 0;                  // where the next piece goes, if it fits before the oldest in use
+    std::deque<Piece> pieces;         // oldest first
+    std::deque<Job> jobs;
+    size_t queuedBytes = 0;
+
+    static size_t rowPitch(const DecodedImage &image, int level)
+    {
+        return ((size_t)image.levelWidth(level) * image.components + 3) & ~(size_t)3;
+    }
+
+    void create()
+    {
+        if (buffer)
+            return;
+        glGenBuffers(1, &buffer);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer);
+        persistent = GLEW_VERSION_4_4 || GLEW_ARB_buffer_storage;
+        if (persistent)
+        {
+            GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            glBufferStorage(GL_PIXEL_UNPACK_BUFFER, ringSize, nullptr, flags);
+            mapped = (unsigned char *)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, ringSize, flags);
+        }
+        else
+            glBufferData(GL_PIXEL_UNPACK_BUFFER, ringSize, nullptr, GL_STREAM_DRAW);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+
+    // frees the pieces the GPU is done with, oldest first
+    void retire()
+    {
+        while (!pieces.empty())
+        {
+            GLenum state = glClientWaitSync(pieces.front().fence, 0, 0);
+            if (state != GL_ALREADY_SIGNALED && state != GL_CONDITION_SATISFIED)
+                break;
+            glDeleteSync(pieces.front().fence);
+            pieces.pop_front();
+        }
+        if (pieces.empty())
+            head = 0;
+    }
+
+    // room for bytes in one range: after head, or from the start of the ring once the end is reached. Never
+    // up to the oldest piece in use exactly, so head == its begin only ever means an empty ring.
+    bool allocate(size_t bytes, size_t &offset)
+    {
+        if (pieces.empty())
+        {
+            offset = 0;
+            return bytes <= ringSize;
+        }
+        size_t tail = pieces.front().begin;
+        if (head < tail)
+        {
+            offset = head;
+            return bytes < tail - head;
+        }
+        if (bytes <= ringSize - head)
+        {
+            offset = head;
+            return true;
+        }
+        offset = 0;
+        return bytes < tail;
+    }
+
+    // allocates the job's current level ahead of its first rows (level 0 was in upload()); the texture is bound
+    void defineLevel(const Job &job)
+    {
+        if (job.level == 0)
+            return;
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0); // or the null pixels would be an offset into the ring
+        glTexImage2D(GL_TEXTURE_2D, job.level, imageInternalFormat(job.image, job.texture->params.srgb), job.image.levelWidth(job.level),
+                     job.image.levelHeight(job.level), 0, imageFormat(job.image), GL_UNSIGNED_BYTE, nullptr);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer);
+    }
+
+    // rows of the current level are in; on to the next level, or done after the last
+    void advance(Job &job, int rows)
+    {
+        job.nextRow += rows;
+        if (job.nextRow < job.image.levelHeight(job.level))
+            return;
+        job.nextRow = 0;
+        if (++job.level == job.levels)
+            complete(job);
+    }
+
+    // the rest of a job straight from its pixels, when not even a row of it fits the ring
+    void uploadDirect(Job &job)
+    {
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glBindTexture(GL_TEXTURE_2D, job.texture->id);
+        for (bool last = false; !last; )
+        {
+            int width = job.image.levelWidth(job.level), height = job.image.levelHeight(job.level);
+            if (job.nextRow == 0)
+                defineLevel(job);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            size_t rowBytes = (size_t)width * job.image.components;
+            glTexSubImage2D(GL_TEXTURE_2D, job.level, 0, job.nextRow, width, height - job.nextRow, imageFormat(job.image), GL_UNSIGNED_BYTE,
+                            job.image.levelPixels(job.level) + (size_t)job.nextRow * rowBytes);
+            queuedBytes -= rowPitch(job.image, job.level) * (height - job.nextRow);
+            last = job.level + 1 == job.levels;
+            advance(job, height - job.nextRow); // which pops the job after the last level
+        }
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer);
+    }
+
+    // all levels are in: the texture is complete (with glGenerateMipmap when it came without a chain); the
+    // pixels go
+    void complete(Job &job)
+    {
+        glBindTexture(GL_TEXTURE_2D, job.texture->id);
+        if (!job.texture->params.mips)
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        else if (job.image.levels == 1)
+            glGenerateMipmap(GL_TEXTURE_2D);
+        jobs.pop_front();
+    }
+};
+#endif
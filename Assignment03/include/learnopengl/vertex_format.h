@@ -0,0 +1,198 @@
+#ifndef VERTEX_FORMAT_H
+#define VERTEX_FORMAT_H
+
+#include "GL/glew.h"
+
+#include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// compile-time descriptions of the vertex layouts a BasicMesh can be built with. Every layout specializes
+// VertexFormat<V> with the list of its attributes (which generates the glVertexAttribPointer setup), how
+// 2.2.2.pbr.vs has to decode it, and pack(), which converts a full Vertex into it.
+//
+// the packed layouts keep only what the PBR shaders read:
+// PackedVertex (16 bytes): position as unorm16 within the mesh bounds, octahedral normal as snorm16, half UV
+// PackedTangentVertex (20 bytes): position as above, the tangent frame as a snorm16 quaternion, half UV
+
+// how location 1 holds the normal, see 2.2.2.pbr.vs (normalEncoding)
+enum VertexNormalEncoding { NORMAL_FLOAT = 0, NORMAL_OCTAHEDRAL = 1, NORMAL_QTANGENT = 2 };
+
+// one attribute at a fixed location and byte offset
+template <GLuint Location, GLint Size, GLenum Type, GLboolean Normalized, size_t Offset>
+struct VertexAttrib
+{
+    static void enable(GLsizei stride)
+    {
+        glEnableVertexAttribArray(Location);
+        glVertexAttribPointer(Location, Size, Type, Normalized, stride, (void*)Offset);
+    }
+};
+
+template <typename... Attribs>
+struct VertexAttribs
+{
+    // sets up every attribute of the bound VAO for the bound vertex buffer
+    static void enable(GLsizei stride)
+    {
+        int expand[] = { 0, (Attribs::enable(stride), 0)... };
+        (void)expand;
+    }
+};
+
+template <typename V>
+struct VertexFormat;
+
+// the box quantized positions are relative to: position = offset + scale * unorm
+struct VertexBounds {
+    glm::vec3 offset = glm::vec3(0.0f);
+    glm::vec3 scale = glm::vec3(1.0f);
+
+    template <typename Source>
+    static VertexBounds of(const std::vector<Source> &vertices)
+    {
+        VertexBounds bounds;
+        if (vertices.empty())
+            return bounds;
+        glm::vec3 lo = vertices[0].Position, hi = vertices[0].Position;
+        for (size_t i = 1; i < vertices.size(); ++i)
+        {
+            lo = glm::min(lo, vertices[i].Position);
+            hi = glm::max(hi, vertices[i].Position);
+        }
+        bounds.offset = lo;
+        // a flat mesh still gets a usable scale on its flat axis
+        bounds.scale = glm::max(hi - lo, glm::vec3(1e-6f));
+        return bounds;
+    }
+
+    void pack(const glm::vec3 &position, unsigned short out[4]) const
+    {
+        glm::vec3 unorm = (position - offset) / scale;
+        for (int i = 0; i < 3; ++i)
+            out[i] = glm::packUnorm1x16(unorm[i]);
+        out[3] = 0;
+    }
+};
+
+// octahedral normal encoding, the same mapping as the octahedral IBL maps
+inline void packOctahedralNormal(glm::vec3 n, short out[2])
+{
+    n /= std::abs(n.x) + std::abs(n.y) + std::abs(n.z);
+    glm::vec2 p(n.x, n.y);
+    if (n.z < 0.0f)
+        p = (1.0f - glm::abs(glm::vec2(n.y, n.x))) * glm::vec2(n.x >= 0.0f ? 1.0f : -1.0f, n.y >= 0.0f ? 1.0f : -1.0f);
+    out[0] = (short)glm::packSnorm1x16(p.x);
+    out[1] = (short)glm::packSnorm1x16(p.y);
+}
+
+// the tangent frame as the rotation taking x, y, z to tangent, bitangent and normal. A mirrored frame (the
+// bitangent against cross(normal, tangent)) is stored with a negative w, which is never 0 after quantization
+// so its sign survives.
+inline void packTangentFrame(const glm::vec3 &normal, const glm::vec3 &tangent, const glm::vec3 &bitangent, short out[4])
+{
+    glm::vec3 n = glm::normalize(normal);
+    glm::vec3 t = tangent - n * glm::dot(n, tangent);
+    if (glm::dot(t, t) < 1e-12f)
+        t = std::abs(n.x) < 0.9f ? glm::cross(n, glm::vec3(1.0f, 0.0f, 0.0f)) : glm::cross(n, glm::vec3(0.0f, 1.0f, 0.0f));
+    t = glm::normalize(t);
+    glm::vec3 b = glm::cross(n, t);
+    bool mirrored = glm::dot(b, bitangent) < 0.0f;
+
+    glm::quat q = glm::normalize(glm::quat_cast(glm::mat3(t, b, n)));
+    if (q.w < 0.0f)
+        q = -q;
+    const float bias = 1.0f / 32767.0f;
+    if (q.w < bias)
+    {
+        float s = std::sqrt(1.0f - bias * bias);
+        q = glm::quat(bias, q.x * s, q.y * s, q.z * s);
+    }
+    if (mirrored)
+        q = -q;
+    out[0] = (short)glm::packSnorm1x16(q.x);
+    out[1] = (short)glm::packSnorm1x16(q.y);
+    out[2] = (short)glm::packSnorm1x16(q.z);
+    out[3] = (short)glm::packSnorm1x16(q.w);
+}
+
+inline void packHalfTexCoords(const glm::vec2 &uv, unsigned short out[2])
+{
+    out[0] = glm::packHalf1x16(uv.x);
+    out[1] = glm::packHalf1x16(uv.y);
+}
+
+struct PackedVertex {
+    unsigned short Position[4];  // unorm16 within the mesh bounds, w unused
+    short Normal[2];             // octahedral, snorm16
+    unsigned short TexCoords[2]; // half floats, so repeating UVs outside [0, 1] still fit
+};
+
+struct PackedTangentVertex {
+    unsigned short Position[4];
+    short TangentFrame[4];       // quaternion, snorm16
+    unsigned short TexCoords[2];
+};
+
+template <>
+struct VertexFormat<PackedVertex>
+{
+    typedef VertexAttribs<
+        VertexAttrib<0, 3, GL_UNSIGNED_SHORT, GL_TRUE, offsetof(PackedVertex, Position)>,
+        VertexAttrib<1, 2, GL_SHORT, GL_TRUE, offsetof(PackedVertex, Normal)>,
+        VertexAttrib<2, 2, GL_HALF_FLOAT, GL_FALSE, offsetof(PackedVertex, TexCoords)>
+    > Attribs;
+    static const uint32_t id = 1; // part of the mesh cache key
+    static const bool quantizedPosition = true;
+    static const VertexNormalEncoding normalEncoding = NORMAL_OCTAHEDRAL;
+
+    template <typename Source>
+    static PackedVertex pack(const Source &v, const VertexBounds &bounds)
+    {
+        PackedVertex p;
+        bounds.pack(v.Position, p.Position);
+        packOctahedralNormal(v.Normal, p.Normal);
+        packHalfTexCoords(v.TexCoords, p.TexCoords);
+        return p;
+    }
+};
+
+template <>
+struct VertexFormat<PackedTangentVertex>
+{
+    typedef VertexAttribs<
+        VertexAttrib<0, 3, GL_UNSIGNED_SHORT, GL_TRUE, offsetof(PackedTangentVertex, Position)>,
+        VertexAttrib<1, 4, GL_SHORT, GL_TRUE, offsetof(PackedTangentVertex, TangentFrame)>,
+        VertexAttrib<2, 2, GL_HALF_FLOAT, GL_FALSE, offsetof(PackedTangentVertex, TexCoords)>
+    > Attribs;
+    static const uint32_t id = 2;
+    static const bool quantizedPosition = true;
+    static const VertexNormalEncoding normalEncoding = NORMAL_QTANGENT;
+
+    template <typename Source>
+    static PackedTangentVertex pack(const Source &v, const VertexBounds &bounds)
+    {
+        PackedTangentVertex p;
+        bounds.pack(v.Position, p.Position);
+        packTangentFrame(v.Normal, v.Tangent, v.Bitangent, p.TangentFrame);
+        packHalfTexCoords(v.TexCoords, p.TexCoords);
+        return p;
+    }
+};
+
+// converts full vertices into layout V; bounds gets the box its positions are quantized to
+template <typename V, typename Source>
+std::vector<V> packVertices(const std::vector<Source> &vertices, VertexBounds &bounds)
+{
+    bounds = VertexFormat<V>::quantizedPosition ? VertexBounds::of(vertices) : VertexBounds();
+    std::vector<V> packed(vertices.size());
+    for (size_t i = 0; i < vertices.size(); ++i)
+        packed[i] = VertexFormat<V>::pack(vertices[i], bounds);
+    return packed;
+}
+#endif
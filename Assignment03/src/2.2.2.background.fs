@@ -3,10 +3,29 @@ out vec4 FragColor;
 in vec3 WorldPos;
 
 uniform samplerCube environmentMap;
+// octahedral 2D version of the environment, used instead of the cubemap when useOctahedralMaps is set
+uniform bool useOctahedralMaps;
+uniform sampler2D environmentOctahedral;
+
+// octahedral map lookup, see 2.2.2.pbr.fs
+vec2 octahedralUV(vec3 dir)
+{
+    dir /= abs(dir.x) + abs(dir.y) + abs(dir.z);
+    vec2 signs = vec2(dir.x >= 0.0 ? 1.0 : -1.0, dir.y >= 0.0 ? 1.0 : -1.0);
+    vec2 p = dir.z >= 0.0 ? dir.xy : (1.0 - abs(dir.yx)) * signs;
+    return p * 0.5 + 0.5;
+}
+
+vec3 textureOctahedral(sampler2D map, vec3 dir, float lod)
+{
+    // the map is mirrored across its edges: stay half a texel of the coarser mip inside them
+    float border = min(0.5 * exp2(ceil(lod)) / float(textureSize(map, 0).x), 0.5);
+    return textureLod(map, clamp(octahedralUV(dir), vec2(border), vec2(1.0 - border)), lod).rgb;
+}
 
 void main()
 {		
-    vec3 envColor = textureLod(environmentMap, WorldPos, 0.0).rgb;
+    vec3 envColor = useOctahedralMaps ? textureOctahedral(environmentOctahedral, WorldPos, 0.0) : textureLod(environmentMap, WorldPos, 0.0).rgb;
     
     // HDR tonemap and gamma correct
     envColor = envColor / (envColor + vec3(1.0));
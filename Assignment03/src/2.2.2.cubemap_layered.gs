@@ -0,0 +1,24 @@
+#version 330 core
+layout (triangles) in;
+layout (triangle_strip, max_vertices = 18) out;
+
+out vec3 WorldPos;
+
+uniform mat4 projection;
+uniform mat4 views[6];
+
+// broadcasts every triangle to all six layers of the attached cubemap, one view matrix per face
+void main()
+{
+    for (int face = 0; face < 6; ++face)
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            gl_Layer = face;
+            WorldPos = gl_in[i].gl_Position.xyz;
+            gl_Position = projection * views[face] * vec4(WorldPos, 1.0);
+            EmitVertex();
+        }
+        EndPrimitive();
+    }
+}
\ No newline at end of file
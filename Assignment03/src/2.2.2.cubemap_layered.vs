@@ -0,0 +1,8 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+
+// the cube is passed through untransformed, 2.2.2.cubemap_layered.gs projects it once per face
+void main()
+{
+    gl_Position = vec4(aPos, 1.0);
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+#version 430 core
+layout (local_size_x = 8, local_size_y = 8) in;
+
+// compute version of 2.2.2.equirectangular_to_cubemap.fs: one invocation per texel of rows [rowBegin, rowEnd)
+// of every face (z) of a size x size level, stored straight into the bound level of the map
+uniform int size;
+uniform int rowBegin;
+uniform int rowEnd;
+uniform bool octahedralTarget;
+layout (rgba16f, binding = 0) uniform writeonly imageCube targetCube;
+layout (rgba16f, binding = 1) uniform writeonly image2D targetOctahedral;
+
+uniform sampler2D equirectangularMap;
+
+// direction through the centre of a texel, see cubeTexelDirection in ibl_cpu_bake.h and octahedralDirection in
+// ibl_octahedral.h. Not normalized: a point on the cube, or on the octahedron.
+vec3 texelDirection(ivec3 texel)
+{
+    vec2 st = 2.0 * (vec2(texel.xy) + 0.5) / float(size) - 1.0;
+    if (octahedralTarget)
+    {
+        vec3 d = vec3(st, 1.0 - abs(st.x) - abs(st.y));
+        if (d.z < 0.0)
+            d.xy = (1.0 - abs(d.yx)) * vec2(d.x >= 0.0 ? 1.0 : -1.0, d.y >= 0.0 ? 1.0 : -1.0);
+        return d;
+    }
+    if (texel.z == 0) return vec3( 1.0, -st.y, -st.x);
+    if (texel.z == 1) return vec3(-1.0, -st.y,  st.x);
+    if (texel.z == 2) return vec3( st.x,  1.0,  st.y);
+    if (texel.z == 3) return vec3( st.x, -1.0, -st.y);
+    if (texel.z == 4) return vec3( st.x, -st.y,  1.0);
+    return vec3(-st.x, -st.y, -1.0);
+}
+
+void storeTarget(ivec3 texel, vec3 color)
+{
+    if (octahedralTarget)
+        imageStore(targetOctahedral, texel.xy, vec4(color, 1.0));
+    else
+        imageStore(targetCube, texel, vec4(color, 1.0));
+}
+
+const vec2 invAtan = vec2(0.1591, 0.3183);
+vec2 SampleSphericalMap(vec3 v)
+{
+    vec2 uv = vec2(atan(v.z, v.x), asin(v.y));
+    uv *= invAtan;
+    uv += 0.5;
+    return uv;
+}
+
+void main()
+{
+    ivec3 texel = ivec3(gl_GlobalInvocationID.x, int(gl_GlobalInvocationID.y) + rowBegin, gl_GlobalInvocationID.z);
+    if (texel.x >= size || texel.y >= rowEnd)
+        return;
+    vec2 uv = SampleSphericalMap(normalize(texelDirection(texel)));
+    vec3 color = textureLod(equirectangularMap, uv, 0.0).rgb;
+
+    storeTarget(texel, color);
+}
\ No newline at end of file
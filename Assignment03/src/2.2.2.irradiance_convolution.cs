@@ -0,0 +1,104 @@
+#version 430 core
+layout (local_size_x = 8, local_size_y = 8) in;
+
+// compute version of 2.2.2.irradiance_convolution.fs. Instead of walking the hemisphere of every texel through
+// texture fetches, it sums the texels of one environment level (sourceLevel, the level of the irradiance map's
+// size) weighted by their solid angle and the cosine. Those texels are the same for every invocation, so a
+// workgroup loads them tile by tile into shared memory, one texel per invocation, and each invocation then
+// accumulates the whole tile from there.
+uniform int size;
+uniform int rowBegin;
+uniform int rowEnd;
+uniform bool octahedralTarget;
+layout (rgba16f, binding = 0) uniform writeonly imageCube targetCube;
+layout (rgba16f, binding = 1) uniform writeonly image2D targetOctahedral;
+
+uniform samplerCube environmentMap;
+// octahedral environment (IBL_LAYOUT_OCTAHEDRAL)
+uniform bool octahedralSource;
+uniform sampler2D environmentOctahedral;
+uniform int sourceLevel;
+
+const float PI = 3.14159265359;
+const int TILE_SIZE = 64; // one source texel per invocation
+
+shared vec3 tileDirection[TILE_SIZE];
+shared vec3 tileRadiance[TILE_SIZE]; // radiance * solid angle
+
+// direction through the centre of a texel of a size x size cubemap face or octahedral map, see
+// cubeTexelDirection in ibl_cpu_bake.h and octahedralDirection in ibl_octahedral.h. Not normalized: a point on
+// the cube, or on the octahedron.
+vec3 texelDirection(ivec3 texel, int size, bool octahedral)
+{
+    vec2 st = 2.0 * (vec2(texel.xy) + 0.5) / float(size) - 1.0;
+    if (octahedral)
+    {
+        vec3 d = vec3(st, 1.0 - abs(st.x) - abs(st.y));
+        if (d.z < 0.0)
+            d.xy = (1.0 - abs(d.yx)) * vec2(d.x >= 0.0 ? 1.0 : -1.0, d.y >= 0.0 ? 1.0 : -1.0);
+        return d;
+    }
+    if (texel.z == 0) return vec3( 1.0, -st.y, -st.x);
+    if (texel.z == 1) return vec3(-1.0, -st.y,  st.x);
+    if (texel.z == 2) return vec3( st.x,  1.0,  st.y);
+    if (texel.z == 3) return vec3( st.x, -1.0, -st.y);
+    if (texel.z == 4) return vec3( st.x, -st.y,  1.0);
+    return vec3(-st.x, -st.y, -1.0);
+}
+
+void storeTarget(ivec3 texel, vec3 color)
+{
+    if (octahedralTarget)
+        imageStore(targetOctahedral, texel.xy, vec4(color, 1.0));
+    else
+        imageStore(targetCube, texel, vec4(color, 1.0));
+}
+
+int sourceSize()
+{
+    return octahedralSource ? textureSize(environmentOctahedral, sourceLevel).x : textureSize(environmentMap, sourceLevel).x;
+}
+
+// source texel i of the environment level: its direction, and its radiance times its solid angle. Both
+// texelDirection points v span (2 / size)^2 of a plane at distance 1 / |v| along v (the cube faces, or the
+// octahedron faces after the unfolding), which is a solid angle of (2 / size)^2 / |v|^3.
+void loadSourceTexel(int i, int s, out vec3 direction, out vec3 radiance)
+{
+    ivec3 texel = ivec3(i % s, (i / s) % s, i / (s * s));
+    vec3 v = texelDirection(texel, s, octahedralSource);
+    // a cubemap texel is read at its centre, where the filtered lookup is the texel itself
+    radiance = octahedralSource ? texelFetch(environmentOctahedral, texel.xy, sourceLevel).rgb : textureLod(environmentMap, v, float(sourceLevel)).rgb;
+    float len = length(v);
+    direction = v / len;
+    radiance *= 4.0 / (float(s * s) * len * len * len);
+}
+
+void main()
+{
+    ivec3 texel = ivec3(gl_GlobalInvocationID.x, int(gl_GlobalInvocationID.y) + rowBegin, gl_GlobalInvocationID.z);
+    // invocations past the edge still help load the tiles
+    bool inside = texel.x < size && texel.y < rowEnd;
+    vec3 N = normalize(texelDirection(texel, size, octahedralTarget));
+
+    int s = sourceSize();
+    int sourceTexels = s * s * (octahedralSource ? 1 : 6);
+    int local = int(gl_LocalInvocationIndex);
+    vec3 irradiance = vec3(0.0);
+    for (int tile = 0; tile < sourceTexels; tile += TILE_SIZE)
+    {
+        vec3 direction = vec3(0.0), radiance = vec3(0.0);
+        if (tile + local < sourceTexels)
+            loadSourceTexel(tile + local, s, direction, radiance);
+        tileDirection[local] = direction;
+        tileRadiance[local] = radiance;
+        memoryBarrierShared();
+        barrier();
+
+        for (int i = 0; i < TILE_SIZE; ++i)
+            irradiance += tileRadiance[i] * max(dot(N, tileDirection[i]), 0.0);
+        barrier();
+    }
+    // irradiance / PI, like the fragment version
+    if (inside)
+        storeTarget(texel, irradiance / PI);
+}
\ No newline at end of file
@@ -3,9 +3,30 @@ out vec4 FragColor;
 in vec3 WorldPos;
 
 uniform samplerCube environmentMap;
+// octahedral environment (IBL_LAYOUT_OCTAHEDRAL), sampled at a fixed mip: log2(environment size / map size),
+// what texture() picks for the cubemap
+uniform bool octahedralSource;
+uniform sampler2D environmentOctahedral;
+uniform float octahedralLod;
 
 const float PI = 3.14159265359;
 
+// octahedral map lookup, see 2.2.2.pbr.fs
+vec2 octahedralUV(vec3 dir)
+{
+    dir /= abs(dir.x) + abs(dir.y) + abs(dir.z);
+    vec2 signs = vec2(dir.x >= 0.0 ? 1.0 : -1.0, dir.y >= 0.0 ? 1.0 : -1.0);
+    vec2 p = dir.z >= 0.0 ? dir.xy : (1.0 - abs(dir.yx)) * signs;
+    return p * 0.5 + 0.5;
+}
+
+vec3 textureOctahedral(sampler2D map, vec3 dir, float lod)
+{
+    // the map is mirrored across its edges: stay half a texel of the coarser mip inside them
+    float border = min(0.5 * exp2(ceil(lod)) / float(textureSize(map, 0).x), 0.5);
+    return textureLod(map, clamp(octahedralUV(dir), vec2(border), vec2(1.0 - border)), lod).rgb;
+}
+
 void main()
 {		
     vec3 N = normalize(WorldPos);
@@ -28,7 +49,8 @@ void main()
             // tangent space to world
             vec3 sampleVec = tangentSample.x * right + tangentSample.y * up + tangentSample.z * N; 
 
-            irradiance += texture(environmentMap, sampleVec).rgb * cos(theta) * sin(theta);
+            vec3 radiance = octahedralSource ? textureOctahedral(environmentOctahedral, sampleVec, octahedralLod) : texture(environmentMap, sampleVec).rgb;
+            irradiance += radiance * cos(theta) * sin(theta);
             nrSamples++;
         }
     }
@@ -0,0 +1,13 @@
+#version 330 core
+layout (location = 0) in vec2 aUV;
+layout (location = 1) in vec3 aDirection;
+
+out vec3 WorldPos;
+
+// the unfolded octahedron (renderOctahedron) covers the whole map; every triangle interpolates the direction
+// across one octahedron face, which the capture shaders normalize
+void main()
+{
+    WorldPos = aDirection;
+    gl_Position = vec4(aUV * 2.0 - 1.0, 0.0, 1.0);
+}
\ No newline at end of file
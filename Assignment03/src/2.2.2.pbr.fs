@@ -15,6 +15,15 @@ uniform sampler2D aoMap;
 uniform samplerCube irradianceMap;
 uniform samplerCube prefilterMap;
 uniform sampler2D brdfLUT;
+// octahedral 2D versions of the irradiance and pre-filter maps, used instead of the cubemaps when useOctahedralMaps is set
+uniform bool useOctahedralMaps;
+uniform sampler2D irradianceOctahedral;
+uniform sampler2D prefilterOctahedral;
+// L2 spherical harmonics irradiance, used instead of irradianceMap when useSHIrradiance is set
+uniform bool useSHIrradiance;
+uniform vec3 shCoefficients[9];
+// analytic fit of the split-sum BRDF term, used instead of brdfLUT when useAnalyticBRDF is set
+uniform bool useAnalyticBRDF;
 
 // lights
 uniform vec3 lightPositions[4];
@@ -85,6 +94,47 @@ vec3 fresnelSchlickRoughness(float cosTheta, vec3 F0, float roughness)
     return F0 + (max(vec3(1.0 - roughness), F0) - F0) * pow(clamp(1.0 - cosTheta, 0.0, 1.0), 5.0);
 }   
 // ----------------------------------------------------------------------------
+// irradiance / PI from the pre-convolved SH coefficients (same scale as the irradiance cubemap)
+vec3 irradianceSH(vec3 n)
+{
+    vec3 result = shCoefficients[0] * 0.282095
+                + shCoefficients[1] * 0.488603 * n.y
+                + shCoefficients[2] * 0.488603 * n.z
+                + shCoefficients[3] * 0.488603 * n.x
+                + shCoefficients[4] * 1.092548 * n.x * n.y
+                + shCoefficients[5] * 1.092548 * n.y * n.z
+                + shCoefficients[6] * 0.315392 * (3.0 * n.z * n.z - 1.0)
+                + shCoefficients[7] * 1.092548 * n.x * n.z
+                + shCoefficients[8] * 0.546274 * (n.x * n.x - n.y * n.y);
+    return max(result, vec3(0.0));
+}
+// ----------------------------------------------------------------------------
+// octahedral map lookup (ibl_octahedral.h), with an explicit lod since the derivatives jump across the folds
+vec2 octahedralUV(vec3 dir)
+{
+    dir /= abs(dir.x) + abs(dir.y) + abs(dir.z);
+    vec2 signs = vec2(dir.x >= 0.0 ? 1.0 : -1.0, dir.y >= 0.0 ? 1.0 : -1.0);
+    vec2 p = dir.z >= 0.0 ? dir.xy : (1.0 - abs(dir.yx)) * signs;
+    return p * 0.5 + 0.5;
+}
+// ----------------------------------------------------------------------------
+vec3 textureOctahedral(sampler2D map, vec3 dir, float lod)
+{
+    // the map is mirrored across its edges: stay half a texel of the coarser mip inside them
+    float border = min(0.5 * exp2(ceil(lod)) / float(textureSize(map, 0).x), 0.5);
+    return textureLod(map, clamp(octahedralUV(dir), vec2(border), vec2(1.0 - border)), lod).rgb;
+}
+// ----------------------------------------------------------------------------
+// Karis' fit of the split-sum environment BRDF (scale, bias), "Physically Based Shading on Mobile"
+vec2 EnvBRDFApprox(float NdotV, float roughness)
+{
+    const vec4 c0 = vec4(-1.0, -0.0275, -0.572, 0.022);
+    const vec4 c1 = vec4(1.0, 0.0425, 1.04, -0.04);
+    vec4 r = roughness * c0 + c1;
+    float a004 = min(r.x * r.x, exp2(-9.28 * NdotV)) * r.x + r.y;
+    return vec2(-1.04, 1.04) * a004 + r.zw;
+}
+// ----------------------------------------------------------------------------
 void main()
 {		
     // material properties
@@ -142,13 +192,20 @@ void main()
     vec3 kD = 1.0 - kS;
     kD *= 1.0 - metallic;	  
     
-    vec3 irradiance = texture(irradianceMap, N).rgb;
+    vec3 irradiance;
+    if (useSHIrradiance)
+        irradiance = irradianceSH(N);
+    else if (useOctahedralMaps)
+        irradiance = textureOctahedral(irradianceOctahedral, N, 0.0);
+    else
+        irradiance = texture(irradianceMap, N).rgb;
     vec3 diffuse      = irradiance * albedo;
     
     // sample both the pre-filter map and the BRDF lut and combine them together as per the Split-Sum approximation to get the IBL specular part.
     const float MAX_REFLECTION_LOD = 4.0;
-    vec3 prefilteredColor = textureLod(prefilterMap, R,  roughness * MAX_REFLECTION_LOD).rgb;    
-    vec2 brdf  = texture(brdfLUT, vec2(max(dot(N, V), 0.0), roughness)).rg;
+    vec3 prefilteredColor = useOctahedralMaps ? textureOctahedral(prefilterOctahedral, R, roughness * MAX_REFLECTION_LOD)
+                                              : textureLod(prefilterMap, R,  roughness * MAX_REFLECTION_LOD).rgb;    
+    vec2 brdf  = useAnalyticBRDF ? EnvBRDFApprox(max(dot(N, V), 0.0), roughness) : texture(brdfLUT, vec2(max(dot(N, V), 0.0), roughness)).rg;
     vec3 specular = prefilteredColor * (F * brdf.x + brdf.y);
 
     vec3 ambient = (kD * diffuse + specular) * ao;
@@ -1,7 +1,10 @@
 #version 330 core
 layout (location = 0) in vec3 aPos;
-layout (location = 1) in vec3 aNormal;
+layout (location = 1) in vec4 aNormal;
 layout (location = 2) in vec2 aTexCoords;
+// the bounds quantized positions are relative to: per draw from a GeometryArena, otherwise a constant value
+layout (location = 5) in vec3 aPositionOffset;
+layout (location = 6) in vec3 aPositionScale;
 
 out vec2 TexCoords;
 out vec3 WorldPos;
@@ -11,11 +14,35 @@ uniform mat4 projection;
 uniform mat4 view;
 uniform mat4 model;
 
+// packed vertex layouts (vertex_format.h): positions quantized to the mesh bounds, and the normal as it is
+// (0), octahedral (1) or the tangent frame quaternion (2)
+uniform bool quantizedPosition;
+uniform int normalEncoding;
+
+vec3 decodeNormal(vec4 n)
+{
+    if (normalEncoding == 1)
+    {
+        vec3 d = vec3(n.xy, 1.0 - abs(n.x) - abs(n.y));
+        if (d.z < 0.0)
+            d.xy = (1.0 - abs(d.yx)) * vec2(d.x >= 0.0 ? 1.0 : -1.0, d.y >= 0.0 ? 1.0 : -1.0);
+        return normalize(d);
+    }
+    if (normalEncoding == 2)
+    {
+        // third column of the quaternion's rotation; its sign (the handedness) doesn't change it
+        vec4 q = normalize(n);
+        return vec3(2.0 * (q.x * q.z + q.w * q.y), 2.0 * (q.y * q.z - q.w * q.x), 1.0 - 2.0 * (q.x * q.x + q.y * q.y));
+    }
+    return n.xyz;
+}
+
 void main()
 {
+    vec3 position = quantizedPosition ? aPositionOffset + aPos * aPositionScale : aPos;
     TexCoords = aTexCoords;
-    WorldPos = vec3(model * vec4(aPos, 1.0));
-    Normal = mat3(model) * aNormal;   
+    WorldPos = vec3(model * vec4(position, 1.0));
+    Normal = mat3(model) * decodeNormal(aNormal);   
 
     gl_Position =  projection * view * vec4(WorldPos, 1.0);
 }
\ No newline at end of file
@@ -0,0 +1,91 @@
+#version 430 core
+layout (local_size_x = 8, local_size_y = 8) in;
+
+// compute version of 2.2.2.prefilter.fs. The GGX lobe is turned to every texel's own normal, so unlike the
+// irradiance convolution its fetches aren't shared across a workgroup; the sample table they're built from
+// already is, through the uniform buffer.
+uniform int size;
+uniform int rowBegin;
+uniform int rowEnd;
+uniform bool octahedralTarget;
+layout (rgba16f, binding = 0) uniform writeonly imageCube targetCube;
+layout (rgba16f, binding = 1) uniform writeonly image2D targetOctahedral;
+
+uniform samplerCube environmentMap;
+// octahedral environment (IBL_LAYOUT_OCTAHEDRAL)
+uniform bool octahedralSource;
+uniform sampler2D environmentOctahedral;
+
+// GGX samples for the current roughness, see 2.2.2.prefilter.fs
+layout (std140, binding = 0) uniform PrefilterSamples
+{
+    vec4 samples[1024];
+};
+uniform int sampleCount;
+uniform float totalWeight;
+
+// direction through the centre of a texel, see 2.2.2.equirectangular_to_cubemap.cs
+vec3 texelDirection(ivec3 texel)
+{
+    vec2 st = 2.0 * (vec2(texel.xy) + 0.5) / float(size) - 1.0;
+    if (octahedralTarget)
+    {
+        vec3 d = vec3(st, 1.0 - abs(st.x) - abs(st.y));
+        if (d.z < 0.0)
+            d.xy = (1.0 - abs(d.yx)) * vec2(d.x >= 0.0 ? 1.0 : -1.0, d.y >= 0.0 ? 1.0 : -1.0);
+        return d;
+    }
+    if (texel.z == 0) return vec3( 1.0, -st.y, -st.x);
+    if (texel.z == 1) return vec3(-1.0, -st.y,  st.x);
+    if (texel.z == 2) return vec3( st.x,  1.0,  st.y);
+    if (texel.z == 3) return vec3( st.x, -1.0, -st.y);
+    if (texel.z == 4) return vec3( st.x, -st.y,  1.0);
+    return vec3(-st.x, -st.y, -1.0);
+}
+
+void storeTarget(ivec3 texel, vec3 color)
+{
+    if (octahedralTarget)
+        imageStore(targetOctahedral, texel.xy, vec4(color, 1.0));
+    else
+        imageStore(targetCube, texel, vec4(color, 1.0));
+}
+
+// octahedral map lookup, see 2.2.2.pbr.fs
+vec2 octahedralUV(vec3 dir)
+{
+    dir /= abs(dir.x) + abs(dir.y) + abs(dir.z);
+    vec2 signs = vec2(dir.x >= 0.0 ? 1.0 : -1.0, dir.y >= 0.0 ? 1.0 : -1.0);
+    vec2 p = dir.z >= 0.0 ? dir.xy : (1.0 - abs(dir.yx)) * signs;
+    return p * 0.5 + 0.5;
+}
+
+vec3 textureOctahedral(sampler2D map, vec3 dir, float lod)
+{
+    // the map is mirrored across its edges: stay half a texel of the coarser mip inside them
+    float border = min(0.5 * exp2(ceil(lod)) / float(textureSize(map, 0).x), 0.5);
+    return textureLod(map, clamp(octahedralUV(dir), vec2(border), vec2(1.0 - border)), lod).rgb;
+}
+
+void main()
+{
+    ivec3 texel = ivec3(gl_GlobalInvocationID.x, int(gl_GlobalInvocationID.y) + rowBegin, gl_GlobalInvocationID.z);
+    if (texel.x >= size || texel.y >= rowEnd)
+        return;
+    vec3 N = normalize(texelDirection(texel));
+
+    // same tangent frame ImportanceSampleGGX used to build
+    vec3 up        = abs(N.z) < 0.999 ? vec3(0.0, 0.0, 1.0) : vec3(1.0, 0.0, 0.0);
+    vec3 tangent   = normalize(cross(up, N));
+    vec3 bitangent = cross(N, tangent);
+
+    vec3 prefilteredColor = vec3(0.0);
+    for(int i = 0; i < sampleCount; ++i)
+    {
+        vec3 L = tangent * samples[i].x + bitangent * samples[i].y + N * samples[i].z;
+        vec3 radiance = octahedralSource ? textureOctahedral(environmentOctahedral, L, samples[i].w) : textureLod(environmentMap, L, samples[i].w).rgb;
+        prefilteredColor += radiance * samples[i].z;
+    }
+
+    storeTarget(texel, prefilteredColor / totalWeight);
+}
\ No newline at end of file
@@ -3,101 +3,51 @@ out vec4 FragColor;
 in vec3 WorldPos;
 
 uniform samplerCube environmentMap;
-uniform float roughness;
-
-const float PI = 3.14159265359;
-// ----------------------------------------------------------------------------
-float DistributionGGX(vec3 N, vec3 H, float roughness)
+// octahedral environment (IBL_LAYOUT_OCTAHEDRAL)
+uniform bool octahedralSource;
+uniform sampler2D environmentOctahedral;
+
+// GGX samples for the current roughness, generated once per mip on the CPU (see prefilterSamples in
+// ibl_cpu_bake.h): tangent-space light direction in xyz, source mip level in w. Samples with NdotL <= 0
+// are already dropped, and since V = N the NdotL weight of a sample is simply its z.
+layout (std140) uniform PrefilterSamples
 {
-    float a = roughness*roughness;
-    float a2 = a*a;
-    float NdotH = max(dot(N, H), 0.0);
-    float NdotH2 = NdotH*NdotH;
-
-    float nom   = a2;
-    float denom = (NdotH2 * (a2 - 1.0) + 1.0);
-    denom = PI * denom * denom;
+    vec4 samples[1024];
+};
+uniform int sampleCount;
+uniform float totalWeight;
 
-    return nom / denom;
-}
-// ----------------------------------------------------------------------------
-// http://holger.dammertz.org/stuff/notes_HammersleyOnHemisphere.html
-// efficient VanDerCorpus calculation.
-float RadicalInverse_VdC(uint bits) 
+// octahedral map lookup, see 2.2.2.pbr.fs
+vec2 octahedralUV(vec3 dir)
 {
-     bits = (bits << 16u) | (bits >> 16u);
-     bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);
-     bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);
-     bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);
-     bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);
-     return float(bits) * 2.3283064365386963e-10; // / 0x100000000
+    dir /= abs(dir.x) + abs(dir.y) + abs(dir.z);
+    vec2 signs = vec2(dir.x >= 0.0 ? 1.0 : -1.0, dir.y >= 0.0 ? 1.0 : -1.0);
+    vec2 p = dir.z >= 0.0 ? dir.xy : (1.0 - abs(dir.yx)) * signs;
+    return p * 0.5 + 0.5;
 }
-// ----------------------------------------------------------------------------
-vec2 Hammersley(uint i, uint N)
-{
-	return vec2(float(i)/float(N), RadicalInverse_VdC(i));
-}
-// ----------------------------------------------------------------------------
-vec3 ImportanceSampleGGX(vec2 Xi, vec3 N, float roughness)
+
+vec3 textureOctahedral(sampler2D map, vec3 dir, float lod)
 {
-	float a = roughness*roughness;
-	
-	float phi = 2.0 * PI * Xi.x;
-	float cosTheta = sqrt((1.0 - Xi.y) / (1.0 + (a*a - 1.0) * Xi.y));
-	float sinTheta = sqrt(1.0 - cosTheta*cosTheta);
-	
-	// from spherical coordinates to cartesian coordinates - halfway vector
-	vec3 H;
-	H.x = cos(phi) * sinTheta;
-	H.y = sin(phi) * sinTheta;
-	H.z = cosTheta;
-	
-	// from tangent-space H vector to world-space sample vector
-	vec3 up          = abs(N.z) < 0.999 ? vec3(0.0, 0.0, 1.0) : vec3(1.0, 0.0, 0.0);
-	vec3 tangent   = normalize(cross(up, N));
-	vec3 bitangent = cross(N, tangent);
-	
-	vec3 sampleVec = tangent * H.x + bitangent * H.y + N * H.z;
-	return normalize(sampleVec);
+    // the map is mirrored across its edges: stay half a texel of the coarser mip inside them
+    float border = min(0.5 * exp2(ceil(lod)) / float(textureSize(map, 0).x), 0.5);
+    return textureLod(map, clamp(octahedralUV(dir), vec2(border), vec2(1.0 - border)), lod).rgb;
 }
-// ----------------------------------------------------------------------------
+
 void main()
 {		
     vec3 N = normalize(WorldPos);
-    
-    // make the simplyfying assumption that V equals R equals the normal 
-    vec3 R = N;
-    vec3 V = R;
 
-    const uint SAMPLE_COUNT = 1024u;
+    // same tangent frame ImportanceSampleGGX used to build
+    vec3 up        = abs(N.z) < 0.999 ? vec3(0.0, 0.0, 1.0) : vec3(1.0, 0.0, 0.0);
+    vec3 tangent   = normalize(cross(up, N));
+    vec3 bitangent = cross(N, tangent);
+
     vec3 prefilteredColor = vec3(0.0);
-    float totalWeight = 0.0;
-    
-    for(uint i = 0u; i < SAMPLE_COUNT; ++i)
+    for(int i = 0; i < sampleCount; ++i)
     {
-        // generates a sample vector that's biased towards the preferred alignment direction (importance sampling).
-        vec2 Xi = Hammersley(i, SAMPLE_COUNT);
-        vec3 H = ImportanceSampleGGX(Xi, N, roughness);
-        vec3 L  = normalize(2.0 * dot(V, H) * H - V);
-
-        float NdotL = max(dot(N, L), 0.0);
-        if(NdotL > 0.0)
-        {
-            // sample from the environment's mip level based on roughness/pdf
-            float D   = DistributionGGX(N, H, roughness);
-            float NdotH = max(dot(N, H), 0.0);
-            float HdotV = max(dot(H, V), 0.0);
-            float pdf = D * NdotH / (4.0 * HdotV) + 0.0001; 
-
-            float resolution = 512.0; // resolution of source cubemap (per face)
-            float saTexel  = 4.0 * PI / (6.0 * resolution * resolution);
-            float saSample = 1.0 / (float(SAMPLE_COUNT) * pdf + 0.0001);
-
-            float mipLevel = roughness == 0.0 ? 0.0 : 0.5 * log2(saSample / saTexel); 
-            
-            prefilteredColor += textureLod(environmentMap, L, mipLevel).rgb * NdotL;
-            totalWeight      += NdotL;
-        }
+        vec3 L = tangent * samples[i].x + bitangent * samples[i].y + N * samples[i].z;
+        vec3 radiance = octahedralSource ? textureOctahedral(environmentOctahedral, L, samples[i].w) : textureLod(environmentMap, L, samples[i].w).rgb;
+        prefilteredColor += radiance * samples[i].z;
     }
 
     prefilteredColor = prefilteredColor / totalWeight;
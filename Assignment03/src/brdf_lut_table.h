@@ -0,0 +1,524 @@
+#ifndef _BRDF_LUT_TABLE_H_
+#define _BRDF_LUT_TABLE_H_
+
+#pragma once
+
+// generated by IBL_bake --brdf-table (1024 samples per texel), do not edit.
+// split-sum BRDF LUT as RG half floats, x = NdotV, y = roughness.
+const unsigned int BRDF_LUT_TABLE_SIZE = 64;
+const unsigned short BRDF_LUT_TABLE[8192] = {
+    0x28e2, 0x3ba2, 0x2f23, 0x3b16, 0x31c6, 0x3a8c, 0x33d6, 0x3a08, 0x34e2, 0x398d, 0x35c9, 0x391a, 0x36a1, 0x38ae, 0x376b, 0x384a,
+    0x3813, 0x37d8, 0x386b, 0x372a, 0x38bc, 0x3687, 0x3907, 0x35f1, 0x394d, 0x3566, 0x398d, 0x34e5, 0x39c9, 0x346d, 0x3a00, 0x33ff,
+    0x3a33, 0x3335, 0x3a61, 0x327a, 0x3a8c, 0x31d0, 0x3ab3, 0x3133, 0x3ad7, 0x30a4, 0x3af7, 0x3022, 0x3b15, 0x2f56, 0x3b30, 0x2e7e,
+    0x3b48, 0x2dbb, 0x3b5e, 0x2d0b, 0x3b72, 0x2c6b, 0x3b84, 0x2bb9, 0x3b94, 0x2ab9, 0x3ba3, 0x29d3, 0x3baf, 0x2907, 0x3bbb, 0x2852,
+    0x3bc5, 0x2765, 0x3bce, 0x264b, 0x3bd5, 0x2554, 0x3bdc, 0x247c, 0x3be2, 0x2380, 0x3be7, 0x223b, 0x3beb, 0x2124, 0x3bef, 0x2036,
+    0x3bf2, 0x1ed6, 0x3bf5, 0x1d80, 0x3bf7, 0x1c62, 0x3bf9, 0x1ae8, 0x3bfb, 0x1961, 0x3bfc, 0x1822, 0x3bfd, 0x1643, 0x3bfe, 0x14aa,
+    0x3bfe, 0x12d3, 0x3bff, 0x10e4, 0x3bff, 0x0ed8, 0x3bff, 0x0ca8, 0x3c00, 0x0a23, 0x3c00, 0x07ca, 0x3c00, 0x04b9, 0x3c00, 0x02b5,
+    0x3c00, 0x0173, 0x3c00, 0x00b5, 0x3c00, 0x004f, 0x3c00, 0x001d, 0x3c00, 0x0008, 0x3c00, 0x0002, 0x3c00, 0x0000, 0x3c00, 0x0000,
+    0x28ae, 0x3b2b, 0x2f03, 0x3af1, 0x31b5, 0x3a78, 0x33c6, 0x39fb, 0x34db, 0x3984, 0x35c2, 0x3913, 0x369a, 0x38a9, 0x3764, 0x3846,
+    0x3810, 0x37d2, 0x3867, 0x3724, 0x38b9, 0x3683, 0x3904, 0x35ee, 0x394a, 0x3563, 0x398b, 0x34e2, 0x39c6, 0x346c, 0x39fe, 0x33fc,
+    0x3a30, 0x3332, 0x3a5f, 0x3278, 0x3a8a, 0x31ce, 0x3ab1, 0x3132, 0x3ad5, 0x30a3, 0x3af6, 0x3021, 0x3b13, 0x2f54, 0x3b2e, 0x2e7d,
+    0x3b47, 0x2dba, 0x3b5d, 0x2d0a, 0x3b71, 0x2c6b, 0x3b83, 0x2bb8, 0x3b93, 0x2ab7, 0x3ba2, 0x29d3, 0x3bae, 0x2907, 0x3bba, 0x2852,
+    0x3bc4, 0x2764, 0x3bcd, 0x264a, 0x3bd4, 0x2553, 0x3bdb, 0x247b, 0x3be1, 0x237f, 0x3be6, 0x223b, 0x3beb, 0x2124, 0x3bee, 0x2035,
+    0x3bf2, 0x1ed5, 0x3bf4, 0x1d7f, 0x3bf7, 0x1c61, 0x3bf9, 0x1ae7, 0x3bfa, 0x1960, 0x3bfb, 0x1822, 0x3bfc, 0x1643, 0x3bfd, 0x14aa,
+    0x3bfe, 0x12d3, 0x3bfe, 0x10e4, 0x3bff, 0x0ed7, 0x3bff, 0x0ca8, 0x3bff, 0x0a23, 0x3c00, 0x07ca, 0x3c00, 0x04b9, 0x3c00, 0x02b5,
+    0x3c00, 0x0173, 0x3c00, 0x00b5, 0x3c00, 0x004f, 0x3c00, 0x001d, 0x3c00, 0x0008, 0x3c00, 0x0002, 0x3c00, 0x0000, 0x3c00, 0x0000,
+    0x28a2, 0x3a57, 0x2ed2, 0x3aa8, 0x319a, 0x3a4f, 0x33a9, 0x39e0, 0x34cc, 0x3971, 0x35b4, 0x3905, 0x368d, 0x389e, 0x3757, 0x383d,
+    0x380a, 0x37c4, 0x3861, 0x371a, 0x38b3, 0x367b, 0x38ff, 0x35e7, 0x3945, 0x355d, 0x3986, 0x34de, 0x39c2, 0x3468, 0x39f9, 0x33f5,
+    0x3a2c, 0x332d, 0x3a5b, 0x3274, 0x3a86, 0x31ca, 0x3aad, 0x312f, 0x3ad1, 0x30a0, 0x3af2, 0x301f, 0x3b10, 0x2f51, 0x3b2b, 0x2e7a,
+    0x3b44, 0x2db8, 0x3b5a, 0x2d08, 0x3b6f, 0x2c69, 0x3b81, 0x2bb5, 0x3b91, 0x2ab5, 0x3b9f, 0x29d1, 0x3bac, 0x2905, 0x3bb8, 0x2851,
+    0x3bc2, 0x2762, 0x3bcb, 0x2649, 0x3bd3, 0x2552, 0x3bda, 0x247a, 0x3be0, 0x237e, 0x3be5, 0x223a, 0x3be9, 0x2123, 0x3bed, 0x2035,
+    0x3bf1, 0x1ed5, 0x3bf3, 0x1d7f, 0x3bf6, 0x1c61, 0x3bf8, 0x1ae7, 0x3bf9, 0x1960, 0x3bfb, 0x1822, 0x3bfc, 0x1642, 0x3bfd, 0x14aa,
+    0x3bfd, 0x12d3, 0x3bfe, 0x10e4, 0x3bfe, 0x0ed8, 0x3bff, 0x0ca8, 0x3bff, 0x0a24, 0x3bff, 0x07cb, 0x3bff, 0x04ba, 0x3bff, 0x02b6,
+    0x3c00, 0x0173, 0x3c00, 0x00b6, 0x3c00, 0x004f, 0x3c00, 0x001d, 0x3c00, 0x0008, 0x3c00, 0x0002, 0x3c00, 0x0000, 0x3c00, 0x0000,
+    0x2934, 0x3972, 0x2ead, 0x3a3d, 0x317a, 0x3a11, 0x3385, 0x39b8, 0x34ba, 0x3955, 0x35a1, 0x38f0, 0x367a, 0x388e, 0x3744, 0x3830,
+    0x3801, 0x37af, 0x3859, 0x370a, 0x38ab, 0x366e, 0x38f7, 0x35dc, 0x393d, 0x3554, 0x397e, 0x34d6, 0x39bb, 0x3462, 0x39f2, 0x33ec,
+    0x3a26, 0x3325, 0x3a55, 0x326d, 0x3a80, 0x31c5, 0x3aa8, 0x312a, 0x3acc, 0x309d, 0x3aed, 0x301c, 0x3b0b, 0x2f4c, 0x3b27, 0x2e76,
+    0x3b40, 0x2db4, 0x3b56, 0x2d05, 0x3b6b, 0x2c67, 0x3b7d, 0x2bb2, 0x3b8d, 0x2ab3, 0x3b9c, 0x29cf, 0x3ba9, 0x2904, 0x3bb5, 0x2850,
+    0x3bbf, 0x2760, 0x3bc8, 0x2647, 0x3bd0, 0x2551, 0x3bd7, 0x247a, 0x3bde, 0x237d, 0x3be3, 0x2239, 0x3be7, 0x2123, 0x3beb, 0x2035,
+    0x3bef, 0x1ed4, 0x3bf2, 0x1d7f, 0x3bf4, 0x1c61, 0x3bf6, 0x1ae8, 0x3bf8, 0x1961, 0x3bf9, 0x1822, 0x3bfb, 0x1644, 0x3bfc, 0x14ab,
+    0x3bfc, 0x12d5, 0x3bfd, 0x10e6, 0x3bfe, 0x0edb, 0x3bfe, 0x0cab, 0x3bfe, 0x0a27, 0x3bff, 0x07d0, 0x3bff, 0x04bd, 0x3bff, 0x02b8,
+    0x3bff, 0x0175, 0x3bff, 0x00b6, 0x3bff, 0x004f, 0x3c00, 0x001d, 0x3c00, 0x0008, 0x3c00, 0x0002, 0x3c00, 0x0000, 0x3c00, 0x0000,
+    0x2aab, 0x38cf, 0x2eae, 0x39b9, 0x3160, 0x39c0, 0x3361, 0x3981, 0x34a4, 0x392c, 0x358b, 0x38d2, 0x3664, 0x3878, 0x372e, 0x381f,
+    0x37ec, 0x3794, 0x384e, 0x36f2, 0x38a0, 0x365b, 0x38ec, 0x35cc, 0x3933, 0x3547, 0x3974, 0x34cb, 0x39b1, 0x3459, 0x39e9, 0x33de,
+    0x3a1d, 0x331a, 0x3a4d, 0x3264, 0x3a78, 0x31bd, 0x3aa0, 0x3124, 0x3ac5, 0x3098, 0x3ae6, 0x3018, 0x3b05, 0x2f45, 0x3b21, 0x2e71,
+    0x3b3a, 0x2db0, 0x3b51, 0x2d02, 0x3b65, 0x2c64, 0x3b78, 0x2bae, 0x3b89, 0x2ab0, 0x3b98, 0x29cc, 0x3ba5, 0x2902, 0x3bb1, 0x284e,
+    0x3bbb, 0x275f, 0x3bc5, 0x2646, 0x3bcd, 0x2550, 0x3bd4, 0x2479, 0x3bdb, 0x237d, 0x3be0, 0x2239, 0x3be5, 0x2123, 0x3be9, 0x2035,
+    0x3bed, 0x1ed6, 0x3bf0, 0x1d81, 0x3bf2, 0x1c63, 0x3bf4, 0x1aea, 0x3bf6, 0x1963, 0x3bf8, 0x1825, 0x3bf9, 0x1648, 0x3bfa, 0x14af,
+    0x3bfb, 0x12db, 0x3bfc, 0x10ea, 0x3bfd, 0x0ee2, 0x3bfd, 0x0cb0, 0x3bfd, 0x0a30, 0x3bfe, 0x07dc, 0x3bfe, 0x04c6, 0x3bfe, 0x02be,
+    0x3bff, 0x0178, 0x3bff, 0x00b9, 0x3bff, 0x0050, 0x3bff, 0x001e, 0x3bff, 0x0009, 0x3c00, 0x0002, 0x3c00, 0x0000, 0x3c00, 0x0000,
+    0x2c7f, 0x386f, 0x2eee, 0x3930, 0x3155, 0x395e, 0x3342, 0x393c, 0x3491, 0x38fb, 0x3574, 0x38ac, 0x364b, 0x3859, 0x3714, 0x3807,
+    0x37d1, 0x376e, 0x3841, 0x36d6, 0x3894, 0x3644, 0x38e0, 0x35ba, 0x3927, 0x3538, 0x3969, 0x34bf, 0x39a6, 0x344e, 0x39de, 0x33cb,
+    0x3a12, 0x330a, 0x3a42, 0x3257, 0x3a6e, 0x31b2, 0x3a97, 0x311b, 0x3abc, 0x3090, 0x3ade, 0x3012, 0x3afd, 0x2f3d, 0x3b19, 0x2e6b,
+    0x3b33, 0x2dab, 0x3b4a, 0x2cfe, 0x3b5f, 0x2c61, 0x3b72, 0x2ba9, 0x3b83, 0x2aac, 0x3b92, 0x29ca, 0x3ba0, 0x2901, 0x3bac, 0x284d,
+    0x3bb7, 0x275e, 0x3bc0, 0x2646, 0x3bc9, 0x2551, 0x3bd0, 0x247a, 0x3bd7, 0x237e, 0x3bdd, 0x223b, 0x3be2, 0x2125, 0x3be6, 0x2037,
+    0x3bea, 0x1eda, 0x3bed, 0x1d85, 0x3bf0, 0x1c66, 0x3bf2, 0x1af1, 0x3bf4, 0x1969, 0x3bf6, 0x182a, 0x3bf7, 0x1651, 0x3bf9, 0x14b6,
+    0x3bfa, 0x12e7, 0x3bfa, 0x10f4, 0x3bfb, 0x0ef1, 0x3bfc, 0x0cbc, 0x3bfc, 0x0a42, 0x3bfd, 0x07f6, 0x3bfd, 0x04d8, 0x3bfe, 0x02ca,
+    0x3bfe, 0x0180, 0x3bfe, 0x00bd, 0x3bff, 0x0053, 0x3bff, 0x001f, 0x3bff, 0x0009, 0x3bff, 0x0002, 0x3c00, 0x0000, 0x3c00, 0x0000,
+    0x2dff, 0x3839, 0x2f78, 0x38b2, 0x3161, 0x38f6, 0x3330, 0x38ed, 0x347f, 0x38be, 0x355e, 0x387e, 0x3632, 0x3836, 0x36fa, 0x37d6,
+    0x37b6, 0x3740, 0x3833, 0x36ae, 0x3885, 0x3624, 0x38d2, 0x359f, 0x3919, 0x3524, 0x395c, 0x34af, 0x3999, 0x3442, 0x39d2, 0x33b7,
+    0x3a07, 0x32f9, 0x3a37, 0x3249, 0x3a63, 0x31a7, 0x3a8c, 0x3112, 0x3ab2, 0x3089, 0x3ad4, 0x300b, 0x3af3, 0x2f31, 0x3b10, 0x2e60,
+    0x3b2a, 0x2da3, 0x3b41, 0x2cf7, 0x3b56, 0x2c5c, 0x3b6a, 0x2ba0, 0x3b7b, 0x2aa7, 0x3b8b, 0x29c8, 0x3b99, 0x28ff, 0x3ba6, 0x284d,
+    0x3bb1, 0x275e, 0x3bbb, 0x2647, 0x3bc4, 0x2552, 0x3bcc, 0x247c, 0x3bd2, 0x2383, 0x3bd8, 0x2240, 0x3bde, 0x212a, 0x3be2, 0x203c,
+    0x3be6, 0x1ee3, 0x3bea, 0x1d8c, 0x3bed, 0x1c6d, 0x3bef, 0x1afe, 0x3bf2, 0x1974, 0x3bf3, 0x1834, 0x3bf5, 0x1661, 0x3bf6, 0x14c4,
+    0x3bf8, 0x12fe, 0x3bf9, 0x1106, 0x3bfa, 0x0f0f, 0x3bfa, 0x0cd3, 0x3bfb, 0x0a64, 0x3bfc, 0x0815, 0x3bfc, 0x04fc, 0x3bfd, 0x02e3,
+    0x3bfd, 0x0191, 0x3bfe, 0x00c7, 0x3bfe, 0x0059, 0x3bfe, 0x0022, 0x3bff, 0x000a, 0x3bff, 0x0002, 0x3c00, 0x0000, 0x3c00, 0x0000,
+    0x2fbd, 0x3816, 0x3028, 0x384a, 0x3188, 0x388e, 0x332f, 0x3898, 0x3472, 0x387a, 0x3549, 0x3847, 0x3619, 0x380a, 0x36de, 0x3791,
+    0x3799, 0x370a, 0x3824, 0x3682, 0x3876, 0x3600, 0x38c3, 0x3582, 0x390a, 0x350a, 0x394c, 0x3499, 0x398a, 0x342f, 0x39c3, 0x3399,
+    0x39f8, 0x32e2, 0x3a29, 0x3238, 0x3a57, 0x3199, 0x3a80, 0x3107, 0x3aa6, 0x3080, 0x3ac9, 0x3004, 0x3ae8, 0x2f26, 0x3b05, 0x2e58,
+    0x3b20, 0x2d9c, 0x3b38, 0x2cf2, 0x3b4e, 0x2c58, 0x3b61, 0x2b9b, 0x3b73, 0x2aa2, 0x3b83, 0x29c2, 0x3b91, 0x28fb, 0x3b9e, 0x2849,
+    0x3baa, 0x2758, 0x3bb4, 0x2643, 0x3bbd, 0x254f, 0x3bc5, 0x247a, 0x3bcd, 0x2385, 0x3bd3, 0x2246, 0x3bd9, 0x2131, 0x3bde, 0x2043,
+    0x3be2, 0x1ef0, 0x3be6, 0x1d99, 0x3be9, 0x1c79, 0x3bec, 0x1b13, 0x3bee, 0x1987, 0x3bf1, 0x1844, 0x3bf2, 0x167d, 0x3bf4, 0x14db,
+    0x3bf5, 0x1325, 0x3bf7, 0x1126, 0x3bf8, 0x0f42, 0x3bf9, 0x0cfb, 0x3bfa, 0x0aa2, 0x3bfa, 0x0843, 0x3bfb, 0x0541, 0x3bfc, 0x0314,
+    0x3bfc, 0x01b2, 0x3bfd, 0x00dd, 0x3bfd, 0x0066, 0x3bfe, 0x0029, 0x3bfe, 0x000e, 0x3bff, 0x0004, 0x3bff, 0x0001, 0x3c00, 0x0000,
+    0x30d2, 0x37f2, 0x30b4, 0x37ef, 0x31cd, 0x382e, 0x3345, 0x3841, 0x346e, 0x3833, 0x353b, 0x380d, 0x3604, 0x37b5, 0x36c4, 0x3741,
+    0x377b, 0x36c7, 0x3814, 0x364e, 0x3866, 0x35d5, 0x38b2, 0x355e, 0x38fa, 0x34ed, 0x393c, 0x3482, 0x397a, 0x341c, 0x39b3, 0x3377,
+    0x39e8, 0x32c4, 0x3a1a, 0x321f, 0x3a47, 0x3184, 0x3a71, 0x30f6, 0x3a97, 0x3072, 0x3abb, 0x2ff6, 0x3adc, 0x2f19, 0x3afa, 0x2e4e,
+    0x3b14, 0x2d95, 0x3b2d, 0x2ced, 0x3b43, 0x2c54, 0x3b58, 0x2b96, 0x3b6a, 0x2a9f, 0x3b7a, 0x29c1, 0x3b89, 0x28fb, 0x3b96, 0x284a,
+    0x3ba2, 0x275b, 0x3bad, 0x2647, 0x3bb6, 0x2553, 0x3bbf, 0x247e, 0x3bc6, 0x2389, 0x3bcd, 0x2247, 0x3bd3, 0x2132, 0x3bd8, 0x2044,
+    0x3bdd, 0x1ef2, 0x3be1, 0x1d9b, 0x3be4, 0x1c7b, 0x3be7, 0x1b15, 0x3bea, 0x1998, 0x3bed, 0x1859, 0x3bef, 0x16a4, 0x3bf1, 0x14fe,
+    0x3bf3, 0x1361, 0x3bf4, 0x1159, 0x3bf6, 0x0f95, 0x3bf7, 0x0d3f, 0x3bf8, 0x0b0d, 0x3bf9, 0x0896, 0x3bfa, 0x05be, 0x3bfa, 0x036f,
+    0x3bfb, 0x01f3, 0x3bfc, 0x0109, 0x3bfd, 0x0083, 0x3bfd, 0x003b, 0x3bfe, 0x0018, 0x3bff, 0x0009, 0x3bff, 0x0003, 0x3c00, 0x0001,
+    0x31d3, 0x37b9, 0x315e, 0x376b, 0x3230, 0x37b4, 0x3374, 0x37dc, 0x3474, 0x37d2, 0x3534, 0x379d, 0x35f3, 0x374c, 0x36ad, 0x36ea,
+    0x3760, 0x367f, 0x3805, 0x3611, 0x3855, 0x35a1, 0x38a1, 0x3535, 0x38e9, 0x34cc, 0x392b, 0x3466, 0x3969, 0x3404, 0x39a2, 0x3352,
+    0x39d8, 0x32a7, 0x3a0a, 0x3206, 0x3a37, 0x316f, 0x3a61, 0x30e4, 0x3a88, 0x3063, 0x3aac, 0x2fdb, 0x3acd, 0x2f02, 0x3aeb, 0x2e3b,
+    0x3b06, 0x2d86, 0x3b20, 0x2ce2, 0x3b37, 0x2c4f, 0x3b4c, 0x2b8f, 0x3b5f, 0x2a9b, 0x3b70, 0x29c0, 0x3b80, 0x28fb, 0x3b8d, 0x284c,
+    0x3b9a, 0x2760, 0x3ba5, 0x264d, 0x3baf, 0x255a, 0x3bb8, 0x2485, 0x3bc0, 0x2397, 0x3bc7, 0x2255, 0x3bcd, 0x213f, 0x3bd3, 0x2050,
+    0x3bd7, 0x1f08, 0x3bdc, 0x1daf, 0x3be0, 0x1c8d, 0x3be3, 0x1b36, 0x3be6, 0x19a6, 0x3be9, 0x185e, 0x3beb, 0x16aa, 0x3bed, 0x1501,
+    0x3bef, 0x1362, 0x3bf1, 0x1157, 0x3bf2, 0x0f8f, 0x3bf4, 0x0d74, 0x3bf6, 0x0b9a, 0x3bf7, 0x0912, 0x3bf8, 0x0688, 0x3bf9, 0x040d,
+    0x3bfa, 0x026a, 0x3bfb, 0x015f, 0x3bfc, 0x00bf, 0x3bfd, 0x0062, 0x3bfd, 0x0030, 0x3bfe, 0x0016, 0x3bff, 0x0009, 0x3c00, 0x0003,
+    0x32dc, 0x377b, 0x321e, 0x36ff, 0x32af, 0x3723, 0x33be, 0x3744, 0x3484, 0x3741, 0x3535, 0x371d, 0x35e9, 0x36dd, 0x369c, 0x368e,
+    0x3748, 0x3630, 0x37ee, 0x35ce, 0x3846, 0x3569, 0x3890, 0x3505, 0x38d6, 0x34a3, 0x3919, 0x3444, 0x3957, 0x33d3, 0x3991, 0x3326,
+    0x39c6, 0x3281, 0x39f8, 0x31e6, 0x3a26, 0x3156, 0x3a51, 0x30d1, 0x3a78, 0x3054, 0x3a9c, 0x2fc2, 0x3abe, 0x2eed, 0x3adc, 0x2e2a,
+    0x3af8, 0x2d78, 0x3b12, 0x2cd7, 0x3b29, 0x2c44, 0x3b3e, 0x2b7e, 0x3b52, 0x2a8d, 0x3b63, 0x29b5, 0x3b73, 0x28f5, 0x3b82, 0x284a,
+    0x3b90, 0x2764, 0x3b9c, 0x2653, 0x3ba6, 0x2562, 0x3bb0, 0x248e, 0x3bb8, 0x23aa, 0x3bc0, 0x2268, 0x3bc6, 0x2151, 0x3bcc, 0x2061,
+    0x3bd2, 0x1f28, 0x3bd6, 0x1dcc, 0x3bdb, 0x1ca7, 0x3bde, 0x1b64, 0x3be2, 0x19ce, 0x3be5, 0x1881, 0x3be7, 0x16e5, 0x3bea, 0x1533,
+    0x3bec, 0x13b5, 0x3bee, 0x119b, 0x3bef, 0x0ffb, 0x3bf1, 0x0d8b, 0x3bf2, 0x0b7e, 0x3bf4, 0x08e6, 0x3bf5, 0x062a, 0x3bf6, 0x03b5,
+    0x3bf7, 0x021d, 0x3bf9, 0x01b8, 0x3bfa, 0x011e, 0x3bfc, 0x00ad, 0x3bfd, 0x0063, 0x3bfe, 0x0035, 0x3bfe, 0x0019, 0x3bff, 0x000a,
+    0x33ea, 0x3737, 0x32f0, 0x36a2, 0x3345, 0x36a6, 0x3410, 0x36ba, 0x34a0, 0x36b9, 0x3540, 0x369e, 0x35e7, 0x366d, 0x368f, 0x362b,
+    0x3735, 0x35dd, 0x37d5, 0x3586, 0x3837, 0x352c, 0x3880, 0x34d2, 0x38c5, 0x3477, 0x3906, 0x341e, 0x3944, 0x3393, 0x397d, 0x32ef,
+    0x39b3, 0x3255, 0x39e5, 0x31c3, 0x3a14, 0x313a, 0x3a3f, 0x30b9, 0x3a66, 0x3040, 0x3a8b, 0x2fa1, 0x3aad, 0x2ed5, 0x3acc, 0x2e19,
+    0x3ae9, 0x2d6b, 0x3b03, 0x2ccc, 0x3b1b, 0x2c3c, 0x3b31, 0x2b70, 0x3b44, 0x2a83, 0x3b56, 0x29af, 0x3b67, 0x28f1, 0x3b76, 0x2846,
+    0x3b84, 0x275c, 0x3b90, 0x264d, 0x3b9b, 0x255d, 0x3ba5, 0x248d, 0x3bae, 0x23b2, 0x3bb7, 0x2275, 0x3bbe, 0x2163, 0x3bc5, 0x2074,
+    0x3bcb, 0x1f4e, 0x3bd0, 0x1df0, 0x3bd5, 0x1cc8, 0x3bd9, 0x1ba0, 0x3bdd, 0x1a04, 0x3be0, 0x18b0, 0x3be3, 0x1736, 0x3be6, 0x1578,
+    0x3be8, 0x1414, 0x3bea, 0x11fb, 0x3bec, 0x104b, 0x3bee, 0x0e08, 0x3bf0, 0x0c20, 0x3bf2, 0x097b, 0x3bf3, 0x070a, 0x3bf4, 0x0458,
+    0x3bf6, 0x028f, 0x3bf7, 0x016e, 0x3bf8, 0x00c0, 0x3bf9, 0x005e, 0x3bfa, 0x002b, 0x3bfc, 0x005c, 0x3bfe, 0x003e, 0x3bff, 0x001f,
+    0x347c, 0x36ef, 0x33cf, 0x364e, 0x33ed, 0x3639, 0x344c, 0x363e, 0x34c6, 0x363b, 0x3555, 0x3625, 0x35ee, 0x35fe, 0x368a, 0x35c7,
+    0x3727, 0x3585, 0x37c0, 0x353b, 0x382a, 0x34ed, 0x3871, 0x349a, 0x38b4, 0x3447, 0x38f5, 0x33ed, 0x3931, 0x334e, 0x396a, 0x32b4,
+    0x399f, 0x3223, 0x39d1, 0x3198, 0x39ff, 0x3115, 0x3a2b, 0x309c, 0x3a53, 0x3029, 0x3a79, 0x2f7f, 0x3a9b, 0x2eb9, 0x3abb, 0x2e00,
+    0x3ad7, 0x2d57, 0x3af2, 0x2cbd, 0x3b0b, 0x2c32, 0x3b22, 0x2b66, 0x3b37, 0x2a7e, 0x3b49, 0x29ab, 0x3b5a, 0x28ee, 0x3b69, 0x2844,
+    0x3b77, 0x275a, 0x3b84, 0x264f, 0x3b90, 0x2563, 0x3b9a, 0x2495, 0x3ba4, 0x23bd, 0x3bac, 0x227d, 0x3bb4, 0x2167, 0x3bbb, 0x2077,
+    0x3bc1, 0x1f53, 0x3bc7, 0x1e02, 0x3bcd, 0x1cdf, 0x3bd1, 0x1bcf, 0x3bd6, 0x1a3c, 0x3bda, 0x18e6, 0x3bde, 0x1799, 0x3be1, 0x15cf,
+    0x3be4, 0x1460, 0x3be6, 0x127b, 0x3be9, 0x10b6, 0x3beb, 0x0eb6, 0x3bed, 0x0cac, 0x3bef, 0x0a57, 0x3bf1, 0x082e, 0x3bf2, 0x0556,
+    0x3bf4, 0x0349, 0x3bf5, 0x01f1, 0x3bf7, 0x011a, 0x3bf8, 0x0099, 0x3bf9, 0x0050, 0x3bfa, 0x002a, 0x3bfb, 0x0017, 0x3bfc, 0x0027,
+    0x3501, 0x36a2, 0x345b, 0x3600, 0x3452, 0x35d8, 0x3491, 0x35d0, 0x34f7, 0x35c9, 0x3573, 0x35b4, 0x35fd, 0x3593, 0x368d, 0x3565,
+    0x371f, 0x352d, 0x37b0, 0x34ed, 0x381e, 0x34a7, 0x3863, 0x345f, 0x38a5, 0x3416, 0x38e3, 0x3396, 0x391f, 0x3303, 0x3957, 0x3277,
+    0x398c, 0x31ef, 0x39bd, 0x316b, 0x39eb, 0x30ef, 0x3a16, 0x307b, 0x3a3e, 0x300d, 0x3a64, 0x2f4e, 0x3a87, 0x2e93, 0x3aa7, 0x2de3,
+    0x3ac5, 0x2d43, 0x3ae1, 0x2cae, 0x3afa, 0x2c25, 0x3b11, 0x2b50, 0x3b26, 0x2a6c, 0x3b39, 0x29a1, 0x3b4c, 0x28ea, 0x3b5c, 0x2845,
+    0x3b6b, 0x2762, 0x3b78, 0x2658, 0x3b84, 0x256c, 0x3b8f, 0x249c, 0x3b99, 0x23ca, 0x3ba2, 0x228a, 0x3baa, 0x2178, 0x3bb2, 0x208b,
+    0x3bb9, 0x1f80, 0x3bbf, 0x1e22, 0x3bc4, 0x1cf7, 0x3bc9, 0x1bf6, 0x3bce, 0x1a50, 0x3bd2, 0x18f4, 0x3bd6, 0x17bb, 0x3bda, 0x1604,
+    0x3bdd, 0x1497, 0x3be1, 0x12de, 0x3be4, 0x1127, 0x3be7, 0x0f87, 0x3be9, 0x0d60, 0x3bec, 0x0b80, 0x3bee, 0x091d, 0x3bf0, 0x06cb,
+    0x3bf1, 0x0465, 0x3bf3, 0x02c4, 0x3bf5, 0x01b1, 0x3bf6, 0x0102, 0x3bf5, 0x0093, 0x3bf7, 0x0052, 0x3bf9, 0x002b, 0x3bfa, 0x0016,
+    0x3583, 0x3653, 0x34d0, 0x35b5, 0x34b3, 0x3581, 0x34dd, 0x356d, 0x3530, 0x355f, 0x359b, 0x354c, 0x3615, 0x352e, 0x3697, 0x3506,
+    0x371e, 0x34d6, 0x37a5, 0x349f, 0x3816, 0x3462, 0x3857, 0x3421, 0x3896, 0x33be, 0x38d3, 0x333a, 0x390d, 0x32b5, 0x3944, 0x3231,
+    0x3978, 0x31b3, 0x39a9, 0x313a, 0x39d7, 0x30c6, 0x3a02, 0x3058, 0x3a2a, 0x2fdf, 0x3a4f, 0x2f1e, 0x3a72, 0x2e69, 0x3a92, 0x2dbf,
+    0x3ab0, 0x2d24, 0x3acc, 0x2c95, 0x3ae6, 0x2c12, 0x3afe, 0x2b36, 0x3b15, 0x2a5c, 0x3b29, 0x2995, 0x3b3b, 0x28e1, 0x3b4c, 0x283d,
+    0x3b5b, 0x2756, 0x3b69, 0x2655, 0x3b76, 0x2570, 0x3b82, 0x24a6, 0x3b8d, 0x23e4, 0x3b97, 0x22a7, 0x3b9f, 0x2191, 0x3ba7, 0x20a1,
+    0x3bae, 0x1fa2, 0x3bb5, 0x1e3f, 0x3bbb, 0x1d13, 0x3bc1, 0x1c19, 0x3bc6, 0x1a91, 0x3bcb, 0x1934, 0x3bcf, 0x1811, 0x3bd3, 0x1645,
+    0x3bd6, 0x14c4, 0x3bd9, 0x1320, 0x3bdc, 0x113d, 0x3be0, 0x0fc1, 0x3be2, 0x0d9d, 0x3be5, 0x0c14, 0x3be8, 0x09b6, 0x3bea, 0x0807,
+    0x3bec, 0x05ac, 0x3bed, 0x03d5, 0x3bef, 0x0285, 0x3bf1, 0x019e, 0x3bf3, 0x0102, 0x3bf5, 0x009c, 0x3bf7, 0x005a, 0x3bf9, 0x0031,
+    0x3602, 0x3603, 0x3546, 0x356d, 0x3518, 0x3531, 0x352f, 0x3515, 0x3570, 0x3501, 0x35ca, 0x34ec, 0x3635, 0x34d0, 0x36aa, 0x34ad,
+    0x3725, 0x3482, 0x37a2, 0x3452, 0x3810, 0x341c, 0x384d, 0x33c6, 0x388a, 0x3351, 0x38c4, 0x32d7, 0x38fc, 0x3260, 0x3932, 0x31ea,
+    0x3965, 0x3176, 0x3995, 0x3104, 0x39c2, 0x3097, 0x39ed, 0x3031, 0x3a15, 0x2fa0, 0x3a3b, 0x2ee9, 0x3a5d, 0x2e3b, 0x3a7e, 0x2d9a,
+    0x3a9c, 0x2d06, 0x3ab8, 0x2c7c, 0x3ad2, 0x2bf9, 0x3aea, 0x2b11, 0x3b00, 0x2a3d, 0x3b15, 0x297e, 0x3b28, 0x28d1, 0x3b3a, 0x2836,
+    0x3b4a, 0x2750, 0x3b59, 0x2650, 0x3b66, 0x256c, 0x3b72, 0x24a2, 0x3b7d, 0x23df, 0x3b88, 0x22ac, 0x3b92, 0x219f, 0x3b9b, 0x20b6,
+    0x3ba3, 0x1fd1, 0x3baa, 0x1e6f, 0x3bb1, 0x1d3f, 0x3bb7, 0x1c3d, 0x3bbc, 0x1ac7, 0x3bc1, 0x195c, 0x3bc5, 0x1831, 0x3bca, 0x1689,
+    0x3bce, 0x1503, 0x3bd2, 0x13ac, 0x3bd5, 0x11bc, 0x3bd8, 0x1033, 0x3bda, 0x0e07, 0x3bdb, 0x0c3b, 0x3bde, 0x09cc, 0x3be1, 0x0816,
+    0x3be4, 0x0598, 0x3be7, 0x03cb, 0x3be9, 0x02ab, 0x3bec, 0x01bf, 0x3bef, 0x0150, 0x3bf2, 0x00db, 0x3bf4, 0x007f, 0x3bf6, 0x003f,
+    0x367b, 0x35b3, 0x35ba, 0x3527, 0x357d, 0x34e7, 0x3585, 0x34c4, 0x35b5, 0x34ac, 0x3600, 0x3494, 0x365c, 0x347a, 0x36c4, 0x3459,
+    0x3732, 0x3433, 0x37a5, 0x3408, 0x380c, 0x33b0, 0x3846, 0x334b, 0x387f, 0x32e2, 0x38b7, 0x3276, 0x38ed, 0x3209, 0x3920, 0x319c,
+    0x3952, 0x3133, 0x3981, 0x30cc, 0x39ae, 0x3069, 0x39d8, 0x3008, 0x39ff, 0x2f58, 0x3a25, 0x2eac, 0x3a48, 0x2e0b, 0x3a69, 0x2d73,
+    0x3a87, 0x2ce6, 0x3aa3, 0x2c61, 0x3abe, 0x2bce, 0x3ad6, 0x2af1, 0x3aed, 0x2a24, 0x3b02, 0x2968, 0x3b15, 0x28bd, 0x3b27, 0x2825,
+    0x3b37, 0x2737, 0x3b47, 0x263f, 0x3b55, 0x2566, 0x3b63, 0x24a5, 0x3b6f, 0x23ed, 0x3b7a, 0x22b8, 0x3b83, 0x21a7, 0x3b8c, 0x20b9,
+    0x3b94, 0x1fd5, 0x3b9c, 0x1e7f, 0x3ba4, 0x1d5a, 0x3bab, 0x1c5f, 0x3bb1, 0x1b12, 0x3bb7, 0x19a5, 0x3bbc, 0x1874, 0x3bc0, 0x16f0,
+    0x3bc3, 0x1555, 0x3bc5, 0x1409, 0x3bc9, 0x1203, 0x3bcd, 0x107e, 0x3bd1, 0x0e8a, 0x3bd5, 0x0cce, 0x3bd8, 0x0acd, 0x3bdb, 0x08ab,
+    0x3bde, 0x0639, 0x3be1, 0x0402, 0x3be4, 0x028e, 0x3be7, 0x01cf, 0x3be9, 0x011f, 0x3bec, 0x00c4, 0x3bef, 0x0078, 0x3bf3, 0x0053,
+    0x36ef, 0x3564, 0x362c, 0x34e3, 0x35e4, 0x34a1, 0x35dd, 0x347a, 0x35ff, 0x345e, 0x363b, 0x3444, 0x3689, 0x3429, 0x36e4, 0x340c,
+    0x3747, 0x33d1, 0x37af, 0x3383, 0x380d, 0x332f, 0x3843, 0x32d4, 0x3878, 0x3276, 0x38ad, 0x3215, 0x38e0, 0x31b3, 0x3912, 0x3152,
+    0x3941, 0x30f0, 0x396f, 0x3091, 0x399b, 0x3035, 0x39c4, 0x2fbb, 0x39ec, 0x2f12, 0x3a10, 0x2e6f, 0x3a33, 0x2dd6, 0x3a53, 0x2d46,
+    0x3a72, 0x2cc0, 0x3a8f, 0x2c45, 0x3aaa, 0x2ba4, 0x3ac3, 0x2acd, 0x3ada, 0x2a08, 0x3aef, 0x2953, 0x3b03, 0x28b1, 0x3b15, 0x281c,
+    0x3b26, 0x2729, 0x3b35, 0x2635, 0x3b44, 0x255d, 0x3b52, 0x249e, 0x3b5e, 0x23e6, 0x3b69, 0x22b8, 0x3b74, 0x21b3, 0x3b7e, 0x20cd,
+    0x3b87, 0x2003, 0x3b90, 0x1ea7, 0x3b97, 0x1d77, 0x3b9d, 0x1c73, 0x3ba3, 0x1b2f, 0x3ba7, 0x19c9, 0x3bad, 0x18a1, 0x3bb3, 0x1751,
+    0x3bb8, 0x15b9, 0x3bbe, 0x146c, 0x3bc2, 0x12b6, 0x3bc7, 0x1101, 0x3bcb, 0x0f54, 0x3bce, 0x0d42, 0x3bd2, 0x0b83, 0x3bd6, 0x0957,
+    0x3bd9, 0x0793, 0x3bdd, 0x0548, 0x3be0, 0x037f, 0x3be3, 0x0235, 0x3be6, 0x0153, 0x3be9, 0x00e6, 0x3bec, 0x008d, 0x3bee, 0x0050,
+    0x375e, 0x3516, 0x369b, 0x34a1, 0x3649, 0x345f, 0x3636, 0x3435, 0x364b, 0x3416, 0x367a, 0x33f6, 0x36bb, 0x33c0, 0x370a, 0x3385,
+    0x3762, 0x3347, 0x37bf, 0x32ff, 0x3810, 0x32b3, 0x3842, 0x3263, 0x3873, 0x320d, 0x38a5, 0x31b6, 0x38d5, 0x315d, 0x3904, 0x3105,
+    0x3932, 0x30ac, 0x395e, 0x3056, 0x3988, 0x3001, 0x39b0, 0x2f5f, 0x39d7, 0x2ec3, 0x39fc, 0x2e2e, 0x3a1e, 0x2da0, 0x3a3e, 0x2d19,
+    0x3a5d, 0x2c9a, 0x3a79, 0x2c24, 0x3a94, 0x2b6a, 0x3aad, 0x2aa1, 0x3ac5, 0x29e7, 0x3adb, 0x293c, 0x3aef, 0x289e, 0x3b02, 0x280f,
+    0x3b13, 0x2717, 0x3b24, 0x262f, 0x3b33, 0x255c, 0x3b41, 0x249e, 0x3b4d, 0x23e8, 0x3b59, 0x22be, 0x3b64, 0x21b9, 0x3b6d, 0x20d3,
+    0x3b76, 0x200b, 0x3b7e, 0x1ebe, 0x3b85, 0x1d99, 0x3b8d, 0x1c9a, 0x3b95, 0x1b7e, 0x3b9c, 0x1a07, 0x3ba2, 0x18cb, 0x3ba8, 0x178e,
+    0x3bae, 0x15ec, 0x3bb3, 0x14a5, 0x3bb9, 0x132d, 0x3bbe, 0x1179, 0x3bc3, 0x101d, 0x3bc7, 0x0e08, 0x3bcb, 0x0c53, 0x3bcf, 0x0a0e,
+    0x3bd3, 0x0837, 0x3bd7, 0x05d8, 0x3bda, 0x0419, 0x3bde, 0x02e4, 0x3be2, 0x01f3, 0x3be4, 0x012e, 0x3be6, 0x00a0, 0x3bea, 0x0066,
+    0x37c6, 0x34cb, 0x3705, 0x3460, 0x36ad, 0x3420, 0x368f, 0x33eb, 0x3698, 0x33a9, 0x36bc, 0x3371, 0x36f1, 0x3339, 0x3734, 0x3301,
+    0x3781, 0x32c3, 0x37d5, 0x3285, 0x3816, 0x323f, 0x3843, 0x31f5, 0x3871, 0x31a9, 0x389f, 0x315a, 0x38cc, 0x310a, 0x38f9, 0x30b9,
+    0x3924, 0x3069, 0x394f, 0x301a, 0x3977, 0x2f99, 0x399e, 0x2f04, 0x39c4, 0x2e73, 0x39e7, 0x2de7, 0x3a09, 0x2d64, 0x3a29, 0x2ce7,
+    0x3a48, 0x2c72, 0x3a64, 0x2c03, 0x3a7f, 0x2b34, 0x3a98, 0x2a73, 0x3aaf, 0x29bf, 0x3ac5, 0x291a, 0x3ada, 0x2886, 0x3aed, 0x27fb,
+    0x3b00, 0x2703, 0x3b10, 0x261f, 0x3b1f, 0x2553, 0x3b2d, 0x249a, 0x3b3a, 0x23ee, 0x3b46, 0x22cc, 0x3b4f, 0x21c7, 0x3b59, 0x20e1,
+    0x3b64, 0x2019, 0x3b6e, 0x1edd, 0x3b77, 0x1db1, 0x3b7f, 0x1cac, 0x3b87, 0x1bac, 0x3b8f, 0x1a43, 0x3b97, 0x190e, 0x3b9d, 0x1806,
+    0x3ba3, 0x1656, 0x3ba9, 0x14ed, 0x3baf, 0x138b, 0x3bb4, 0x11b7, 0x3bb9, 0x1050, 0x3bbe, 0x0e8e, 0x3bc3, 0x0cd7, 0x3bc8, 0x0b2f,
+    0x3bcc, 0x0924, 0x3bd0, 0x071d, 0x3bd3, 0x04bf, 0x3bd6, 0x0307, 0x3bda, 0x0210, 0x3bdd, 0x015f, 0x3be2, 0x00f1, 0x3be5, 0x0082,
+    0x3814, 0x3483, 0x376c, 0x3422, 0x370e, 0x33c9, 0x36e8, 0x3373, 0x36e7, 0x332f, 0x36ff, 0x32f4, 0x372a, 0x32bd, 0x3762, 0x3286,
+    0x37a4, 0x324d, 0x37ee, 0x320f, 0x381e, 0x31d1, 0x3847, 0x318e, 0x3871, 0x3148, 0x389c, 0x3102, 0x38c6, 0x30b9, 0x38f0, 0x3070,
+    0x3919, 0x3027, 0x3941, 0x2fbe, 0x3968, 0x2f31, 0x398d, 0x2ea7, 0x39b1, 0x2e21, 0x39d4, 0x2da1, 0x39f4, 0x2d27, 0x3a14, 0x2cb1,
+    0x3a32, 0x2c44, 0x3a4e, 0x2bba, 0x3a69, 0x2af9, 0x3a82, 0x2a44, 0x3a9a, 0x2999, 0x3ab0, 0x28fd, 0x3ac4, 0x286c, 0x3ad7, 0x27cf,
+    0x3ae8, 0x26dd, 0x3af9, 0x2606, 0x3b08, 0x2542, 0x3b15, 0x2492, 0x3b22, 0x23e6, 0x3b30, 0x22cb, 0x3b3d, 0x21cc, 0x3b49, 0x20ef,
+    0x3b54, 0x202d, 0x3b5e, 0x1f00, 0x3b68, 0x1dd1, 0x3b71, 0x1ccd, 0x3b79, 0x1bea, 0x3b82, 0x1a75, 0x3b89, 0x1934, 0x3b90, 0x1829,
+    0x3b97, 0x16a4, 0x3b9e, 0x154a, 0x3ba4, 0x1420, 0x3baa, 0x1252, 0x3baf, 0x10c0, 0x3bb4, 0x0f11, 0x3bb8, 0x0d37, 0x3bbd, 0x0ba6,
+    0x3bc2, 0x09b5, 0x3bc6, 0x0810, 0x3bcb, 0x05c8, 0x3bcf, 0x03e6, 0x3bd3, 0x0285, 0x3bd7, 0x018f, 0x3bda, 0x0107, 0x3bde, 0x00a0,
+    0x3843, 0x343e, 0x37cd, 0x33cc, 0x376b, 0x3357, 0x373e, 0x3302, 0x3734, 0x32bd, 0x3743, 0x3282, 0x3764, 0x324b, 0x3792, 0x3214,
+    0x37cb, 0x31de, 0x3806, 0x31a5, 0x3828, 0x3169, 0x384e, 0x312e, 0x3874, 0x30ee, 0x389a, 0x30ac, 0x38c1, 0x306b, 0x38e8, 0x3029,
+    0x390f, 0x2fcd, 0x3934, 0x2f4a, 0x3959, 0x2ec9, 0x397d, 0x2e4b, 0x39a0, 0x2dd1, 0x39c1, 0x2d5a, 0x39e1, 0x2ce8, 0x39ff, 0x2c7c,
+    0x3a1c, 0x2c15, 0x3a37, 0x2b67, 0x3a51, 0x2ab2, 0x3a6b, 0x2a0b, 0x3a82, 0x296c, 0x3a98, 0x28db, 0x3aac, 0x2853, 0x3abe, 0x27a7,
+    0x3acf, 0x26c1, 0x3adf, 0x25ee, 0x3af0, 0x252f, 0x3b00, 0x2483, 0x3b0f, 0x23d6, 0x3b1d, 0x22c2, 0x3b2a, 0x21ce, 0x3b37, 0x20f5,
+    0x3b43, 0x2035, 0x3b4d, 0x1f16, 0x3b58, 0x1df0, 0x3b61, 0x1cf4, 0x3b6a, 0x1c16, 0x3b73, 0x1aaa, 0x3b7a, 0x1963, 0x3b82, 0x185c,
+    0x3b8a, 0x16fe, 0x3b90, 0x1584, 0x3b96, 0x144d, 0x3b9c, 0x12b2, 0x3ba2, 0x1136, 0x3ba8, 0x0ff8, 0x3bae, 0x0df2, 0x3bb3, 0x0c53,
+    0x3bb7, 0x0a21, 0x3bbc, 0x0865, 0x3bc1, 0x0667, 0x3bc6, 0x04a4, 0x3bca, 0x032a, 0x3bce, 0x0211, 0x3bd1, 0x012e, 0x3bd4, 0x00a3,
+    0x386e, 0x33f7, 0x3815, 0x3359, 0x37c5, 0x32ea, 0x3792, 0x3297, 0x3781, 0x3253, 0x3787, 0x3218, 0x379f, 0x31e1, 0x37c4, 0x31ac,
+    0x37f4, 0x3177, 0x3816, 0x3141, 0x3834, 0x310a, 0x3855, 0x30d1, 0x3878, 0x3099, 0x389b, 0x305d, 0x38bf, 0x3020, 0x38e2, 0x2fc7,
+    0x3906, 0x2f50, 0x392a, 0x2ed9, 0x394c, 0x2e63, 0x396e, 0x2df0, 0x398f, 0x2d80, 0x39af, 0x2d13, 0x39cd, 0x2cab, 0x39eb, 0x2c46,
+    0x3a07, 0x2bce, 0x3a21, 0x2b19, 0x3a3a, 0x2a6e, 0x3a52, 0x29cd, 0x3a68, 0x2937, 0x3a7c, 0x28af, 0x3a8f, 0x2830, 0x3aa4, 0x2775,
+    0x3ab8, 0x269e, 0x3aca, 0x25d4, 0x3adb, 0x251d, 0x3aeb, 0x2478, 0x3afa, 0x23c2, 0x3b09, 0x22b5, 0x3b16, 0x21c7, 0x3b23, 0x20f5,
+    0x3b30, 0x2039, 0x3b3b, 0x1f25, 0x3b46, 0x1e06, 0x3b50, 0x1d0d, 0x3b5a, 0x1c30, 0x3b63, 0x1aea, 0x3b6b, 0x19ac, 0x3b73, 0x1899,
+    0x3b7a, 0x175a, 0x3b80, 0x15cf, 0x3b87, 0x1496, 0x3b8e, 0x1330, 0x3b95, 0x1187, 0x3b9b, 0x1031, 0x3ba1, 0x0e5c, 0x3ba7, 0x0cd5,
+    0x3bac, 0x0b12, 0x3bb0, 0x0914, 0x3bb5, 0x070f, 0x3bb9, 0x04da, 0x3bbe, 0x0357, 0x3bc2, 0x0251, 0x3bc7, 0x0177, 0x3bcc, 0x00c7,
+    0x3896, 0x337a, 0x3840, 0x32ea, 0x380d, 0x3283, 0x37e3, 0x3232, 0x37cb, 0x31f0, 0x37ca, 0x31b5, 0x37da, 0x317f, 0x37f7, 0x314b,
+    0x380f, 0x3119, 0x3827, 0x30e5, 0x3842, 0x30b1, 0x385e, 0x307c, 0x387d, 0x3047, 0x389d, 0x3012, 0x38be, 0x2fb7, 0x38df, 0x2f47,
+    0x38ff, 0x2ed7, 0x3920, 0x2e6b, 0x3941, 0x2e00, 0x3960, 0x2d96, 0x397f, 0x2d30, 0x399d, 0x2ccc, 0x39ba, 0x2c6c, 0x39d6, 0x2c10,
+    0x39f1, 0x2b70, 0x3a0a, 0x2ac8, 0x3a22, 0x2a2a, 0x3a37, 0x2995, 0x3a4c, 0x2908, 0x3a63, 0x2884, 0x3a78, 0x2809, 0x3a8c, 0x2734,
+    0x3aa0, 0x266a, 0x3ab3, 0x25ae, 0x3ac5, 0x2504, 0x3ad6, 0x2467, 0x3ae5, 0x23ad, 0x3af4, 0x22ab, 0x3b02, 0x21c2, 0x3b0f, 0x20f0,
+    0x3b1b, 0x2038, 0x3b27, 0x1f30, 0x3b32, 0x1e16, 0x3b3c, 0x1d1e, 0x3b46, 0x1c43, 0x3b4f, 0x1b12, 0x3b58, 0x19d5, 0x3b61, 0x18c2,
+    0x3b6a, 0x17bd, 0x3b72, 0x163a, 0x3b79, 0x14f3, 0x3b80, 0x13ba, 0x3b86, 0x11f6, 0x3b8c, 0x109c, 0x3b92, 0x0ef8, 0x3b97, 0x0d2e,
+    0x3b9d, 0x0b9f, 0x3ba3, 0x09af, 0x3ba8, 0x081e, 0x3bac, 0x059d, 0x3bb2, 0x03a2, 0x3bb7, 0x0263, 0x3bbd, 0x0185, 0x3bc2, 0x00f1,
+    0x38bb, 0x3302, 0x3869, 0x3281, 0x3836, 0x3220, 0x3818, 0x31d3, 0x380a, 0x3193, 0x3806, 0x3159, 0x380a, 0x3124, 0x3815, 0x30f2,
+    0x3825, 0x30c1, 0x3839, 0x3090, 0x3850, 0x305f, 0x3869, 0x302e, 0x3884, 0x2ff8, 0x38a0, 0x2f93, 0x38be, 0x2f31, 0x38dc, 0x2ecd,
+    0x38fa, 0x2e68, 0x3918, 0x2e03, 0x3936, 0x2da0, 0x3953, 0x2d40, 0x3970, 0x2ce2, 0x398c, 0x2c86, 0x39a7, 0x2c2e, 0x39c1, 0x2bb2,
+    0x39d9, 0x2b0f, 0x39f1, 0x2a76, 0x3a07, 0x29e2, 0x3a1f, 0x2958, 0x3a37, 0x28d5, 0x3a4d, 0x285c, 0x3a62, 0x27d2, 0x3a77, 0x26fe,
+    0x3a8a, 0x2637, 0x3a9c, 0x2582, 0x3aad, 0x24dd, 0x3abe, 0x244a, 0x3ace, 0x2389, 0x3add, 0x2296, 0x3aec, 0x21b7, 0x3af9, 0x20ee,
+    0x3b05, 0x203d, 0x3b11, 0x1f39, 0x3b1b, 0x1e1c, 0x3b26, 0x1d26, 0x3b31, 0x1c53, 0x3b3b, 0x1b36, 0x3b45, 0x19f6, 0x3b4d, 0x18e1,
+    0x3b56, 0x17f5, 0x3b5e, 0x1673, 0x3b65, 0x1523, 0x3b6d, 0x141c, 0x3b74, 0x1275, 0x3b7b, 0x1101, 0x3b82, 0x0f95, 0x3b88, 0x0dbb,
+    0x3b8f, 0x0c4d, 0x3b94, 0x0a33, 0x3b9a, 0x0870, 0x3ba1, 0x065c, 0x3ba7, 0x0487, 0x3bad, 0x02e3, 0x3bb1, 0x01b2, 0x3bb5, 0x00ff,
+    0x38dd, 0x3291, 0x388e, 0x321c, 0x385c, 0x31c2, 0x383d, 0x3179, 0x382c, 0x313b, 0x3825, 0x3103, 0x3827, 0x30d0, 0x382e, 0x309f,
+    0x383b, 0x306f, 0x384b, 0x3042, 0x385e, 0x3013, 0x3874, 0x2fc9, 0x388c, 0x2f6c, 0x38a5, 0x2f0f, 0x38bf, 0x2eb2, 0x38da, 0x2e57,
+    0x38f5, 0x2dfc, 0x3911, 0x2da0, 0x392c, 0x2d46, 0x3947, 0x2ced, 0x3961, 0x2c97, 0x397b, 0x2c43, 0x3993, 0x2be3, 0x39ab, 0x2b47,
+    0x39c1, 0x2ab1, 0x39db, 0x2a23, 0x39f3, 0x299a, 0x3a0b, 0x291a, 0x3a21, 0x28a0, 0x3a37, 0x282e, 0x3a4c, 0x2786, 0x3a60, 0x26c1,
+    0x3a73, 0x2608, 0x3a85, 0x255e, 0x3a96, 0x24c0, 0x3aa6, 0x242f, 0x3ab5, 0x2359, 0x3ac4, 0x226c, 0x3ad2, 0x219b, 0x3ae0, 0x20df,
+    0x3aed, 0x2035, 0x3af9, 0x1f36, 0x3b05, 0x1e26, 0x3b11, 0x1d37, 0x3b1b, 0x1c61, 0x3b25, 0x1b4c, 0x3b2e, 0x1a12, 0x3b37, 0x1901,
+    0x3b40, 0x181a, 0x3b49, 0x16a5, 0x3b52, 0x1558, 0x3b5a, 0x1447, 0x3b62, 0x12c0, 0x3b69, 0x114a, 0x3b71, 0x101b, 0x3b77, 0x0e38,
+    0x3b7e, 0x0ca3, 0x3b85, 0x0ada, 0x3b8c, 0x0907, 0x3b93, 0x0704, 0x3b98, 0x04c0, 0x3b9e, 0x0351, 0x3ba3, 0x0221, 0x3ba8, 0x0127,
+    0x38fd, 0x3227, 0x38b1, 0x31bd, 0x3880, 0x3169, 0x3860, 0x3124, 0x384d, 0x30e8, 0x3844, 0x30b3, 0x3842, 0x3081, 0x3847, 0x3052,
+    0x3850, 0x3024, 0x385d, 0x2ff0, 0x386d, 0x2f9a, 0x3880, 0x2f42, 0x3894, 0x2eeb, 0x38aa, 0x2e94, 0x38c1, 0x2e3d, 0x38d9, 0x2de7,
+    0x38f1, 0x2d95, 0x390a, 0x2d42, 0x3923, 0x2cf0, 0x393b, 0x2c9f, 0x3952, 0x2c4f, 0x3969, 0x2c01, 0x397e, 0x2b6e, 0x3997, 0x2adf,
+    0x39b0, 0x2a54, 0x39c8, 0x29cf, 0x39df, 0x2952, 0x39f6, 0x28db, 0x3a0c, 0x286a, 0x3a21, 0x2801, 0x3a35, 0x273a, 0x3a49, 0x267f,
+    0x3a5b, 0x25d2, 0x3a6d, 0x2533, 0x3a7e, 0x24a0, 0x3a8d, 0x2418, 0x3a9c, 0x2334, 0x3aab, 0x224e, 0x3ab9, 0x2181, 0x3ac7, 0x20c7,
+    0x3ad3, 0x2021, 0x3ae0, 0x1f20, 0x3aec, 0x1e1e, 0x3af8, 0x1d34, 0x3b03, 0x1c66, 0x3b0d, 0x1b68, 0x3b18, 0x1a2d, 0x3b22, 0x1916,
+    0x3b2b, 0x182e, 0x3b35, 0x16d9, 0x3b3e, 0x158c, 0x3b46, 0x1471, 0x3b4e, 0x1301, 0x3b56, 0x118b, 0x3b5e, 0x1054, 0x3b66, 0x0ea3,
+    0x3b6e, 0x0d1d, 0x3b75, 0x0b93, 0x3b7c, 0x0974, 0x3b82, 0x07de, 0x3b88, 0x0586, 0x3b8d, 0x0393, 0x3b93, 0x0240, 0x3b99, 0x0159,
+    0x391a, 0x31c3, 0x38d2, 0x3163, 0x38a1, 0x3115, 0x3880, 0x30d4, 0x386c, 0x309b, 0x3861, 0x3067, 0x385d, 0x3038, 0x385f, 0x300a,
+    0x3865, 0x2fbe, 0x386f, 0x2f68, 0x387c, 0x2f16, 0x388b, 0x2ec5, 0x389d, 0x2e73, 0x38af, 0x2e22, 0x38c3, 0x2dd2, 0x38d8, 0x2d81,
+    0x38ed, 0x2d32, 0x3903, 0x2ce7, 0x3919, 0x2c9c, 0x392e, 0x2c53, 0x3943, 0x2c0a, 0x3958, 0x2b86, 0x3970, 0x2afc, 0x3988, 0x2a77,
+    0x399f, 0x29f9, 0x39b6, 0x297f, 0x39cc, 0x290b, 0x39e2, 0x289c, 0x39f6, 0x2832, 0x3a0b, 0x27a2, 0x3a1e, 0x26e8, 0x3a31, 0x263d,
+    0x3a42, 0x2599, 0x3a53, 0x2503, 0x3a63, 0x2477, 0x3a74, 0x23f1, 0x3a83, 0x2305, 0x3a92, 0x222e, 0x3aa0, 0x216a, 0x3aae, 0x20b6,
+    0x3abb, 0x2016, 0x3ac8, 0x1f0d, 0x3ad4, 0x1e0c, 0x3ae0, 0x1d2d, 0x3aec, 0x1c69, 0x3af8, 0x1b75, 0x3b03, 0x1a42, 0x3b0d, 0x1938,
+    0x3b17, 0x1854, 0x3b20, 0x1711, 0x3b28, 0x15b5, 0x3b32, 0x149e, 0x3b3b, 0x1362, 0x3b43, 0x11d6, 0x3b4b, 0x1082, 0x3b53, 0x0ef2,
+    0x3b5a, 0x0d4b, 0x3b61, 0x0bf2, 0x3b68, 0x09f7, 0x3b6e, 0x0844, 0x3b75, 0x05e1, 0x3b7c, 0x03fc, 0x3b82, 0x027a, 0x3b88, 0x016d,
+    0x3933, 0x3165, 0x38ef, 0x310e, 0x38c0, 0x30c6, 0x389f, 0x3088, 0x3889, 0x3052, 0x387c, 0x3021, 0x3876, 0x2fe6, 0x3875, 0x2f90,
+    0x3879, 0x2f3c, 0x3880, 0x2eeb, 0x388a, 0x2e9c, 0x3897, 0x2e4f, 0x38a5, 0x2e03, 0x38b5, 0x2db7, 0x38c6, 0x2d6d, 0x38d8, 0x2d24,
+    0x38ea, 0x2cda, 0x38fc, 0x2c91, 0x390f, 0x2c4c, 0x3921, 0x2c09, 0x3936, 0x2b8f, 0x394d, 0x2b0d, 0x3963, 0x2a8f, 0x3979, 0x2a14,
+    0x398f, 0x299f, 0x39a4, 0x292e, 0x39b9, 0x28c4, 0x39cd, 0x285d, 0x39e1, 0x27f9, 0x39f4, 0x2742, 0x3a05, 0x2693, 0x3a16, 0x25f2,
+    0x3a28, 0x255b, 0x3a39, 0x24d1, 0x3a4a, 0x244e, 0x3a5a, 0x23aa, 0x3a6a, 0x22ca, 0x3a79, 0x2203, 0x3a88, 0x214c, 0x3a96, 0x20a3,
+    0x3aa3, 0x200b, 0x3ab0, 0x1efe, 0x3abd, 0x1e04, 0x3ac9, 0x1d28, 0x3ad5, 0x1c64, 0x3ae0, 0x1b72, 0x3aeb, 0x1a4c, 0x3af5, 0x1947,
+    0x3aff, 0x1861, 0x3b09, 0x173a, 0x3b13, 0x15f0, 0x3b1d, 0x14d0, 0x3b25, 0x13aa, 0x3b2e, 0x121a, 0x3b36, 0x10d1, 0x3b3e, 0x0f74,
+    0x3b45, 0x0da2, 0x3b4b, 0x0c36, 0x3b52, 0x0a34, 0x3b5a, 0x087c, 0x3b61, 0x0662, 0x3b67, 0x043a, 0x3b6f, 0x02cb, 0x3b76, 0x019c,
+    0x394b, 0x310c, 0x390a, 0x30bd, 0x38dc, 0x307b, 0x38bb, 0x3041, 0x38a4, 0x300e, 0x3896, 0x2fbc, 0x388e, 0x2f66, 0x388b, 0x2f13,
+    0x388c, 0x2ec4, 0x3890, 0x2e77, 0x3898, 0x2e2c, 0x38a1, 0x2de2, 0x38ad, 0x2d9c, 0x38ba, 0x2d55, 0x38c8, 0x2d0f, 0x38d7, 0x2cca,
+    0x38e6, 0x2c88, 0x38f6, 0x2c45, 0x3905, 0x2c03, 0x3919, 0x2b86, 0x392e, 0x2b0d, 0x3942, 0x2a97, 0x3957, 0x2a25, 0x396b, 0x29b5,
+    0x397f, 0x2949, 0x3993, 0x28e1, 0x39a6, 0x287d, 0x39b8, 0x281e, 0x39ca, 0x278a, 0x39db, 0x26df, 0x39ed, 0x2640, 0x39ff, 0x25ab,
+    0x3a11, 0x251d, 0x3a21, 0x249a, 0x3a32, 0x2421, 0x3a42, 0x2364, 0x3a51, 0x2292, 0x3a60, 0x21d2, 0x3a6e, 0x211f, 0x3a7c, 0x2082,
+    0x3a8a, 0x1fe8, 0x3a98, 0x1ee3, 0x3aa5, 0x1df9, 0x3ab1, 0x1d23, 0x3abc, 0x1c63, 0x3ac7, 0x1b76, 0x3ad2, 0x1a49, 0x3adc, 0x1947,
+    0x3ae7, 0x186c, 0x3af2, 0x175e, 0x3afc, 0x160a, 0x3b05, 0x14ef, 0x3b0e, 0x13ff, 0x3b17, 0x1261, 0x3b1f, 0x1103, 0x3b27, 0x0fda,
+    0x3b2f, 0x0e1a, 0x3b37, 0x0c9f, 0x3b3e, 0x0ac3, 0x3b45, 0x08ea, 0x3b4c, 0x06c4, 0x3b54, 0x04b5, 0x3b5b, 0x02f5, 0x3b62, 0x01cc,
+    0x3960, 0x30b9, 0x3922, 0x3072, 0x38f5, 0x3034, 0x38d4, 0x2ffc, 0x38bd, 0x2f9b, 0x38ad, 0x2f40, 0x38a3, 0x2eed, 0x389f, 0x2e9f,
+    0x389e, 0x2e54, 0x38a0, 0x2e0a, 0x38a5, 0x2dc4, 0x38ac, 0x2d7e, 0x38b5, 0x2d3a, 0x38bf, 0x2cf9, 0x38ca, 0x2cb8, 0x38d6, 0x2c78,
+    0x38e2, 0x2c39, 0x38ef, 0x2bf8, 0x3901, 0x2b80, 0x3913, 0x2b09, 0x3926, 0x2a95, 0x3938, 0x2a26, 0x394b, 0x29bd, 0x395d, 0x2957,
+    0x396f, 0x28f3, 0x3981, 0x2895, 0x3993, 0x283a, 0x39a3, 0x27c4, 0x39b5, 0x271e, 0x39c7, 0x2682, 0x39d8, 0x25ed, 0x39e9, 0x2561,
+    0x39fa, 0x24df, 0x3a0a, 0x2466, 0x3a19, 0x23e7, 0x3a29, 0x2313, 0x3a38, 0x2250, 0x3a47, 0x21a0, 0x3a56, 0x20fa, 0x3a64, 0x2064,
+    0x3a71, 0x1fad, 0x3a7e, 0x1eb4, 0x3a8a, 0x1dd7, 0x3a96, 0x1d10, 0x3aa3, 0x1c5e, 0x3aaf, 0x1b79, 0x3aba, 0x1a56, 0x3ac4, 0x1958,
+    0x3acf, 0x1878, 0x3ad8, 0x1765, 0x3ae2, 0x1621, 0x3aec, 0x150c, 0x3af5, 0x1418, 0x3afd, 0x1297, 0x3b06, 0x1146, 0x3b0e, 0x1021,
+    0x3b16, 0x0e53, 0x3b1f, 0x0cd8, 0x3b27, 0x0b63, 0x3b30, 0x0960, 0x3b37, 0x0794, 0x3b3e, 0x0522, 0x3b44, 0x0351, 0x3b4b, 0x01de,
+    0x3972, 0x306c, 0x3938, 0x302a, 0x390c, 0x2fe3, 0x38ec, 0x2f7d, 0x38d4, 0x2f22, 0x38c3, 0x2ecd, 0x38b8, 0x2e7d, 0x38b1, 0x2e32,
+    0x38ae, 0x2deb, 0x38ae, 0x2da5, 0x38b1, 0x2d62, 0x38b5, 0x2d21, 0x38bb, 0x2ce0, 0x38c3, 0x2ca2, 0x38cb, 0x2c67, 0x38d4, 0x2c2b,
+    0x38df, 0x2be0, 0x38ee, 0x2b6e, 0x38fe, 0x2b00, 0x390e, 0x2a94, 0x391f, 0x2a28, 0x392f, 0x29c0, 0x393f, 0x295d, 0x3950, 0x28fe,
+    0x3960, 0x28a3, 0x3970, 0x284c, 0x3980, 0x27ef, 0x3992, 0x2750, 0x39a3, 0x26b7, 0x39b4, 0x2625, 0x39c4, 0x259c, 0x39d4, 0x251d,
+    0x39e4, 0x24a2, 0x39f3, 0x2430, 0x3a03, 0x238c, 0x3a12, 0x22c9, 0x3a21, 0x2211, 0x3a2f, 0x2169, 0x3a3d, 0x20cd, 0x3a4a, 0x2042,
+    0x3a57, 0x1f7f, 0x3a63, 0x1e92, 0x3a70, 0x1db7, 0x3a7c, 0x1cf3, 0x3a88, 0x1c48, 0x3a94, 0x1b5c, 0x3a9f, 0x1a4d, 0x3aaa, 0x195c,
+    0x3ab5, 0x1882, 0x3abe, 0x1789, 0x3ac8, 0x163c, 0x3ad0, 0x151a, 0x3ad9, 0x142a, 0x3ae2, 0x12c0, 0x3aeb, 0x1166, 0x3af4, 0x1042,
+    0x3afc, 0x0eac, 0x3b05, 0x0d17, 0x3b0d, 0x0b93, 0x3b16, 0x099e, 0x3b1d, 0x0813, 0x3b24, 0x0589, 0x3b2c, 0x0398, 0x3b34, 0x0225,
+    0x3982, 0x3023, 0x394b, 0x2fcf, 0x3921, 0x2f66, 0x3901, 0x2f07, 0x38e9, 0x2eb0, 0x38d7, 0x2e60, 0x38ca, 0x2e14, 0x38c2, 0x2dcc,
+    0x38bd, 0x2d89, 0x38bb, 0x2d47, 0x38bb, 0x2d07, 0x38be, 0x2cca, 0x38c2, 0x2c8e, 0x38c6, 0x2c52, 0x38cc, 0x2c19, 0x38d3, 0x2bc5,
+    0x38e0, 0x2b58, 0x38ed, 0x2aed, 0x38fb, 0x2a85, 0x3909, 0x2a21, 0x3918, 0x29c1, 0x3926, 0x2961, 0x3934, 0x2904, 0x3942, 0x28ac,
+    0x3951, 0x2857, 0x3961, 0x2806, 0x3972, 0x2775, 0x3982, 0x26e1, 0x3992, 0x2655, 0x39a1, 0x25d0, 0x39b1, 0x2551, 0x39c0, 0x24d9,
+    0x39cf, 0x2468, 0x39de, 0x23ff, 0x39ed, 0x2336, 0x39fb, 0x227c, 0x3a09, 0x21d1, 0x3a16, 0x2134, 0x3a23, 0x20a0, 0x3a2f, 0x2019,
+    0x3a3c, 0x1f3d, 0x3a49, 0x1e62, 0x3a56, 0x1d97, 0x3a62, 0x1cde, 0x3a6d, 0x1c35, 0x3a78, 0x1b3b, 0x3a83, 0x1a33, 0x3a8d, 0x1948,
+    0x3a97, 0x187c, 0x3aa1, 0x1790, 0x3aab, 0x164d, 0x3ab4, 0x1537, 0x3abd, 0x1441, 0x3ac6, 0x12de, 0x3acf, 0x1181, 0x3ad8, 0x105e,
+    0x3ae1, 0x0ed6, 0x3aea, 0x0d42, 0x3af2, 0x0c01, 0x3af9, 0x09d2, 0x3b00, 0x0823, 0x3b09, 0x05d3, 0x3b11, 0x03c2, 0x3b19, 0x0240,
+    0x3990, 0x2fbf, 0x395c, 0x2f51, 0x3933, 0x2ef0, 0x3914, 0x2e97, 0x38fb, 0x2e46, 0x38e9, 0x2dfa, 0x38db, 0x2db2, 0x38d1, 0x2d6e,
+    0x38cb, 0x2d2d, 0x38c7, 0x2cef, 0x38c5, 0x2cb3, 0x38c5, 0x2c78, 0x38c7, 0x2c40, 0x38c9, 0x2c09, 0x38cc, 0x2ba4, 0x38d6, 0x2b3c,
+    0x38e1, 0x2ad8, 0x38ec, 0x2a74, 0x38f8, 0x2a14, 0x3904, 0x29b7, 0x3910, 0x295d, 0x391d, 0x2907, 0x392a, 0x28b3, 0x3938, 0x2860,
+    0x3946, 0x2811, 0x3955, 0x278e, 0x3964, 0x26ff, 0x3972, 0x2677, 0x3981, 0x25f7, 0x398f, 0x257a, 0x399e, 0x2506, 0x39ad, 0x2498,
+    0x39bb, 0x242e, 0x39c9, 0x2398, 0x39d6, 0x22e1, 0x39e4, 0x2236, 0x39f0, 0x2194, 0x39fd, 0x20fc, 0x3a0a, 0x2074, 0x3a16, 0x1fea,
+    0x3a22, 0x1f00, 0x3a2e, 0x1e2a, 0x3a3a, 0x1d67, 0x3a46, 0x1cbb, 0x3a51, 0x1c1d, 0x3a5b, 0x1b20, 0x3a65, 0x1a1a, 0x3a6f, 0x1934,
+    0x3a79, 0x186b, 0x3a82, 0x1774, 0x3a8d, 0x1642, 0x3a96, 0x153a, 0x3aa0, 0x144e, 0x3aaa, 0x130a, 0x3ab3, 0x11a6, 0x3abc, 0x107c,
+    0x3ac4, 0x0f0e, 0x3acd, 0x0d71, 0x3ad5, 0x0c22, 0x3add, 0x0a29, 0x3ae5, 0x0868, 0x3aee, 0x0618, 0x3af6, 0x0404, 0x3afe, 0x026b,
+    0x399c, 0x2f40, 0x396a, 0x2edc, 0x3943, 0x2e81, 0x3924, 0x2e2f, 0x390c, 0x2de2, 0x38f9, 0x2d9a, 0x38ea, 0x2d56, 0x38df, 0x2d15,
+    0x38d7, 0x2cd8, 0x38d1, 0x2c9d, 0x38ce, 0x2c64, 0x38cc, 0x2c2d, 0x38cb, 0x2bee, 0x38cb, 0x2b86, 0x38d1, 0x2b21, 0x38d9, 0x2abe,
+    0x38e1, 0x2a60, 0x38eb, 0x2a05, 0x38f5, 0x29ab, 0x38ff, 0x2954, 0x3909, 0x2900, 0x3914, 0x28b0, 0x3921, 0x2864, 0x392f, 0x281a,
+    0x393c, 0x27a2, 0x3949, 0x2716, 0x3956, 0x2691, 0x3963, 0x2612, 0x3970, 0x259a, 0x397e, 0x2529, 0x398c, 0x24bc, 0x3999, 0x2455,
+    0x39a6, 0x23ea, 0x39b3, 0x2334, 0x39bf, 0x2287, 0x39cb, 0x21e7, 0x39d8, 0x2153, 0x39e4, 0x20c9, 0x39f1, 0x2047, 0x39fc, 0x1f9c,
+    0x3a08, 0x1ec2, 0x3a14, 0x1dfa, 0x3a1f, 0x1d41, 0x3a29, 0x1c99, 0x3a33, 0x1c02, 0x3a3d, 0x1af7, 0x3a48, 0x1a04, 0x3a52, 0x192a,
+    0x3a5b, 0x1862, 0x3a65, 0x1766, 0x3a6e, 0x1633, 0x3a78, 0x152d, 0x3a82, 0x144a, 0x3a8c, 0x130b, 0x3a95, 0x11bb, 0x3a9f, 0x109d,
+    0x3aa7, 0x0f3c, 0x3aaf, 0x0da4, 0x3ab8, 0x0c50, 0x3ac1, 0x0a6e, 0x3ac9, 0x08aa, 0x3ad1, 0x068d, 0x3ad8, 0x0449, 0x3ae0, 0x0293,
+    0x39a6, 0x2eca, 0x3977, 0x2e6e, 0x3951, 0x2e1a, 0x3933, 0x2dcc, 0x391a, 0x2d84, 0x3907, 0x2d41, 0x38f7, 0x2d01, 0x38eb, 0x2cc3,
+    0x38e1, 0x2c88, 0x38da, 0x2c50, 0x38d5, 0x2c1a, 0x38d1, 0x2bcc, 0x38ce, 0x2b66, 0x38d0, 0x2b04, 0x38d5, 0x2aa6, 0x38db, 0x2a4a,
+    0x38e2, 0x29f1, 0x38e9, 0x299b, 0x38f1, 0x2949, 0x38fa, 0x28f8, 0x3903, 0x28ab, 0x390e, 0x2860, 0x3919, 0x2819, 0x3925, 0x27a9,
+    0x3931, 0x2727, 0x393c, 0x26a6, 0x3948, 0x262a, 0x3955, 0x25b4, 0x3961, 0x2544, 0x396d, 0x24da, 0x3979, 0x2475, 0x3985, 0x2418,
+    0x3991, 0x2379, 0x399c, 0x22d0, 0x39a8, 0x2233, 0x39b4, 0x219e, 0x39c0, 0x2112, 0x39cc, 0x2090, 0x39d7, 0x2018, 0x39e3, 0x1f52,
+    0x39ed, 0x1e84, 0x39f8, 0x1dc4, 0x3a02, 0x1d18, 0x3a0c, 0x1c7a, 0x3a16, 0x1bd3, 0x3a20, 0x1acc, 0x3a2a, 0x19e2, 0x3a34, 0x1914,
+    0x3a3e, 0x185b, 0x3a48, 0x176a, 0x3a52, 0x1637, 0x3a5b, 0x1531, 0x3a65, 0x144d, 0x3a6e, 0x1316, 0x3a76, 0x11c5, 0x3a7e, 0x10a3,
+    0x3a88, 0x0f6a, 0x3a91, 0x0dcc, 0x3a99, 0x0c6c, 0x3aa2, 0x0aa7, 0x3aa9, 0x08d0, 0x3ab1, 0x06c6, 0x3ab9, 0x0481, 0x3ac0, 0x02b8,
+    0x39ad, 0x2e5c, 0x3981, 0x2e07, 0x395d, 0x2db9, 0x393f, 0x2d70, 0x3927, 0x2d2d, 0x3913, 0x2ced, 0x3903, 0x2cb0, 0x38f5, 0x2c76,
+    0x38eb, 0x2c3e, 0x38e2, 0x2c09, 0x38db, 0x2bab, 0x38d5, 0x2b48, 0x38d2, 0x2ae9, 0x38d5, 0x2a8c, 0x38d8, 0x2a33, 0x38dd, 0x29de,
+    0x38e2, 0x298a, 0x38e7, 0x2939, 0x38ee, 0x28ed, 0x38f5, 0x28a4, 0x38ff, 0x285c, 0x3908, 0x2816, 0x3912, 0x27a6, 0x391c, 0x2727,
+    0x3926, 0x26ad, 0x3931, 0x263a, 0x393c, 0x25c9, 0x3947, 0x255c, 0x3952, 0x24f4, 0x395c, 0x2491, 0x3967, 0x2433, 0x3971, 0x23b4,
+    0x397c, 0x230f, 0x3987, 0x2271, 0x3992, 0x21dc, 0x399d, 0x2152, 0x39a8, 0x20d1, 0x39b3, 0x2059, 0x39bd, 0x1fd1, 0x39c7, 0x1f00,
+    0x39d2, 0x1e41, 0x39db, 0x1d8f, 0x39e5, 0x1ceb, 0x39ef, 0x1c54, 0x39f9, 0x1b9b, 0x3a02, 0x1aa1, 0x3a0c, 0x19c2, 0x3a16, 0x18f6,
+    0x3a20, 0x1844, 0x3a2a, 0x174a, 0x3a34, 0x1633, 0x3a3d, 0x153a, 0x3a46, 0x1456, 0x3a4e, 0x1322, 0x3a56, 0x11cf, 0x3a5f, 0x10b6,
+    0x3a68, 0x0f84, 0x3a70, 0x0de3, 0x3a78, 0x0c92, 0x3a7f, 0x0ad5, 0x3a88, 0x0905, 0x3a90, 0x06f8, 0x3a97, 0x04a8, 0x3aa0, 0x02e0,
+    0x39b3, 0x2df5, 0x3989, 0x2da6, 0x3967, 0x2d5e, 0x394a, 0x2d1a, 0x3931, 0x2cda, 0x391d, 0x2c9e, 0x390c, 0x2c65, 0x38fe, 0x2c2e,
+    0x38f2, 0x2bf2, 0x38e8, 0x2b8d, 0x38e0, 0x2b2b, 0x38d8, 0x2ace, 0x38d8, 0x2a74, 0x38d9, 0x2a1e, 0x38db, 0x29ca, 0x38de, 0x2979,
+    0x38e1, 0x292b, 0x38e5, 0x28e0, 0x38eb, 0x2898, 0x38f2, 0x2854, 0x38fa, 0x2813, 0x3902, 0x27a5, 0x390a, 0x2728, 0x3912, 0x26b0,
+    0x391c, 0x263c, 0x3925, 0x25d0, 0x392f, 0x2569, 0x3938, 0x2507, 0x3942, 0x24a7, 0x394b, 0x244b, 0x3954, 0x23e7, 0x395e, 0x2343,
+    0x3968, 0x22a7, 0x3972, 0x2214, 0x397c, 0x218c, 0x3986, 0x2109, 0x3990, 0x208f, 0x3999, 0x2020, 0x39a3, 0x1f6e, 0x39ac, 0x1eab,
+    0x39b5, 0x1df9, 0x39bf, 0x1d54, 0x39c8, 0x1cba, 0x39d1, 0x1c2d, 0x39db, 0x1b58, 0x39e5, 0x1a6e, 0x39ee, 0x199b, 0x39f8, 0x18da,
+    0x3a01, 0x182c, 0x3a0a, 0x171d, 0x3a13, 0x1610, 0x3a1c, 0x1520, 0x3a24, 0x1451, 0x3a2d, 0x132c, 0x3a35, 0x11de, 0x3a3e, 0x10bb,
+    0x3a46, 0x0f90, 0x3a4d, 0x0dfa, 0x3a55, 0x0c9e, 0x3a5e, 0x0b08, 0x3a66, 0x0922, 0x3a6e, 0x075c, 0x3a76, 0x04ea, 0x3a7d, 0x0301,
+    0x39b8, 0x2d95, 0x3990, 0x2d4c, 0x396f, 0x2d08, 0x3952, 0x2cc9, 0x393a, 0x2c8d, 0x3926, 0x2c54, 0x3914, 0x2c1e, 0x3906, 0x2bd5,
+    0x38f9, 0x2b71, 0x38ed, 0x2b11, 0x38e4, 0x2ab5, 0x38de, 0x2a5c, 0x38dd, 0x2a08, 0x38dc, 0x29b7, 0x38dd, 0x2968, 0x38de, 0x291d,
+    0x38e0, 0x28d4, 0x38e4, 0x288f, 0x38e9, 0x284c, 0x38ef, 0x280b, 0x38f5, 0x279b, 0x38fb, 0x2725, 0x3902, 0x26b2, 0x390a, 0x2642,
+    0x3912, 0x25d8, 0x3919, 0x2570, 0x3921, 0x250e, 0x3929, 0x24b2, 0x3931, 0x245b, 0x3939, 0x2407, 0x3942, 0x236e, 0x394b, 0x22d5,
+    0x3954, 0x2245, 0x395d, 0x21bd, 0x3966, 0x213b, 0x396f, 0x20c4, 0x3977, 0x2053, 0x3980, 0x1fd3, 0x3988, 0x1f0d, 0x3991, 0x1e58,
+    0x3999, 0x1daf, 0x39a2, 0x1d12, 0x39aa, 0x1c83, 0x39b4, 0x1c01, 0x39bd, 0x1b10, 0x39c7, 0x1a32, 0x39d0, 0x1967, 0x39d9, 0x18b4,
+    0x39e1, 0x1811, 0x39e9, 0x16fa, 0x39f1, 0x15ee, 0x39f9, 0x1500, 0x3a01, 0x1434, 0x3a0a, 0x1305, 0x3a13, 0x11d6, 0x3a1b, 0x10bf,
+    0x3a22, 0x0fa4, 0x3a2a, 0x0e00, 0x3a33, 0x0cb2, 0x3a3b, 0x0b22, 0x3a42, 0x094b, 0x3a4a, 0x077d, 0x3a51, 0x051c, 0x3a59, 0x0328,
+    0x39ba, 0x2d3b, 0x3995, 0x2cf8, 0x3975, 0x2cb9, 0x3959, 0x2c7d, 0x3941, 0x2c45, 0x392d, 0x2c0f, 0x391b, 0x2bb8, 0x390b, 0x2b56,
+    0x38fe, 0x2af8, 0x38f1, 0x2a9d, 0x38e7, 0x2a46, 0x38e3, 0x29f3, 0x38e0, 0x29a4, 0x38df, 0x2958, 0x38de, 0x290e, 0x38de, 0x28c7,
+    0x38df, 0x2884, 0x38e3, 0x2843, 0x38e7, 0x2805, 0x38eb, 0x278f, 0x38ef, 0x271a, 0x38f4, 0x26aa, 0x38fb, 0x2642, 0x3901, 0x25db,
+    0x3907, 0x2577, 0x390d, 0x2518, 0x3914, 0x24bc, 0x391a, 0x2464, 0x3921, 0x2412, 0x3929, 0x238b, 0x3931, 0x22f8, 0x3939, 0x226b,
+    0x3940, 0x21e6, 0x3948, 0x2168, 0x3950, 0x20f1, 0x3957, 0x2082, 0x395e, 0x2017, 0x3966, 0x1f6e, 0x396e, 0x1eb4, 0x3975, 0x1e07,
+    0x397d, 0x1d69, 0x3986, 0x1cd7, 0x398f, 0x1c4e, 0x3997, 0x1ba4, 0x39a0, 0x1ac0, 0x39a9, 0x19f6, 0x39b1, 0x1937, 0x39b8, 0x188a,
+    0x39c0, 0x17da, 0x39c8, 0x16c9, 0x39d0, 0x15cf, 0x39d8, 0x14f0, 0x39e0, 0x1423, 0x39e7, 0x12e4, 0x39ef, 0x11ad, 0x39f6, 0x10af,
+    0x39ff, 0x0f9d, 0x3a07, 0x0e0f, 0x3a0e, 0x0cb4, 0x3a16, 0x0b33, 0x3a1d, 0x0955, 0x3a24, 0x07ac, 0x3a2c, 0x052d, 0x3a33, 0x033a,
+    0x39bc, 0x2ce8, 0x3998, 0x2ca9, 0x3979, 0x2c6e, 0x395e, 0x2c36, 0x3947, 0x2c01, 0x3932, 0x2b9e, 0x3920, 0x2b3c, 0x3910, 0x2ae0,
+    0x3901, 0x2a87, 0x38f4, 0x2a32, 0x38eb, 0x29e0, 0x38e7, 0x2991, 0x38e3, 0x2946, 0x38e0, 0x28ff, 0x38de, 0x28bb, 0x38de, 0x2879,
+    0x38df, 0x2839, 0x38e1, 0x27f9, 0x38e3, 0x2784, 0x38e6, 0x2712, 0x38e9, 0x26a4, 0x38ee, 0x263a, 0x38f2, 0x25d6, 0x38f7, 0x2577,
+    0x38fc, 0x251c, 0x3900, 0x24c2, 0x3905, 0x246e, 0x390b, 0x241e, 0x3912, 0x239f, 0x3918, 0x230d, 0x391f, 0x2285, 0x3925, 0x2204,
+    0x392c, 0x2188, 0x3932, 0x2113, 0x3939, 0x20a6, 0x393f, 0x203e, 0x3946, 0x1fbb, 0x394d, 0x1f05, 0x3954, 0x1e5a, 0x395b, 0x1dbc,
+    0x3963, 0x1d27, 0x396b, 0x1c9c, 0x3973, 0x1c1e, 0x397b, 0x1b54, 0x3983, 0x1a7c, 0x398a, 0x19b7, 0x3991, 0x1906, 0x3998, 0x1866,
+    0x39a0, 0x17a3, 0x39a7, 0x1695, 0x39af, 0x15a3, 0x39b7, 0x14d3, 0x39be, 0x1416, 0x39c5, 0x12db, 0x39cc, 0x11a8, 0x39d3, 0x10a1,
+    0x39db, 0x0f79, 0x39e2, 0x0e06, 0x39e9, 0x0cbc, 0x39f1, 0x0b48, 0x39f7, 0x096c, 0x39ff, 0x07cc, 0x3a06, 0x055d, 0x3a0d, 0x035c,
+    0x39bb, 0x2c9a, 0x3999, 0x2c60, 0x397c, 0x2c29, 0x3961, 0x2be8, 0x394a, 0x2b84, 0x3936, 0x2b25, 0x3923, 0x2ac9, 0x3912, 0x2a71,
+    0x3903, 0x2a1e, 0x38f5, 0x29cd, 0x38ef, 0x2980, 0x38e9, 0x2936, 0x38e4, 0x28f0, 0x38e0, 0x28ac, 0x38de, 0x286d, 0x38dd, 0x2830,
+    0x38dd, 0x27e7, 0x38de, 0x2774, 0x38df, 0x2707, 0x38e1, 0x269c, 0x38e3, 0x2636, 0x38e6, 0x25d3, 0x38e9, 0x2574, 0x38ec, 0x251a,
+    0x38f0, 0x24c5, 0x38f3, 0x2475, 0x38f8, 0x2425, 0x38fd, 0x23b5, 0x3903, 0x2326, 0x3908, 0x229d, 0x390d, 0x221c, 0x3912, 0x21a2,
+    0x3917, 0x2132, 0x391c, 0x20c5, 0x3922, 0x205f, 0x3927, 0x1ffd, 0x392e, 0x1f4a, 0x3934, 0x1ea0, 0x393b, 0x1e03, 0x3943, 0x1d6e,
+    0x394a, 0x1ce7, 0x3951, 0x1c67, 0x3958, 0x1bdf, 0x395f, 0x1b02, 0x3965, 0x1a3b, 0x396b, 0x1980, 0x3972, 0x18d6, 0x3979, 0x183b,
+    0x3980, 0x1765, 0x3987, 0x1669, 0x398e, 0x1585, 0x3994, 0x14b1, 0x399a, 0x13f6, 0x39a2, 0x12b9, 0x39aa, 0x11a0, 0x39b0, 0x10a0,
+    0x39b7, 0x0f84, 0x39bd, 0x0df7, 0x39c4, 0x0cba, 0x39ca, 0x0b50, 0x39d2, 0x097e, 0x39d8, 0x07ef, 0x39df, 0x0573, 0x39e5, 0x0373,
+    0x39ba, 0x2c51, 0x3999, 0x2c1b, 0x397d, 0x2bcf, 0x3963, 0x2b6c, 0x394c, 0x2b0e, 0x3938, 0x2ab4, 0x3925, 0x2a5d, 0x3914, 0x2a0a,
+    0x3904, 0x29bb, 0x38f8, 0x296f, 0x38f1, 0x2927, 0x38ea, 0x28e2, 0x38e5, 0x289f, 0x38e0, 0x2860, 0x38dd, 0x2823, 0x38dc, 0x27d4,
+    0x38db, 0x2766, 0x38da, 0x26f9, 0x38da, 0x2692, 0x38db, 0x262f, 0x38dd, 0x25cf, 0x38de, 0x2573, 0x38e0, 0x251a, 0x38e2, 0x24c6,
+    0x38e4, 0x2476, 0x38e8, 0x242a, 0x38eb, 0x23c6, 0x38ef, 0x233a, 0x38f3, 0x22b6, 0x38f7, 0x2238, 0x38fb, 0x21bf, 0x38ff, 0x214c,
+    0x3903, 0x20e0, 0x3907, 0x207c, 0x390c, 0x201d, 0x3911, 0x1f86, 0x3916, 0x1edd, 0x391d, 0x1e40, 0x3923, 0x1dad, 0x392a, 0x1d24,
+    0x3930, 0x1ca5, 0x3936, 0x1c2e, 0x393b, 0x1b80, 0x3941, 0x1ab1, 0x3946, 0x19f1, 0x394c, 0x1944, 0x3953, 0x18a7, 0x3959, 0x1813,
+    0x395f, 0x171c, 0x3965, 0x162c, 0x396b, 0x1559, 0x3972, 0x1498, 0x3978, 0x13ce, 0x397e, 0x128c, 0x3985, 0x1179, 0x398b, 0x108d,
+    0x3991, 0x0f75, 0x3997, 0x0dff, 0x399d, 0x0cb6, 0x39a4, 0x0b4b, 0x39aa, 0x0985, 0x39b0, 0x0805, 0x39b6, 0x058f, 0x39bd, 0x0385,
+    0x39b7, 0x2c0e, 0x3998, 0x2bb6, 0x397c, 0x2b55, 0x3963, 0x2af8, 0x394d, 0x2a9f, 0x3938, 0x2a4a, 0x3926, 0x29f8, 0x3914, 0x29a9,
+    0x3904, 0x295f, 0x38fa, 0x2918, 0x38f2, 0x28d4, 0x38ea, 0x2893, 0x38e4, 0x2854, 0x38df, 0x2819, 0x38dc, 0x27bf, 0x38d9, 0x2753,
+    0x38d7, 0x26ec, 0x38d5, 0x2687, 0x38d5, 0x2625, 0x38d5, 0x25c8, 0x38d5, 0x256e, 0x38d5, 0x2519, 0x38d6, 0x24c7, 0x38d6, 0x2477,
+    0x38d9, 0x242c, 0x38db, 0x23cb, 0x38de, 0x2344, 0x38e0, 0x22c5, 0x38e3, 0x224b, 0x38e6, 0x21d5, 0x38e8, 0x2167, 0x38eb, 0x20fc,
+    0x38ef, 0x2097, 0x38f2, 0x2038, 0x38f6, 0x1fbe, 0x38fc, 0x1f1a, 0x3901, 0x1e7c, 0x3906, 0x1de8, 0x390b, 0x1d5d, 0x3910, 0x1cdd,
+    0x3915, 0x1c64, 0x391a, 0x1beb, 0x391e, 0x1b1d, 0x3923, 0x1a62, 0x3929, 0x19b0, 0x392e, 0x190c, 0x3934, 0x1872, 0x3939, 0x17d4,
+    0x393e, 0x16d9, 0x3943, 0x15f2, 0x3949, 0x1522, 0x394f, 0x146b, 0x3955, 0x138e, 0x395a, 0x126a, 0x395f, 0x1158, 0x3964, 0x106c,
+    0x396a, 0x0f3f, 0x3970, 0x0de4, 0x3977, 0x0cb1, 0x397c, 0x0b46, 0x3982, 0x097d, 0x3987, 0x0805, 0x398e, 0x0598, 0x3993, 0x039f,
+    0x39b2, 0x2b9d, 0x3995, 0x2b3e, 0x397a, 0x2ae3, 0x3962, 0x2a8c, 0x394c, 0x2a38, 0x3938, 0x29e7, 0x3925, 0x299a, 0x3913, 0x294f,
+    0x3904, 0x2909, 0x38fa, 0x28c6, 0x38f1, 0x2887, 0x38e9, 0x2849, 0x38e2, 0x280f, 0x38dd, 0x27ae, 0x38d9, 0x2743, 0x38d6, 0x26da,
+    0x38d2, 0x2678, 0x38d0, 0x261b, 0x38cf, 0x25c0, 0x38cd, 0x2567, 0x38cc, 0x2514, 0x38cb, 0x24c4, 0x38cb, 0x2478, 0x38cc, 0x242f,
+    0x38cd, 0x23d1, 0x38ce, 0x234a, 0x38cf, 0x22cc, 0x38d1, 0x2254, 0x38d2, 0x21e2, 0x38d4, 0x2177, 0x38d6, 0x210f, 0x38d8, 0x20af,
+    0x38db, 0x2052, 0x38de, 0x1ff3, 0x38e2, 0x1f4b, 0x38e7, 0x1ead, 0x38eb, 0x1e1c, 0x38ef, 0x1d94, 0x38f2, 0x1d13, 0x38f6, 0x1c99,
+    0x38fa, 0x1c2a, 0x38fd, 0x1b81, 0x3901, 0x1abd, 0x3906, 0x1a0b, 0x390b, 0x1967, 0x390f, 0x18d1, 0x3913, 0x1843, 0x3918, 0x177f,
+    0x391d, 0x1692, 0x3922, 0x15bb, 0x3927, 0x14f6, 0x392b, 0x1443, 0x3930, 0x1347, 0x3935, 0x1231, 0x393a, 0x113a, 0x393f, 0x1056,
+    0x3944, 0x0f1c, 0x394a, 0x0dc2, 0x394f, 0x0c9c, 0x3954, 0x0b39, 0x3959, 0x097f, 0x395f, 0x0808, 0x3964, 0x05a0, 0x3969, 0x03a2,
+    0x39ad, 0x2b27, 0x3991, 0x2ace, 0x3977, 0x2a79, 0x3960, 0x2a26, 0x394a, 0x29d7, 0x3936, 0x298b, 0x3923, 0x2942, 0x3911, 0x28fb,
+    0x3903, 0x28b9, 0x38f9, 0x287a, 0x38ef, 0x283e, 0x38e7, 0x2805, 0x38e0, 0x279c, 0x38da, 0x2733, 0x38d5, 0x26cd, 0x38d1, 0x266b,
+    0x38cd, 0x260d, 0x38ca, 0x25b4, 0x38c8, 0x2560, 0x38c5, 0x250e, 0x38c3, 0x24be, 0x38c1, 0x2474, 0x38c1, 0x242e, 0x38c1, 0x23d4,
+    0x38c0, 0x2353, 0x38c1, 0x22d5, 0x38c0, 0x225b, 0x38c1, 0x21ea, 0x38c1, 0x2180, 0x38c2, 0x211b, 0x38c3, 0x20bd, 0x38c4, 0x2061,
+    0x38c8, 0x200c, 0x38cb, 0x1f78, 0x38ce, 0x1edd, 0x38d1, 0x1e4c, 0x38d4, 0x1dc1, 0x38d6, 0x1d41, 0x38d9, 0x1cc9, 0x38db, 0x1c58,
+    0x38de, 0x1bdc, 0x38e1, 0x1b1a, 0x38e5, 0x1a65, 0x38e8, 0x19ba, 0x38ec, 0x191d, 0x38f0, 0x188e, 0x38f3, 0x180d, 0x38f8, 0x1729,
+    0x38fc, 0x164a, 0x3900, 0x157d, 0x3904, 0x14c8, 0x3908, 0x1420, 0x390d, 0x1312, 0x3911, 0x11fe, 0x3915, 0x110f, 0x391a, 0x103d,
+    0x391f, 0x0f05, 0x3923, 0x0dae, 0x3927, 0x0c84, 0x392c, 0x0b1c, 0x3931, 0x096f, 0x3935, 0x0804, 0x393a, 0x05a5, 0x393f, 0x03b5,
+    0x39a6, 0x2ab9, 0x398c, 0x2a66, 0x3973, 0x2a15, 0x395c, 0x29c8, 0x3946, 0x297d, 0x3932, 0x2934, 0x391f, 0x28ef, 0x390d, 0x28ad,
+    0x3901, 0x286f, 0x38f6, 0x2833, 0x38ec, 0x27f5, 0x38e4, 0x278a, 0x38dc, 0x2723, 0x38d6, 0x26bf, 0x38d0, 0x265f, 0x38cb, 0x2603,
+    0x38c7, 0x25a9, 0x38c3, 0x2555, 0x38bf, 0x2506, 0x38bc, 0x24ba, 0x38b9, 0x2470, 0x38b7, 0x242a, 0x38b6, 0x23cf, 0x38b4, 0x2350,
+    0x38b3, 0x22d7, 0x38b2, 0x2264, 0x38b1, 0x21f5, 0x38b0, 0x2189, 0x38b0, 0x2124, 0x38af, 0x20c6, 0x38b0, 0x206c, 0x38b2, 0x2019,
+    0x38b5, 0x1f91, 0x38b6, 0x1efb, 0x38b8, 0x1e6e, 0x38ba, 0x1de7, 0x38bc, 0x1d69, 0x38bd, 0x1cf1, 0x38bf, 0x1c81, 0x38c1, 0x1c19,
+    0x38c3, 0x1b6c, 0x38c6, 0x1ab5, 0x38c8, 0x1a0a, 0x38cb, 0x196f, 0x38ce, 0x18dd, 0x38d1, 0x1854, 0x38d4, 0x17af, 0x38d8, 0x16d0,
+    0x38db, 0x1603, 0x38df, 0x1546, 0x38e2, 0x1494, 0x38e6, 0x13f0, 0x38e9, 0x12d4, 0x38ed, 0x11d3, 0x38f1, 0x10e9, 0x38f4, 0x101b,
+    0x38f8, 0x0ed1, 0x38fc, 0x0d9b, 0x3900, 0x0c7e, 0x3904, 0x0b03, 0x3908, 0x0966, 0x390c, 0x0801, 0x3910, 0x05ad, 0x3914, 0x03b6,
+    0x399f, 0x2a53, 0x3985, 0x2a04, 0x396d, 0x29b8, 0x3957, 0x296f, 0x3942, 0x2928, 0x392e, 0x28e4, 0x391b, 0x28a2, 0x390a, 0x2864,
+    0x38fe, 0x2829, 0x38f3, 0x27e3, 0x38e8, 0x2778, 0x38df, 0x2712, 0x38d8, 0x26b1, 0x38d1, 0x2653, 0x38ca, 0x25f8, 0x38c5, 0x25a1,
+    0x38c0, 0x254e, 0x38bb, 0x24fe, 0x38b6, 0x24b2, 0x38b2, 0x246b, 0x38af, 0x2427, 0x38ac, 0x23ca, 0x38a9, 0x234a, 0x38a7, 0x22d3,
+    0x38a5, 0x2262, 0x38a3, 0x21f7, 0x38a1, 0x2191, 0x389f, 0x212e, 0x389e, 0x20cf, 0x389e, 0x2077, 0x389f, 0x2023, 0x38a0, 0x1fa7,
+    0x38a1, 0x1f14, 0x38a1, 0x1e87, 0x38a2, 0x1e02, 0x38a3, 0x1d88, 0x38a3, 0x1d13, 0x38a4, 0x1ca5, 0x38a5, 0x1c3d, 0x38a7, 0x1bb5,
+    0x38a9, 0x1b01, 0x38aa, 0x1a57, 0x38ac, 0x19b8, 0x38ae, 0x1922, 0x38b0, 0x189c, 0x38b3, 0x181f, 0x38b5, 0x1752, 0x38b8, 0x1679,
+    0x38ba, 0x15b4, 0x38bd, 0x1507, 0x38c0, 0x1464, 0x38c3, 0x139d, 0x38c5, 0x128b, 0x38c9, 0x119d, 0x38cc, 0x10c3, 0x38ce, 0x0ff8,
+    0x38d1, 0x0e98, 0x38d4, 0x0d64, 0x38d8, 0x0c64, 0x38db, 0x0af0, 0x38de, 0x0950, 0x38e2, 0x07f0, 0x38e5, 0x05a6, 0x38e9, 0x03be,
+    0x3996, 0x29f3, 0x397e, 0x29a9, 0x3966, 0x2961, 0x3951, 0x291c, 0x393c, 0x28d9, 0x3928, 0x2898, 0x3915, 0x285b, 0x3906, 0x2820,
+    0x38f9, 0x27d2, 0x38ee, 0x2767, 0x38e3, 0x2703, 0x38da, 0x26a2, 0x38d2, 0x2646, 0x38cb, 0x25ee, 0x38c4, 0x2598, 0x38be, 0x2546,
+    0x38b8, 0x24f8, 0x38b2, 0x24ad, 0x38ac, 0x2466, 0x38a8, 0x2423, 0x38a4, 0x23c6, 0x38a0, 0x234a, 0x389d, 0x22d3, 0x389a, 0x2261,
+    0x3896, 0x21f6, 0x3893, 0x2191, 0x3891, 0x2132, 0x388f, 0x20d9, 0x388e, 0x2082, 0x388e, 0x202f, 0x388d, 0x1fc1, 0x388d, 0x1f2d,
+    0x388d, 0x1ea1, 0x388c, 0x1e1d, 0x388c, 0x1da2, 0x388b, 0x1d2c, 0x388b, 0x1cc0, 0x388b, 0x1c5b, 0x388c, 0x1bf6, 0x388d, 0x1b41,
+    0x388e, 0x1a97, 0x388f, 0x19fa, 0x3890, 0x1966, 0x3891, 0x18dd, 0x3893, 0x185b, 0x3895, 0x17c7, 0x3896, 0x16f2, 0x3898, 0x162a,
+    0x3899, 0x1570, 0x389b, 0x14c4, 0x389d, 0x142b, 0x38a0, 0x1345, 0x38a2, 0x1249, 0x38a3, 0x115c, 0x38a6, 0x1090, 0x38a8, 0x0fb3,
+    0x38ab, 0x0e69, 0x38ad, 0x0d3c, 0x38af, 0x0c34, 0x38b2, 0x0aba, 0x38b6, 0x093c, 0x38b8, 0x07cb, 0x38bb, 0x0595, 0x38be, 0x03b5,
+    0x398d, 0x2999, 0x3975, 0x2954, 0x395f, 0x2910, 0x3949, 0x28ce, 0x3935, 0x288f, 0x3921, 0x2852, 0x390e, 0x2818, 0x3900, 0x27c1,
+    0x38f4, 0x2758, 0x38e8, 0x26f3, 0x38dd, 0x2695, 0x38d4, 0x263a, 0x38cc, 0x25e2, 0x38c3, 0x258e, 0x38bc, 0x253e, 0x38b5, 0x24f1,
+    0x38ae, 0x24a8, 0x38a8, 0x2462, 0x38a2, 0x241f, 0x389d, 0x23bd, 0x3898, 0x2345, 0x3894, 0x22d3, 0x3890, 0x2265, 0x388b, 0x21f9,
+    0x3887, 0x2193, 0x3883, 0x2135, 0x3880, 0x20dc, 0x387f, 0x2088, 0x387e, 0x2039, 0x387c, 0x1fd9, 0x387b, 0x1f46, 0x387a, 0x1ebc,
+    0x3878, 0x1e3a, 0x3877, 0x1dbe, 0x3875, 0x1d49, 0x3874, 0x1cdc, 0x3873, 0x1c72, 0x3873, 0x1c14, 0x3873, 0x1b76, 0x3873, 0x1ace,
+    0x3873, 0x1a32, 0x3873, 0x199f, 0x3874, 0x1915, 0x3875, 0x1897, 0x3876, 0x1820, 0x3877, 0x1764, 0x3877, 0x1693, 0x3878, 0x15d9,
+    0x3879, 0x152c, 0x387a, 0x1490, 0x387c, 0x13f8, 0x387d, 0x12f0, 0x387e, 0x1202, 0x387f, 0x112c, 0x3881, 0x1061, 0x3883, 0x0f61,
+    0x3885, 0x0e2e, 0x3887, 0x0d1e, 0x3889, 0x0c24, 0x388a, 0x0a88, 0x388c, 0x0918, 0x388f, 0x07b5, 0x3891, 0x0589, 0x3893, 0x03ba,
+    0x3982, 0x2946, 0x396c, 0x2904, 0x3956, 0x28c4, 0x3941, 0x2885, 0x392d, 0x2849, 0x3919, 0x2810, 0x3907, 0x27b2, 0x38f9, 0x274a,
+    0x38ed, 0x26e7, 0x38e1, 0x2688, 0x38d6, 0x262e, 0x38cd, 0x25d7, 0x38c4, 0x2584, 0x38bb, 0x2535, 0x38b3, 0x24ea, 0x38ac, 0x24a2,
+    0x38a4, 0x245d, 0x389d, 0x241b, 0x3897, 0x23b9, 0x3891, 0x233f, 0x388c, 0x22ce, 0x3887, 0x2262, 0x3881, 0x21fc, 0x387c, 0x219b,
+    0x3878, 0x213c, 0x3874, 0x20e2, 0x3871, 0x208e, 0x386f, 0x203e, 0x386d, 0x1fe7, 0x386a, 0x1f5b, 0x3868, 0x1ed4, 0x3865, 0x1e52,
+    0x3863, 0x1dd8, 0x3861, 0x1d66, 0x385f, 0x1cfa, 0x385d, 0x1c93, 0x385c, 0x1c32, 0x385b, 0x1bab, 0x385a, 0x1b01, 0x3859, 0x1a65,
+    0x3858, 0x19d2, 0x3859, 0x194a, 0x3859, 0x18ca, 0x3859, 0x1853, 0x3859, 0x17ce, 0x3858, 0x16fc, 0x3858, 0x1640, 0x3859, 0x158c,
+    0x3859, 0x14ea, 0x3859, 0x1455, 0x385a, 0x139a, 0x385a, 0x129f, 0x385b, 0x11bc, 0x385c, 0x10f2, 0x385d, 0x103d, 0x385f, 0x0f25,
+    0x385f, 0x0df5, 0x3860, 0x0ced, 0x3862, 0x0c0a, 0x3863, 0x0a74, 0x3864, 0x08fd, 0x3866, 0x078d, 0x3867, 0x0575, 0x3869, 0x03ad,
+    0x3977, 0x28f8, 0x3961, 0x28ba, 0x394c, 0x287d, 0x3937, 0x2841, 0x3924, 0x2808, 0x3910, 0x27a4, 0x38ff, 0x273d, 0x38f2, 0x26db,
+    0x38e5, 0x267d, 0x38d9, 0x2624, 0x38ce, 0x25ce, 0x38c4, 0x257c, 0x38ba, 0x252d, 0x38b2, 0x24e2, 0x38a9, 0x249c, 0x38a1, 0x2458,
+    0x3899, 0x2417, 0x3892, 0x23b3, 0x388b, 0x233d, 0x3885, 0x22cc, 0x387f, 0x225f, 0x3878, 0x21fa, 0x3872, 0x219b, 0x386d, 0x2141,
+    0x3868, 0x20eb, 0x3865, 0x2096, 0x3861, 0x2046, 0x385e, 0x1ff5, 0x385b, 0x1f67, 0x3858, 0x1ee2, 0x3854, 0x1e65, 0x3851, 0x1def,
+    0x384d, 0x1d7c, 0x384b, 0x1d10, 0x3849, 0x1cac, 0x3847, 0x1c4e, 0x3845, 0x1be7, 0x3843, 0x1b3e, 0x3841, 0x1a9d, 0x3840, 0x1a05,
+    0x383f, 0x197c, 0x383e, 0x18fc, 0x383d, 0x1883, 0x383c, 0x1814, 0x383b, 0x175a, 0x383b, 0x169e, 0x383a, 0x15eb, 0x3839, 0x1544,
+    0x3839, 0x14aa, 0x3838, 0x141d, 0x3838, 0x133d, 0x3838, 0x124f, 0x3839, 0x117a, 0x3839, 0x10b6, 0x3839, 0x1009, 0x383a, 0x0ee1,
+    0x383a, 0x0dc5, 0x383a, 0x0cc2, 0x383b, 0x0bbf, 0x383b, 0x0a3c, 0x383c, 0x08e6, 0x383d, 0x0762, 0x383e, 0x055e, 0x383f, 0x03ac,
+    0x396b, 0x28af, 0x3956, 0x2874, 0x3941, 0x283a, 0x392d, 0x2802, 0x3919, 0x2798, 0x3906, 0x2731, 0x38f6, 0x26cf, 0x38e9, 0x2672,
+    0x38dc, 0x2619, 0x38d0, 0x25c5, 0x38c5, 0x2574, 0x38bb, 0x2526, 0x38b1, 0x24dc, 0x38a8, 0x2495, 0x389f, 0x2453, 0x3896, 0x2413,
+    0x388d, 0x23ad, 0x3886, 0x2338, 0x387f, 0x22c9, 0x3878, 0x225e, 0x3871, 0x21f9, 0x386a, 0x2199, 0x3864, 0x2140, 0x385e, 0x20eb,
+    0x3859, 0x209c, 0x3855, 0x204e, 0x3851, 0x2003, 0x384d, 0x1f77, 0x3848, 0x1ef1, 0x3844, 0x1e72, 0x3840, 0x1dfc, 0x383c, 0x1d8d,
+    0x3838, 0x1d25, 0x3835, 0x1cbf, 0x3832, 0x1c60, 0x3830, 0x1c09, 0x382d, 0x1b6c, 0x382a, 0x1ace, 0x3829, 0x1a3b, 0x3827, 0x19af,
+    0x3825, 0x192a, 0x3823, 0x18b2, 0x3821, 0x1842, 0x381f, 0x17b1, 0x381e, 0x16ed, 0x381c, 0x1638, 0x381b, 0x1595, 0x381a, 0x14ff,
+    0x3819, 0x1470, 0x3818, 0x13d7, 0x3818, 0x12e1, 0x3817, 0x1208, 0x3817, 0x113d, 0x3816, 0x1086, 0x3815, 0x0fb7, 0x3815, 0x0e8f,
+    0x3814, 0x0d86, 0x3814, 0x0c98, 0x3814, 0x0b7b, 0x3814, 0x0a00, 0x3814, 0x08b9, 0x3815, 0x073b, 0x3815, 0x0545, 0x3815, 0x039a,
+    0x395e, 0x286b, 0x394a, 0x2833, 0x3936, 0x27f8, 0x3922, 0x278d, 0x390e, 0x2726, 0x38fb, 0x26c5, 0x38ec, 0x2668, 0x38df, 0x2610,
+    0x38d2, 0x25bd, 0x38c6, 0x256d, 0x38bb, 0x2520, 0x38b0, 0x24d7, 0x38a6, 0x2491, 0x389d, 0x244e, 0x3893, 0x240f, 0x388a, 0x23a5,
+    0x3881, 0x2333, 0x3879, 0x22c6, 0x3871, 0x225d, 0x386a, 0x21f9, 0x3862, 0x219a, 0x385b, 0x2140, 0x3854, 0x20ea, 0x384e, 0x209a,
+    0x3849, 0x204f, 0x3845, 0x2008, 0x3840, 0x1f87, 0x383a, 0x1f01, 0x3835, 0x1e82, 0x3830, 0x1e0b, 0x382b, 0x1d9b, 0x3827, 0x1d31,
+    0x3823, 0x1ccf, 0x381f, 0x1c72, 0x381c, 0x1c1a, 0x3818, 0x1b8c, 0x3815, 0x1af3, 0x3813, 0x1a63, 0x3810, 0x19da, 0x380e, 0x195a,
+    0x380b, 0x18e0, 0x3808, 0x186b, 0x3805, 0x1802, 0x3803, 0x1740, 0x3801, 0x1689, 0x37fd, 0x15df, 0x37f9, 0x1540, 0x37f6, 0x14b2,
+    0x37f3, 0x1431, 0x37f1, 0x136f, 0x37ee, 0x128d, 0x37ec, 0x11b7, 0x37ea, 0x10fd, 0x37e6, 0x1051, 0x37e4, 0x0f69, 0x37e2, 0x0e44,
+    0x37e0, 0x0d48, 0x37df, 0x0c68, 0x37de, 0x0b44, 0x37dc, 0x09d4, 0x37db, 0x0896, 0x37d9, 0x06ff, 0x37d9, 0x0526, 0x37d9, 0x0391,
+    0x3951, 0x282b, 0x393d, 0x27eb, 0x3929, 0x2783, 0x3916, 0x271d, 0x3903, 0x26bc, 0x38f0, 0x2660, 0x38e2, 0x2608, 0x38d4, 0x25b5,
+    0x38c7, 0x2566, 0x38bb, 0x251a, 0x38b0, 0x24d2, 0x38a5, 0x248c, 0x389b, 0x244a, 0x3891, 0x240c, 0x3886, 0x239e, 0x387d, 0x232d,
+    0x3874, 0x22c1, 0x386c, 0x225a, 0x3863, 0x21f8, 0x385b, 0x219b, 0x3853, 0x2142, 0x384b, 0x20ed, 0x3844, 0x209b, 0x383e, 0x204f,
+    0x3839, 0x2008, 0x3833, 0x1f8a, 0x382d, 0x1f0b, 0x3827, 0x1e91, 0x3821, 0x1e1a, 0x381c, 0x1da9, 0x3816, 0x1d3f, 0x3812, 0x1cdb,
+    0x380e, 0x1c7f, 0x3809, 0x1c29, 0x3805, 0x1bad, 0x3801, 0x1b11, 0x37fc, 0x1a7d, 0x37f6, 0x19f6, 0x37ef, 0x1979, 0x37e8, 0x1903,
+    0x37e0, 0x1895, 0x37da, 0x182b, 0x37d3, 0x178b, 0x37cd, 0x16d3, 0x37c8, 0x1629, 0x37c3, 0x158a, 0x37be, 0x14f6, 0x37b9, 0x146d,
+    0x37b5, 0x13dd, 0x37b1, 0x12ff, 0x37ae, 0x1230, 0x37aa, 0x1172, 0x37a5, 0x10ba, 0x37a1, 0x1019, 0x379f, 0x0f12, 0x379c, 0x0e0c,
+    0x3798, 0x0d12, 0x3796, 0x0c38, 0x3794, 0x0af5, 0x3791, 0x09a9, 0x378f, 0x0876, 0x378c, 0x06d7, 0x378a, 0x050d, 0x3788, 0x037d,
+    0x3943, 0x27de, 0x392f, 0x2779, 0x391c, 0x2715, 0x3909, 0x26b5, 0x38f6, 0x2658, 0x38e4, 0x2601, 0x38d6, 0x25ae, 0x38c8, 0x255f,
+    0x38bb, 0x2514, 0x38b0, 0x24cc, 0x38a4, 0x2488, 0x3899, 0x2447, 0x388e, 0x2408, 0x3884, 0x239a, 0x3879, 0x2328, 0x3870, 0x22bc,
+    0x3866, 0x2256, 0x385d, 0x21f5, 0x3854, 0x219a, 0x384b, 0x2142, 0x3843, 0x20f0, 0x383b, 0x20a0, 0x3835, 0x2053, 0x382e, 0x200a,
+    0x3828, 0x1f8d, 0x3821, 0x1f0d, 0x381a, 0x1e96, 0x3814, 0x1e25, 0x380d, 0x1db7, 0x3807, 0x1d4e, 0x3802, 0x1cea, 0x37fa, 0x1c8d,
+    0x37f0, 0x1c35, 0x37e5, 0x1bc5, 0x37dd, 0x1b2d, 0x37d5, 0x1a9e, 0x37cd, 0x1a16, 0x37c5, 0x1994, 0x37bc, 0x191d, 0x37b3, 0x18b0,
+    0x37ab, 0x184a, 0x37a4, 0x17d3, 0x379d, 0x171e, 0x3796, 0x166d, 0x3790, 0x15cd, 0x378a, 0x153b, 0x3784, 0x14b1, 0x377e, 0x1432,
+    0x3779, 0x1374, 0x3773, 0x1299, 0x376d, 0x11d5, 0x3767, 0x1123, 0x3763, 0x1080, 0x375e, 0x0fc6, 0x375a, 0x0eb1, 0x3756, 0x0dbb,
+    0x3753, 0x0cdf, 0x374f, 0x0c0f, 0x374a, 0x0aa9, 0x3746, 0x0966, 0x3743, 0x084e, 0x3740, 0x069a, 0x373c, 0x04e6, 0x373a, 0x036d,
+    0x3934, 0x276e, 0x3921, 0x270e, 0x390e, 0x26af, 0x38fb, 0x2653, 0x38e9, 0x25fb, 0x38d8, 0x25a8, 0x38ca, 0x255a, 0x38bc, 0x250f,
+    0x38af, 0x24c8, 0x38a3, 0x2484, 0x3897, 0x2443, 0x388c, 0x2405, 0x3881, 0x2394, 0x3876, 0x2324, 0x386b, 0x22b9, 0x3861, 0x2252,
+    0x3858, 0x21f2, 0x384e, 0x2197, 0x3844, 0x2141, 0x383b, 0x20f0, 0x3833, 0x20a1, 0x382b, 0x2057, 0x3824, 0x200f, 0x381d, 0x1f94,
+    0x3816, 0x1f11, 0x380e, 0x1e99, 0x3807, 0x1e27, 0x3800, 0x1dbc, 0x37f2, 0x1d59, 0x37e7, 0x1cf9, 0x37db, 0x1c9c, 0x37cf, 0x1c44,
+    0x37c4, 0x1be3, 0x37ba, 0x1b49, 0x37b1, 0x1ab8, 0x37a8, 0x1a34, 0x379e, 0x19b7, 0x3793, 0x1940, 0x3789, 0x18cd, 0x3780, 0x1864,
+    0x3777, 0x1803, 0x376e, 0x1754, 0x3767, 0x16ad, 0x3760, 0x1611, 0x3758, 0x1579, 0x3751, 0x14ed, 0x374a, 0x146e, 0x3743, 0x13ed,
+    0x373d, 0x1313, 0x3735, 0x1246, 0x372e, 0x1185, 0x3728, 0x10da, 0x3722, 0x1040, 0x371d, 0x0f6e, 0x3717, 0x0e61, 0x3712, 0x0d71,
+    0x370d, 0x0c9b, 0x3708, 0x0bc6, 0x3702, 0x0a68, 0x36fd, 0x092b, 0x36f9, 0x081d, 0x36f5, 0x0667, 0x36f0, 0x04c2, 0x36ec, 0x0357,
+    0x3925, 0x2705, 0x3912, 0x26a9, 0x3900, 0x264f, 0x38ed, 0x25f7, 0x38db, 0x25a4, 0x38ca, 0x2555, 0x38bc, 0x250a, 0x38af, 0x24c3,
+    0x38a2, 0x2480, 0x3896, 0x243f, 0x388a, 0x2402, 0x387e, 0x238f, 0x3873, 0x2320, 0x3867, 0x22b6, 0x385d, 0x2251, 0x3853, 0x21f0,
+    0x3848, 0x2194, 0x383e, 0x213f, 0x3834, 0x20ed, 0x382b, 0x20a1, 0x3822, 0x2058, 0x381b, 0x2012, 0x3813, 0x1f9d, 0x380b, 0x1f1b,
+    0x3803, 0x1ea0, 0x37f6, 0x1e2b, 0x37e7, 0x1dc1, 0x37d8, 0x1d5d, 0x37cb, 0x1d00, 0x37be, 0x1ca8, 0x37b1, 0x1c53, 0x37a5, 0x1c02,
+    0x3799, 0x1b69, 0x378f, 0x1ad8, 0x3784, 0x1a4f, 0x3779, 0x19d0, 0x376d, 0x195b, 0x3762, 0x18ec, 0x3757, 0x1884, 0x374d, 0x1820,
+    0x3743, 0x1787, 0x373a, 0x16dc, 0x3732, 0x163f, 0x3729, 0x15ae, 0x3721, 0x1526, 0x3718, 0x14a4, 0x3710, 0x1429, 0x3708, 0x1377,
+    0x3700, 0x12a9, 0x36f8, 0x11ed, 0x36f1, 0x113e, 0x36ea, 0x1098, 0x36e3, 0x1006, 0x36dd, 0x0f03, 0x36d6, 0x0e18, 0x36d0, 0x0d37,
+    0x36c9, 0x0c67, 0x36c2, 0x0b5e, 0x36bd, 0x0a25, 0x36b8, 0x0903, 0x36b2, 0x07f2, 0x36ac, 0x062b, 0x36a7, 0x049c, 0x36a2, 0x0343,
+    0x3915, 0x26a3, 0x3903, 0x264b, 0x38f1, 0x25f5, 0x38de, 0x25a1, 0x38cc, 0x2552, 0x38bc, 0x2507, 0x38ae, 0x24c0, 0x38a1, 0x247d,
+    0x3894, 0x243d, 0x3887, 0x23ff, 0x387b, 0x238b, 0x3870, 0x231c, 0x3864, 0x22b3, 0x3858, 0x224e, 0x384e, 0x21ef, 0x3843, 0x2194,
+    0x3838, 0x213d, 0x382e, 0x20ec, 0x3824, 0x209f, 0x381a, 0x2056, 0x3812, 0x2012, 0x380a, 0x1f9f, 0x3801, 0x1f23, 0x37f2, 0x1eab,
+    0x37e0, 0x1e37, 0x37cf, 0x1dc9, 0x37bf, 0x1d63, 0x37b1, 0x1d05, 0x37a3, 0x1cac, 0x3795, 0x1c5a, 0x3787, 0x1c0d, 0x377b, 0x1b85,
+    0x376f, 0x1af7, 0x3763, 0x1a70, 0x3757, 0x19f1, 0x3749, 0x1978, 0x373d, 0x1908, 0x3731, 0x189f, 0x3725, 0x183d, 0x371b, 0x17c5,
+    0x3711, 0x1715, 0x3707, 0x1672, 0x36fc, 0x15dc, 0x36f3, 0x1551, 0x36ea, 0x14d2, 0x36e1, 0x145e, 0x36d7, 0x13da, 0x36cd, 0x1305,
+    0x36c4, 0x1247, 0x36bc, 0x1198, 0x36b5, 0x10f5, 0x36ad, 0x1060, 0x36a5, 0x0fa2, 0x369d, 0x0ea4, 0x3695, 0x0dbf, 0x368e, 0x0cf6,
+    0x3686, 0x0c37, 0x3680, 0x0b12, 0x3679, 0x09db, 0x3673, 0x08ce, 0x366c, 0x07b7, 0x3665, 0x05f6, 0x365f, 0x047a, 0x3659, 0x032d,
+    0x3905, 0x2647, 0x38f3, 0x25f3, 0x38e1, 0x25a0, 0x38cf, 0x2551, 0x38bc, 0x2505, 0x38ae, 0x24be, 0x38a0, 0x247a, 0x3892, 0x243a,
+    0x3885, 0x23fb, 0x3879, 0x2387, 0x386d, 0x2318, 0x3860, 0x22b0, 0x3854, 0x224c, 0x3849, 0x21ec, 0x383e, 0x2193, 0x3833, 0x213e,
+    0x3828, 0x20ec, 0x381d, 0x209e, 0x3812, 0x2056, 0x3809, 0x2010, 0x3801, 0x1f9f, 0x37f0, 0x1f25, 0x37de, 0x1eb0, 0x37cc, 0x1e41,
+    0x37ba, 0x1dd7, 0x37a8, 0x1d70, 0x3798, 0x1d0d, 0x3789, 0x1cb3, 0x377a, 0x1c5f, 0x376b, 0x1c11, 0x375d, 0x1b93, 0x3751, 0x1b0d,
+    0x3744, 0x1a8a, 0x3736, 0x1a0c, 0x3728, 0x1995, 0x371a, 0x1925, 0x370d, 0x18bb, 0x3701, 0x1859, 0x36f5, 0x17fa, 0x36e9, 0x174c,
+    0x36df, 0x16ac, 0x36d3, 0x1613, 0x36c9, 0x1584, 0x36be, 0x1502, 0x36b4, 0x1487, 0x36a9, 0x1419, 0x369e, 0x1367, 0x3694, 0x12a3,
+    0x368b, 0x11ea, 0x3683, 0x1143, 0x367a, 0x10af, 0x3671, 0x1024, 0x3668, 0x0f45, 0x365f, 0x0e50, 0x3656, 0x0d75, 0x364e, 0x0cae,
+    0x3647, 0x0c04, 0x363f, 0x0ac2, 0x3637, 0x099a, 0x362e, 0x0893, 0x3627, 0x0754, 0x3620, 0x05bd, 0x3619, 0x044f, 0x3612, 0x0315,
+    0x38f4, 0x25f0, 0x38e3, 0x25a0, 0x38d1, 0x2551, 0x38bf, 0x2505, 0x38ad, 0x24bd, 0x389e, 0x2479, 0x3890, 0x2439, 0x3883, 0x23f8,
+    0x3876, 0x2385, 0x3869, 0x2316, 0x385d, 0x22ad, 0x3850, 0x2249, 0x3844, 0x21eb, 0x3839, 0x2191, 0x382d, 0x213c, 0x3822, 0x20ed,
+    0x3816, 0x20a0, 0x380b, 0x2057, 0x3801, 0x2011, 0x37f0, 0x1fa0, 0x37de, 0x1f25, 0x37cb, 0x1eb1, 0x37b8, 0x1e45, 0x37a5, 0x1ddc,
+    0x3792, 0x1d7a, 0x3781, 0x1d1b, 0x3771, 0x1cbf, 0x3761, 0x1c69, 0x3751, 0x1c19, 0x3742, 0x1b9f, 0x3734, 0x1b15, 0x3726, 0x1a96,
+    0x3717, 0x1a1e, 0x3708, 0x19ab, 0x36f9, 0x193d, 0x36eb, 0x18d3, 0x36dd, 0x1871, 0x36d0, 0x1814, 0x36c4, 0x177c, 0x36b8, 0x16dc,
+    0x36ac, 0x1643, 0x36a1, 0x15b7, 0x3695, 0x1532, 0x368a, 0x14b6, 0x367e, 0x1445, 0x3672, 0x13b2, 0x3667, 0x12f0, 0x365d, 0x1243,
+    0x3654, 0x119b, 0x3649, 0x10f9, 0x363f, 0x1068, 0x3635, 0x0fcb, 0x362c, 0x0edd, 0x3622, 0x0e02, 0x3619, 0x0d30, 0x3610, 0x0c74,
+    0x3607, 0x0b92, 0x35ff, 0x0a6f, 0x35f5, 0x095b, 0x35ed, 0x085d, 0x35e5, 0x0703, 0x35dd, 0x0580, 0x35d5, 0x042b, 0x35ce, 0x02fd,
+    0x38e3, 0x259f, 0x38d2, 0x2552, 0x38c0, 0x2507, 0x38ae, 0x24be, 0x389d, 0x247a, 0x388f, 0x2439, 0x3880, 0x23f7, 0x3873, 0x2383,
+    0x3866, 0x2315, 0x3859, 0x22ac, 0x384d, 0x2249, 0x3840, 0x21ea, 0x3834, 0x2191, 0x3828, 0x213c, 0x381c, 0x20ec, 0x3810, 0x20a0,
+    0x3805, 0x2059, 0x37f4, 0x2014, 0x37e0, 0x1fa3, 0x37cd, 0x1f27, 0x37b9, 0x1eb3, 0x37a5, 0x1e46, 0x3791, 0x1ddf, 0x377e, 0x1d7d,
+    0x376b, 0x1d21, 0x375a, 0x1cca, 0x3749, 0x1c76, 0x3738, 0x1c25, 0x3727, 0x1bb1, 0x3719, 0x1b25, 0x370a, 0x1aa3, 0x36fa, 0x1a27,
+    0x36e9, 0x19b5, 0x36d9, 0x194c, 0x36cb, 0x18e7, 0x36bc, 0x1886, 0x36ae, 0x1829, 0x36a1, 0x17a4, 0x3694, 0x1700, 0x3687, 0x166b,
+    0x367b, 0x15e2, 0x366e, 0x155e, 0x3662, 0x14e2, 0x3655, 0x146e, 0x3648, 0x1402, 0x363c, 0x133f, 0x3631, 0x1285, 0x3627, 0x11da,
+    0x361c, 0x1145, 0x3611, 0x10b6, 0x3606, 0x1029, 0x35fb, 0x0f57, 0x35f0, 0x0e74, 0x35e7, 0x0daa, 0x35de, 0x0cee, 0x35d4, 0x0c3b,
+    0x35ca, 0x0b36, 0x35c0, 0x0a11, 0x35b7, 0x091d, 0x35ae, 0x0834, 0x35a5, 0x06ba, 0x359c, 0x054c, 0x3594, 0x0405, 0x358b, 0x02e5,
+    0x38d2, 0x2553, 0x38c1, 0x2509, 0x38af, 0x24c1, 0x389d, 0x247c, 0x388c, 0x243a, 0x387e, 0x23f9, 0x3870, 0x2384, 0x3863, 0x2316,
+    0x3855, 0x22ad, 0x3849, 0x2249, 0x383c, 0x21ea, 0x382f, 0x2191, 0x3823, 0x213c, 0x3817, 0x20ec, 0x380b, 0x20a1, 0x37fd, 0x2059,
+    0x37e6, 0x2016, 0x37d0, 0x1faa, 0x37bc, 0x1f2e, 0x37a8, 0x1eb7, 0x3793, 0x1e48, 0x377e, 0x1ddf, 0x376a, 0x1d7f, 0x3756, 0x1d24,
+    0x3744, 0x1ccd, 0x3732, 0x1c7d, 0x3720, 0x1c30, 0x370f, 0x1bcc, 0x36ff, 0x1b3c, 0x36ef, 0x1ab4, 0x36de, 0x1a36, 0x36cc, 0x19c2,
+    0x36bb, 0x1955, 0x36ac, 0x18ef, 0x369c, 0x1891, 0x368e, 0x1838, 0x3680, 0x17c8, 0x3672, 0x1727, 0x3664, 0x1690, 0x3656, 0x1601,
+    0x3649, 0x157e, 0x363c, 0x1506, 0x362e, 0x1495, 0x3621, 0x142a, 0x3614, 0x1388, 0x3608, 0x12cc, 0x35fd, 0x1222, 0x35f1, 0x1182,
+    0x35e5, 0x10ee, 0x35d9, 0x106b, 0x35ce, 0x0fe1, 0x35c2, 0x0ef2, 0x35b8, 0x0e19, 0x35ad, 0x0d53, 0x35a3, 0x0ca5, 0x3599, 0x0c07,
+    0x358e, 0x0ade, 0x3584, 0x09c8, 0x357a, 0x08d0, 0x3571, 0x0802, 0x3567, 0x067f, 0x355e, 0x0515, 0x3554, 0x03de, 0x354b, 0x02ce,
+    0x38c0, 0x250b, 0x38af, 0x24c5, 0x389e, 0x247f, 0x388c, 0x243d, 0x387c, 0x23fe, 0x386d, 0x2387, 0x385f, 0x2318, 0x3852, 0x22af,
+    0x3845, 0x224b, 0x3838, 0x21ec, 0x382a, 0x2192, 0x381e, 0x213d, 0x3811, 0x20ed, 0x3805, 0x20a2, 0x37f1, 0x205a, 0x37d9, 0x2016,
+    0x37c1, 0x1fad, 0x37ad, 0x1f33, 0x3798, 0x1ebf, 0x3782, 0x1e50, 0x376d, 0x1de5, 0x3757, 0x1d82, 0x3742, 0x1d25, 0x372f, 0x1ccf,
+    0x371c, 0x1c7f, 0x370a, 0x1c33, 0x36f7, 0x1bd9, 0x36e7, 0x1b51, 0x36d6, 0x1acc, 0x36c4, 0x1a4b, 0x36b1, 0x19d2, 0x369f, 0x1963,
+    0x368f, 0x18fc, 0x367e, 0x189c, 0x366f, 0x1842, 0x3660, 0x17dc, 0x3651, 0x1740, 0x3643, 0x16ad, 0x3634, 0x1622, 0x3626, 0x159f,
+    0x3618, 0x1521, 0x3609, 0x14af, 0x35fb, 0x1449, 0x35ee, 0x13cf, 0x35e2, 0x1317, 0x35d5, 0x1265, 0x35c8, 0x11c2, 0x35bb, 0x112c,
+    0x35af, 0x10a2, 0x35a3, 0x1022, 0x3596, 0x0f63, 0x358b, 0x0e8f, 0x3581, 0x0dc2, 0x3575, 0x0d09, 0x356a, 0x0c5c, 0x355e, 0x0b91,
+    0x3554, 0x0a83, 0x354a, 0x0984, 0x353f, 0x0898, 0x3534, 0x078a, 0x352a, 0x0624, 0x3521, 0x04dc, 0x3517, 0x03b5, 0x350e, 0x02b2,
+};
+
+#endif
@@ -0,0 +1,257 @@
+#ifndef _IBL_BAKE_QUEUE_H_
+#define _IBL_BAKE_QUEUE_H_
+
+#pragma once
+
+#include <GL/glew.h>
+
+#include <chrono>
+#include <cmath>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// the IBL bake as a list of bounded slices of work (a few rows of one capture, one mip copy, ...),
+// so it can either be drained in one go or spread over frames under a time budget.
+// a slice returns false when it can't run yet (e.g. it waits for a worker thread); it's retried later.
+class IblBakeQueue {
+public:
+    IblBakeQueue() {}
+    IblBakeQueue(const IblBakeQueue &) = delete;
+    IblBakeQueue &operator=(const IblBakeQueue &) = delete;
+
+    ~IblBakeQueue()
+    {
+        if (submitted)
+            glDeleteSync(submitted);
+    }
+
+    void add(const std::function<bool()> &slice)
+    {
+        slices.push_back(slice);
+    }
+
+    // drops every slice that hasn't run yet (safe to call from inside a slice).
+    void cancel()
+    {
+        cancelled = true;
+    }
+
+    bool done() const
+    {
+        return slices.empty();
+    }
+
+    // CPU time spent in slices that ran so far (recording and submitting their GPU work, not running it);
+    // slices that weren't ready yet don't count
+    double elapsedMs() const
+    {
+        return spentMs;
+    }
+
+    // runs up to maxSlices slices (each sized to a bounded amount of GPU work), stopping early once budgetMs
+    // of CPU time have been spent. Nothing waits for the GPU: a fence after the slices is checked by the next
+    // run(), which skips its frame while the GPU is still on the previous slices, so the bake never gets more
+    // than one frame of work ahead. returns true once the queue is empty.
+    bool run(unsigned int maxSlices, double budgetMs)
+    {
+        if (submitted)
+        {
+            GLenum state = glClientWaitSync(submitted, 0, 0);
+            if (state != GL_ALREADY_SIGNALED && state != GL_CONDITION_SATISFIED)
+                return slices.empty();
+            glDeleteSync(submitted);
+            submitted = 0;
+        }
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (unsigned int n = 0; n < maxSlices && !slices.empty(); ++n)
+        {
+            std::chrono::steady_clock::time_point sliceStart = std::chrono::steady_clock::now();
+            bool finished = step();
+            if (!finished)
+                break;
+            spentMs += millisecondsSince(sliceStart);
+            if (millisecondsSince(start) >= budgetMs)
+                break;
+        }
+        submitted = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        return slices.empty();
+    }
+
+    // runs everything right now (the blocking bake).
+    void finish()
+    {
+        while (!slices.empty())
+        {
+            std::chrono::steady_clock::time_point sliceStart = std::chrono::steady_clock::now();
+            if (step())
+                spentMs += millisecondsSince(sliceStart);
+            else
+                std::this_thread::yield();
+        }
+    }
+
+private:
+    std::deque<std::function<bool()> > slices;
+    GLsync submitted = 0;    // behind the slices of the last run()
+    bool cancelled = false;
+    double spentMs = 0.0;
+
+    static double millisecondsSince(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    bool step()
+    {
+        // slices may add more slices, which doesn't invalidate the reference to the front one
+        bool finished = slices.front()();
+        if (finished)
+            slices.pop_front();
+        if (cancelled)
+        {
+            slices.clear();
+            cancelled = false;
+        }
+        return finished;
+    }
+};
+
+// GPU time of the bake passes per path (raster or compute), summed over their slices with GL_TIME_ELAPSED
+// queries. Only timed when enabled (IBL_BAKE_COMPARE_PATHS). Nothing waits for a result: poll() picks up the
+// ones that are available, once per frame, and prints a report() once every pass before it is in.
+class IblPassTimings {
+public:
+    explicit IblPassTimings(bool enabled) : enabled(enabled) {}
+    IblPassTimings(const IblPassTimings &) = delete;
+    IblPassTimings &operator=(const IblPassTimings &) = delete;
+
+    ~IblPassTimings()
+    {
+        for (unsigned int i = 0; i < pending.size(); ++i)
+            freeQueries.push_back(pending[i].query);
+        if (!freeQueries.empty())
+            glDeleteQueries((GLsizei)freeQueries.size(), freeQueries.data());
+    }
+
+    void begin()
+    {
+        if (!enabled)
+            return;
+        Timing timing;
+        if (freeQueries.empty())
+            glGenQueries(1, &timing.query);
+        else
+        {
+            timing.query = freeQueries.back();
+            freeQueries.pop_back();
+        }
+        pending.push_back(timing);
+        glBeginQuery(GL_TIME_ELAPSED, timing.query);
+    }
+
+    void end(const std::string &pass, bool compute)
+    {
+        if (!enabled)
+            return;
+        glEndQuery(GL_TIME_ELAPSED);
+        pending.back().pass = pass;
+        pending.back().compute = compute;
+        ++ended;
+    }
+
+    // prints the passes timed so far and starts over, once their results are in
+    void report(const std::string &title)
+    {
+        if (!enabled)
+            return;
+        reports.push_back({ title, ended });
+        poll();
+    }
+
+    // collects the results the GPU has finished, oldest first; call once per frame
+    void poll()
+    {
+        printReady();
+        while (!pending.empty())
+        {
+            GLuint available = 0;
+            glGetQueryObjectuiv(pending.front().query, GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available)
+                break;
+            GLuint64 ns = 0;
+            glGetQueryObjectui64v(pending.front().query, GL_QUERY_RESULT, &ns);
+            add(pending.front().pass, pending.front().compute, ns / 1e6);
+            freeQueries.push_back(pending.front().query);
+            pending.pop_front();
+            ++collected;
+            printReady();
+        }
+    }
+
+private:
+    struct Pass {
+        std::string name;
+        double ms[2];
+    };
+    struct Timing {
+        unsigned int query = 0;
+        std::string pass;
+        bool compute = false;
+    };
+    struct Report {
+        std::string title;
+        size_t upTo;    // passes ended before it
+    };
+    bool enabled;
+    std::vector<Pass> passes;
+    std::deque<Timing> pending;             // ended or running, oldest first
+    std::vector<unsigned int> freeQueries;
+    std::deque<Report> reports;
+    size_t ended = 0, collected = 0;
+
+    void add(const std::string &pass, bool compute, double ms)
+    {
+        unsigned int i = 0;
+        while (i < passes.size() && passes[i].name != pass)
+            ++i;
+        if (i == passes.size())
+            passes.push_back({ pass, { 0.0, 0.0 } });
+        passes[i].ms[compute ? 1 : 0] += ms;
+    }
+
+    void printReady()
+    {
+        while (!reports.empty() && reports.front().upTo <= collected)
+        {
+            print(reports.front().title);
+            reports.pop_front();
+        }
+    }
+
+    void print(const std::string &title)
+    {
+        if (passes.empty())
+            return;
+        std::cout << title << " GPU time per pass (raster / compute):";
+        for (unsigned int i = 0; i < passes.size(); ++i)
+        {
+            std::cout << (i ? ", " : " ") << passes[i].name << " ";
+            for (int path = 0; path < 2; ++path)
+            {
+                std::cout << (path ? " / " : "");
+                if (passes[i].ms[path] > 0.0)
+                    std::cout << std::floor(passes[i].ms[path] * 100.0 + 0.5) / 100.0 << " ms";
+                else
+                    std::cout << "-";
+            }
+        }
+        std::cout << std::endl;
+        passes.clear();
+    }
+};
+
+#endif
@@ -0,0 +1,559 @@
+#define _CRT_SECURE_NO_WARNINGS
+// Headless IBL baker: runs the CPU version of the equirect, irradiance, prefilter and BRDF passes and
+// writes the result in the IBL cache format, so the demo picks it up without baking on the GPU.
+//
+// usage: IBL_bake [hdr path] [output cache] [--compare other.iblcache] [--brdf-table brdf_lut_table.h]
+//                 [--layout-benchmark] [--hdr-benchmark]
+#include <GL/glew.h>
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+#undef STB_IMAGE_IMPLEMENTATION
+
+#include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include "ibl_cache.h"
+#include "ibl_settings.h"
+#include "ibl_cpu_bake.h"
+#include "ibl_hdr.h"
+#include "ibl_octahedral.h"
+#include "ibl_rgb9e5.h"
+#include "ibl_sh.h"
+
+// converts a float cubemap to the half-float layout stored in the cache
+IblCacheImage toCacheImage(const CpuCubemap &cube)
+{
+    IblCacheImage image;
+    image.target = GL_TEXTURE_CUBE_MAP;
+    image.internalFormat = GL_RGB16F;
+    image.format = GL_RGB;
+    image.levels.resize(cube.levels.size());
+    for (unsigned int level = 0; level < cube.levels.size(); ++level)
+    {
+        IblCacheLevel &l = image.levels[level];
+        l.width = l.height = cube.levelSize(level);
+        l.pixels.resize(cube.levels[level].size());
+        for (size_t i = 0; i < l.pixels.size(); ++i)
+            l.pixels[i] = glm::packHalf1x16(cube.levels[level][i]);
+    }
+    return image;
+}
+
+IblCacheImage toCacheImage(const CpuOctahedralMap &map)
+{
+    IblCacheImage image;
+    image.target = GL_TEXTURE_2D;
+    image.internalFormat = GL_RGB16F;
+    image.format = GL_RGB;
+    image.levels.resize(map.levels.size());
+    for (unsigned int level = 0; level < map.levels.size(); ++level)
+    {
+        IblCacheLevel &l = image.levels[level];
+        l.width = l.height = map.levelSize(level);
+        l.pixels.resize(map.levels[level].size());
+        for (size_t i = 0; i < l.pixels.size(); ++i)
+            l.pixels[i] = glm::packHalf1x16(map.levels[level][i]);
+    }
+    return image;
+}
+
+IblCacheImage toCacheImage(const CpuImage &lut)
+{
+    IblCacheImage image;
+    image.target = GL_TEXTURE_2D;
+    image.internalFormat = GL_RG16F;
+    image.format = GL_RG;
+    image.levels.resize(1);
+    image.levels[0].width = lut.width;
+    image.levels[0].height = lut.height;
+    image.levels[0].pixels.resize(lut.pixels.size());
+    for (size_t i = 0; i < lut.pixels.size(); ++i)
+        image.levels[0].pixels[i] = glm::packHalf1x16(lut.pixels[i]);
+    return image;
+}
+
+// relative RMS difference between two cached images (in either storage) over the levels both contain
+double relativeRms(const IblCacheImage &a, const IblCacheImage &b, unsigned int levels)
+{
+    double diff = 0.0, ref = 0.0;
+    for (unsigned int level = 0; level < levels && level < a.levels.size() && level < b.levels.size(); ++level)
+    {
+        std::vector<float> pa = cacheLevelRGB(a, level), pb = cacheLevelRGB(b, level);
+        for (size_t i = 0; i < pa.size() && i < pb.size(); ++i)
+        {
+            double va = pa[i], vb = pb[i];
+            diff += (va - vb) * (va - vb);
+            ref += vb * vb;
+        }
+    }
+    return ref > 0.0 ? std::sqrt(diff / ref) : 0.0;
+}
+
+size_t imageBytes(const IblCacheImage &image)
+{
+    size_t bytes = 0;
+    for (unsigned int level = 0; level < image.levels.size(); ++level)
+        bytes += image.levels[level].pixels.size() * sizeof(unsigned short);
+    return bytes;
+}
+
+// error of the shared-exponent encoding against the float16 image it was made from: relative RMS over all
+// levels, and the largest error of a texel relative to its brightest channel (what the shared exponent costs)
+void reportStorageError(const std::string &name, const IblCacheImage &half, const IblCacheImage &encoded)
+{
+    double texelMax = 0.0;
+    for (unsigned int level = 0; level < half.levels.size(); ++level)
+    {
+        std::vector<float> reference = cacheLevelRGB(half, level), decoded = cacheLevelRGB(encoded, level);
+        for (size_t i = 0; i + 2 < reference.size(); i += 3)
+        {
+            float brightest = std::max(reference[i], std::max(reference[i + 1], reference[i + 2]));
+            if (brightest <= 1e-6f)
+                continue;
+            for (int c = 0; c < 3; ++c)
+                texelMax = std::max(texelMax, (double)std::fabs(decoded[i + c] - reference[i + c]) / brightest);
+        }
+    }
+    std::cout << "  " << name << " RGB9_E5 vs RGB16F: relative RMS " << relativeRms(encoded, half, (unsigned int)half.levels.size())
+              << ", max per texel " << texelMax << ", " << imageBytes(half) / 1024 << " KB -> " << imageBytes(encoded) / 1024 << " KB" << std::endl;
+}
+
+// resolution of the table written by --brdf-table; the LUT is smooth enough that bilinear filtering
+// of a small table stays close to the full-resolution bake
+const int BRDF_TABLE_SIZE = 64;
+
+// writes the LUT as half floats into a header that the demo compiles in (BRDF_LUT_EMBEDDED)
+bool writeBrdfTable(const std::string &path, const CpuImage &lut)
+{
+    FILE *file = fopen(path.c_str(), "w");
+    if (!file)
+        return false;
+    fprintf(file, "#ifndef _BRDF_LUT_TABLE_H_\n#define _BRDF_LUT_TABLE_H_\n\n#pragma once\n\n");
+    fprintf(file, "// generated by IBL_bake --brdf-table (%u samples per texel), do not edit.\n", BRDF_SAMPLE_COUNT);
+    fprintf(file, "// split-sum BRDF LUT as RG half floats, x = NdotV, y = roughness.\n");
+    fprintf(file, "const unsigned int BRDF_LUT_TABLE_SIZE = %d;\n", lut.width);
+    fprintf(file, "const unsigned short BRDF_LUT_TABLE[%d] = {", lut.width * lut.height * 2);
+    for (size_t i = 0; i < lut.pixels.size(); ++i)
+        fprintf(file, "%s0x%04x,", i % 16 == 0 ? "\n    " : " ", glm::packHalf1x16(lut.pixels[i]));
+    fprintf(file, "\n};\n\n#endif\n");
+    return fclose(file) == 0;
+}
+
+// RMS and max error of the small table (bilinearly filtered) and of the analytic fit against the reference LUT
+void reportBrdfError(const CpuImage &reference, const CpuImage &table)
+{
+    double tableSum = 0.0, fitSum = 0.0, tableMax = 0.0, fitMax = 0.0;
+    for (int y = 0; y < reference.height; ++y)
+    {
+        for (int x = 0; x < reference.width; ++x)
+        {
+            float u = (x + 0.5f) / reference.width, v = (y + 0.5f) / reference.height;
+            const float *ref = &reference.pixels[((size_t)y * reference.width + x) * 2];
+            float filtered[2];
+            sampleBilinear(table.pixels.data(), table.width, table.height, 2, u, v, filtered);
+            glm::vec2 fit = envBrdfApprox(u, v);
+            for (int c = 0; c < 2; ++c)
+            {
+                double tableError = std::fabs(filtered[c] - ref[c]), fitError = std::fabs(fit[c] - ref[c]);
+                tableSum += tableError * tableError;
+                fitSum += fitError * fitError;
+                tableMax = std::max(tableMax, tableError);
+                fitMax = std::max(fitMax, fitError);
+            }
+        }
+    }
+    double count = 2.0 * reference.width * reference.height;
+    std::cout << "  brdf table " << table.width << "x" << table.height << ": RMS " << std::sqrt(tableSum / count) << ", max " << tableMax << std::endl;
+    std::cout << "  brdf analytic fit:  RMS " << std::sqrt(fitSum / count) << ", max " << fitMax << std::endl;
+}
+
+double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// the environment, irradiance and pre-filter maps in one layout (CpuCubemap or CpuOctahedralMap), and how long
+// each step took
+template <typename Map>
+struct LayoutBake {
+    Map environment, irradiance, prefilter;
+    PrefilterBudget budget;
+    double envTime = 0.0, irradianceTime = 0.0, budgetTime = 0.0, prefilterTime = 0.0;
+};
+
+// side of a map of either layout, for the cubemap face size of the settings
+unsigned int layoutMapSize(const CpuCubemap &, unsigned int faceSize)
+{
+    return faceSize;
+}
+
+unsigned int layoutMapSize(const CpuOctahedralMap &, unsigned int faceSize)
+{
+    return octahedralMapSize(faceSize);
+}
+
+void bakeEnvironmentMap(const CpuImage &equirect, CpuCubemap &map)
+{
+    map = bakeEnvironmentCubemap(equirect, ENV_CUBEMAP_SIZE, mipLevelCount(ENV_CUBEMAP_SIZE));
+}
+
+void bakeEnvironmentMap(const CpuImage &equirect, CpuOctahedralMap &map)
+{
+    map = bakeEnvironmentOctahedral(equirect, octahedralMapSize(ENV_CUBEMAP_SIZE), mipLevelCount(octahedralMapSize(ENV_CUBEMAP_SIZE)));
+}
+
+void bakeIrradianceMap(const CpuCubemap &env, CpuCubemap &map)
+{
+    map = bakeIrradiance(env, IRRADIANCE_SIZE);
+}
+
+void bakeIrradianceMap(const CpuOctahedralMap &env, CpuOctahedralMap &map)
+{
+    map = bakeIrradianceOctahedral(env, octahedralMapSize(IRRADIANCE_SIZE));
+}
+
+void bakePrefilterMap(const CpuCubemap &env, const std::vector<unsigned int> &sampleCounts, CpuCubemap &map)
+{
+    map = bakePrefilter(env, PREFILTER_SIZE, PREFILTER_MIP_LEVELS, sampleCounts);
+}
+
+void bakePrefilterMap(const CpuOctahedralMap &env, const std::vector<unsigned int> &sampleCounts, CpuOctahedralMap &map)
+{
+    map = bakePrefilterOctahedral(env, octahedralMapSize(PREFILTER_SIZE), PREFILTER_MIP_LEVELS, sampleCounts);
+}
+
+template <typename Map>
+LayoutBake<Map> bakeLayout(const CpuImage &equirect, bool irradiance)
+{
+    LayoutBake<Map> bake;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    bakeEnvironmentMap(equirect, bake.environment);
+    bake.envTime = secondsSince(start);
+
+    if (irradiance)
+    {
+        start = std::chrono::steady_clock::now();
+        bakeIrradianceMap(bake.environment, bake.irradiance);
+        bake.irradianceTime = secondsSince(start);
+    }
+
+    start = std::chrono::steady_clock::now();
+    bake.budget = choosePrefilterBudget(bake.environment, layoutMapSize(bake.environment, PREFILTER_SIZE), PREFILTER_MIP_LEVELS,
+                                        PREFILTER_TARGET_ERROR, PREFILTER_MIN_SAMPLES, PREFILTER_SAMPLE_COUNT);
+    bake.budgetTime = secondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    bakePrefilterMap(bake.environment, bake.budget.sampleCounts, bake.prefilter);
+    bake.prefilterTime = secondsSince(start);
+    return bake;
+}
+
+// prefilter integrand evaluations of a bake
+template <typename Map>
+double prefilterWork(const LayoutBake<Map> &bake)
+{
+    double work = 0.0;
+    for (unsigned int mip = 0; mip < PREFILTER_MIP_LEVELS; ++mip)
+        work += (double)bake.prefilter.levelTexels(mip) * bake.budget.sampleCounts[mip];
+    return work;
+}
+
+template <typename Map>
+size_t mapTexels(const Map &map)
+{
+    size_t texels = 0;
+    for (unsigned int level = 0; level < map.levels.size(); ++level)
+        texels += map.levelTexels(level);
+    return texels;
+}
+
+template <typename Map>
+void reportLayout(const std::string &name, const LayoutBake<Map> &bake)
+{
+    std::cout << "  " << name << ":" << std::endl;
+    std::cout << "    environment " << bake.environment.size << "^2, " << mapTexels(bake.environment) / 1024 << "K texels: " << bake.envTime * 1000.0 << " ms" << std::endl;
+    std::cout << "    irradiance  " << bake.irradiance.size << "^2, " << mapTexels(bake.irradiance) / 1024 << "K texels: " << bake.irradianceTime * 1000.0 << " ms" << std::endl;
+    std::cout << "    prefilter   " << bake.prefilter.size << "^2, " << mapTexels(bake.prefilter) / 1024 << "K texels: " << bake.prefilterTime * 1000.0
+              << " ms (" << prefilterWork(bake) / 1e6 << " M samples, budget " << bake.budgetTime * 1000.0 << " ms)" << std::endl;
+}
+
+// nanoseconds per trilinear lookup of the map at the given directions and mips
+template <typename Map>
+double lookupCost(const Map &map, const std::vector<glm::vec3> &directions, const std::vector<float> &lods, glm::vec3 &sum)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < directions.size(); ++i)
+        sum += sampleEnvironment(map, directions[i], lods[i]);
+    return secondsSince(start) * 1e9 / directions.size();
+}
+
+// --layout-benchmark: bakes the environment in both layouts on the CPU and compares bake time, size and lookup
+// cost, and how far the octahedral pre-filter map is from the cubemap one. On the GPU the demo prints the time of
+// every bake, for the IBL_LAYOUT it was built with.
+int benchmarkLayouts(const CpuImage &equirect)
+{
+    std::cout << "Layout benchmark" << std::endl;
+    LayoutBake<CpuCubemap> cube = bakeLayout<CpuCubemap>(equirect, true);
+    reportLayout("cubemap", cube);
+    LayoutBake<CpuOctahedralMap> octahedral = bakeLayout<CpuOctahedralMap>(equirect, true);
+    reportLayout("octahedral", octahedral);
+
+    // the same random directions for both, at random pre-filter roughness mips
+    const unsigned int lookups = 1 << 20;
+    std::mt19937 random(1);
+    std::normal_distribution<float> normal;
+    std::uniform_real_distribution<float> roughness(0.0f, (float)(PREFILTER_MIP_LEVELS - 1));
+    std::vector<glm::vec3> directions(lookups);
+    std::vector<float> lods(lookups), environmentLods(lookups, 0.0f);
+    for (unsigned int i = 0; i < lookups; ++i)
+    {
+        directions[i] = glm::normalize(glm::vec3(normal(random), normal(random), normal(random)));
+        lods[i] = roughness(random);
+    }
+    glm::vec3 sum(0.0f);
+    std::cout << "  lookup cost (ns): environment cubemap " << lookupCost(cube.environment, directions, environmentLods, sum)
+              << ", octahedral " << lookupCost(octahedral.environment, directions, environmentLods, sum) << std::endl;
+    std::cout << "  lookup cost (ns): prefilter cubemap " << lookupCost(cube.prefilter, directions, lods, sum)
+              << ", octahedral " << lookupCost(octahedral.prefilter, directions, lods, sum) << " (checksum " << sum.x + sum.y + sum.z << ")" << std::endl;
+
+    for (unsigned int mip = 0; mip < PREFILTER_MIP_LEVELS; ++mip)
+    {
+        double diff = 0.0, ref = 0.0;
+        for (unsigned int i = 0; i < lookups; i += 16)
+        {
+            glm::vec3 a = sampleEnvironment(octahedral.prefilter, directions[i], (float)mip);
+            glm::vec3 b = sampleEnvironment(cube.prefilter, directions[i], (float)mip);
+            diff += glm::dot(a - b, a - b);
+            ref += glm::dot(b, b);
+        }
+        std::cout << "  prefilter mip " << mip << " octahedral vs cubemap: relative RMS " << std::sqrt(diff / ref) << std::endl;
+    }
+    return 0;
+}
+
+// --hdr-benchmark: decodes the HDR image with stbi_loadf and with loadHdrImage in every pixel format, and
+// checks that the packed pixels are what converting stb_image's floats would give
+int benchmarkHdrDecode(const std::string &hdrPath)
+{
+    std::cout << "HDR decode benchmark, " << hdrPath << " on " << workerCount() << " threads (best of 5)" << std::endl;
+    double stbSeconds = 1e9;
+    int width = 0, height = 0, nrComponents;
+    float *reference = nullptr;
+    for (int run = 0; run < 5; ++run)
+    {
+        stbi_image_free(reference);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        reference = stbi_loadf(hdrPath.c_str(), &width, &height, &nrComponents, 3);
+        stbSeconds = std::min(stbSeconds, secondsSince(start));
+    }
+    if (!reference)
+    {
+        std::cout << "Failed to load HDR image." << std::endl;
+        return -1;
+    }
+    size_t texels = (size_t)width * height;
+    std::cout << "  stbi_loadf: " << stbSeconds * 1e3 << " ms, " << texels * 12 / 1024 << " KB of floats" << std::endl;
+
+    const char * const names[] = { "float", "half", "RGB9E5" };
+    for (int format = HDR_PIXELS_FLOAT; format <= HDR_PIXELS_RGB9E5; ++format)
+    {
+        double seconds = 1e9;
+        HdrImage image;
+        for (int run = 0; run < 5; ++run)
+        {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            image = loadHdrImage(hdrPath, (HdrPixelFormat)format, true);
+            seconds = std::min(seconds, secondsSince(start));
+        }
+        if (!image.valid() || image.width != width || image.height != height)
+            return -1;
+        size_t mismatches = 0;
+        for (size_t i = 0; i < texels; ++i)
+        {
+            const float *rgb = reference + i * 3;
+            if (format == HDR_PIXELS_FLOAT)
+                mismatches += std::memcmp(rgb, image.pixels.data() + i * 12, 12) != 0;
+            else if (format == HDR_PIXELS_HALF)
+            {
+                const uint16_t *half = (const uint16_t *)image.pixels.data() + i * 3;
+                mismatches += half[0] != floatToHalfClamped(rgb[0]) || half[1] != floatToHalfClamped(rgb[1]) || half[2] != floatToHalfClamped(rgb[2]);
+            }
+            else // compared by value, an RGBE texel that isn't normalized has a second exact encoding
+                mismatches += decodeRGB9E5(((const uint32_t *)image.pixels.data())[i]) != decodeRGB9E5(encodeRGB9E5(rgb[0], rgb[1], rgb[2]));
+        }
+        std::cout << "  loadHdrImage " << names[format] << ": " << seconds * 1e3 << " ms (" << stbSeconds / seconds << "x), "
+                  << image.pixels.size() / 1024 << " KB, " << mismatches << " texels differ from stb_image" << std::endl;
+    }
+    stbi_image_free(reference);
+    return 0;
+}
+
+// bakes the maps in the layout of the settings and writes the caches
+template <typename Map>
+int bakeAndWrite(const CpuImage &equirect, const std::string &hdrPath, const std::string &outPath, const std::string &comparePath,
+                 const std::string &brdfTablePath)
+{
+    LayoutBake<Map> bake = bakeLayout<Map>(equirect, !USE_SH_IRRADIANCE);
+
+    ShCoefficients shIrradiance;
+    double shTime = 0.0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    if (USE_SH_IRRADIANCE)
+    {
+        shIrradiance = shRadianceToIrradiance(projectEquirectToSH(equirect.pixels.data(), equirect.width, equirect.height));
+        shTime = secondsSince(start);
+    }
+    double irradianceTime = USE_SH_IRRADIANCE ? shTime : bake.irradianceTime;
+
+    // the LUT only gets its own cache in BRDF_LUT_RUNTIME mode, the other modes compile it in
+    bool bakeBrdf = BRDF_LUT_MODE == BRDF_LUT_RUNTIME || !brdfTablePath.empty();
+    start = std::chrono::steady_clock::now();
+    CpuImage brdfLUT;
+    if (bakeBrdf)
+        brdfLUT = bakeBrdfLut(BRDF_LUT_SIZE, BRDF_SAMPLE_COUNT);
+    double brdfTime = secondsSince(start);
+
+    // throughput in integrand evaluations (texture fetches / BRDF samples) per second
+    double irradianceWork = USE_SH_IRRADIANCE ? (double)equirect.width * equirect.height : (double)bake.irradiance.levelTexels(0) * irradianceSamples(0.025f, 0.0f).size();
+    double brdfWork = (double)BRDF_LUT_SIZE * BRDF_LUT_SIZE * BRDF_SAMPLE_COUNT;
+    std::cout << (IBL_LAYOUT == IBL_LAYOUT_OCTAHEDRAL ? "  equirect -> octahedral: " : "  equirect -> cubemap: ") << bake.envTime * 1000.0 << " ms" << std::endl;
+    std::cout << (USE_SH_IRRADIANCE ? "  irradiance (SH):     " : "  irradiance:          ") << irradianceTime * 1000.0 << " ms (" << irradianceWork / irradianceTime / 1e6 << " M samples/s)" << std::endl;
+    std::cout << "  prefilter budget:    " << bake.budgetTime * 1000.0 << " ms" << std::endl;
+    for (unsigned int mip = 0; mip < PREFILTER_MIP_LEVELS; ++mip)
+    {
+        if (bake.budget.sampleCounts[mip] == 0)
+            std::cout << "    mip " << mip << ": copied from the environment" << std::endl;
+        else
+            std::cout << "    mip " << mip << ": " << bake.budget.sampleCounts[mip] << " samples, relative RMS " << bake.budget.errors[mip] << std::endl;
+    }
+    std::cout << "  prefilter:           " << bake.prefilterTime * 1000.0 << " ms (" << prefilterWork(bake) / bake.prefilterTime / 1e6 << " M samples/s)" << std::endl;
+    if (bakeBrdf)
+        std::cout << "  brdf lut:            " << brdfTime * 1000.0 << " ms (" << brdfWork / brdfTime / 1e6 << " M samples/s)" << std::endl;
+
+    if (!brdfTablePath.empty())
+    {
+        CpuImage brdfTable = bakeBrdfLut(BRDF_TABLE_SIZE, BRDF_SAMPLE_COUNT);
+        reportBrdfError(brdfLUT, brdfTable);
+        if (!writeBrdfTable(brdfTablePath, brdfTable))
+            return -1;
+        std::cout << "Wrote " << brdfTablePath << std::endl;
+    }
+
+    // same order as IblEnvironment::cacheTextures
+    std::vector<IblCacheImage> images;
+    std::vector<std::string> names;
+    std::vector<unsigned int> levels;
+    images.push_back(toCacheImage(bake.environment));
+    names.push_back("environment");
+    levels.push_back(1);
+    if (!USE_SH_IRRADIANCE)
+    {
+        images.push_back(toCacheImage(bake.irradiance));
+        names.push_back("irradiance");
+        levels.push_back(1);
+    }
+    images.push_back(toCacheImage(bake.prefilter));
+    names.push_back("prefilter");
+    levels.push_back(PREFILTER_MIP_LEVELS);
+    if (IBL_STORAGE == IBL_STORAGE_RGB9E5)
+    {
+        start = std::chrono::steady_clock::now();
+        std::vector<IblCacheImage> encoded;
+        for (unsigned int i = 0; i < images.size(); ++i)
+            encoded.push_back(encodeRGB9E5Image(images[i]));
+        std::cout << "  RGB9_E5 encode:      " << secondsSince(start) * 1000.0 << " ms" << std::endl;
+        for (unsigned int i = 0; i < images.size(); ++i)
+            reportStorageError(names[i], images[i], encoded[i]);
+        images = encoded;
+    }
+
+    uint64_t key = iblBakeKey(hdrPath);
+    if (!comparePath.empty())
+    {
+        // e.g. the cache the demo wrote after a GPU bake of the same environment
+        std::vector<IblCacheImage> reference;
+        if (readIblCache(comparePath, key, reference) && reference.size() == images.size())
+        {
+            for (unsigned int i = 0; i < images.size(); ++i)
+                std::cout << "  " << names[i] << " relative RMS vs " << comparePath << ": " << relativeRms(images[i], reference[i], levels[i]) << std::endl;
+        }
+        else
+            std::cout << "Couldn't read a matching cache from " << comparePath << std::endl;
+    }
+
+    if (!writeIblCache(outPath, key, images))
+        return -1;
+    std::cout << "Wrote " << outPath << std::endl;
+    if (USE_SH_IRRADIANCE)
+    {
+        if (!saveShCache(shCachePath(outPath), key, shIrradiance))
+            return -1;
+        std::cout << "Wrote " << shCachePath(outPath) << std::endl;
+    }
+    if (BRDF_LUT_MODE == BRDF_LUT_RUNTIME)
+    {
+        if (!writeIblCache(BRDF_LUT_CACHE_PATH, brdfLutKey(), { toCacheImage(brdfLUT) }))
+            return -1;
+        std::cout << "Wrote " << BRDF_LUT_CACHE_PATH << std::endl;
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    std::string hdrPath = HDR_PATH;
+    std::string outPath;
+    std::string comparePath;
+    std::string brdfTablePath;
+    bool layoutBenchmark = false, hdrBenchmark = false;
+    int positional = 0;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--compare") == 0 && i + 1 < argc)
+            comparePath = argv[++i];
+        else if (strcmp(argv[i], "--brdf-table") == 0 && i + 1 < argc)
+            brdfTablePath = argv[++i];
+        else if (strcmp(argv[i], "--layout-benchmark") == 0)
+            layoutBenchmark = true;
+        else if (strcmp(argv[i], "--hdr-benchmark") == 0)
+            hdrBenchmark = true;
+        else if (positional++ == 0)
+            hdrPath = argv[i];
+        else
+            outPath = argv[i];
+    }
+    if (outPath.empty())
+        outPath = iblCachePath(hdrPath);
+    std::cout << "Baking " << hdrPath << " on " << workerCount() << " threads" << std::endl;
+
+    // same orientation as the demo, which flips every image on load
+    stbi_set_flip_vertically_on_load(true);
+    if (hdrBenchmark)
+        return benchmarkHdrDecode(hdrPath);
+    HdrImage hdr = loadHdrImage(hdrPath, HDR_PIXELS_FLOAT, true);
+    if (!hdr.valid())
+    {
+        std::cout << "Failed to load HDR image." << std::endl;
+        return -1;
+    }
+    CpuImage equirect;
+    equirect.width = hdr.width;
+    equirect.height = hdr.height;
+    equirect.channels = 3;
+    equirect.pixels.resize((size_t)hdr.width * hdr.height * 3);
+    std::memcpy(equirect.pixels.data(), hdr.pixels.data(), hdr.pixels.size());
+
+    if (layoutBenchmark)
+        return benchmarkLayouts(equirect);
+    if (IBL_LAYOUT == IBL_LAYOUT_OCTAHEDRAL)
+        return bakeAndWrite<CpuOctahedralMap>(equirect, hdrPath, outPath, comparePath, brdfTablePath);
+    return bakeAndWrite<CpuCubemap>(equirect, hdrPath, outPath, comparePath, brdfTablePath);
+}
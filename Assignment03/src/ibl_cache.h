@@ -0,0 +1,340 @@
+#ifndef _IBL_CACHE_H_
+#define _IBL_CACHE_H_
+
+#pragma once
+
+#include <GL/glew.h>
+#include <learnopengl/binary_cache.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include <iostream>
+
+// bump whenever the layout of the cache file or the meaning of its contents changes.
+const uint32_t IBL_CACHE_VERSION = 1;
+const char IBL_CACHE_MAGIC[4] = { 'I', 'B', 'L', 'C' };
+
+// one texture of the baked IBL set (envCubemap, irradianceMap, prefilterMap, brdfLUT).
+// the texture must already be created; the cache reads back or re-specifies every mip level.
+struct IblCacheTexture {
+    unsigned int id;
+    GLenum target;      // GL_TEXTURE_CUBE_MAP or GL_TEXTURE_2D
+    GLenum internalFormat;
+    GLenum format;      // GL_RGB or GL_RG, stored as half floats (GL_RGB9_E5 as packed 32-bit texels)
+    int levels;
+};
+
+// CPU-side copy of one cached texture; pixels hold all faces of a level back to back, a GL_RGB9_E5 texel in
+// two of them.
+struct IblCacheLevel {
+    uint32_t width, height;
+    std::vector<unsigned short> pixels;
+};
+struct IblCacheImage {
+    GLenum target;
+    GLenum internalFormat;
+    GLenum format;
+    std::vector<IblCacheLevel> levels;
+};
+
+// builds the cache key from everything that influences the baked result.
+inline uint64_t iblCacheKey(const std::string &hdrPath, const std::vector<std::string> &shaderPaths, const std::vector<unsigned int> &resolutions)
+{
+    Fnv1a64 hash;
+    hash.updateValue(IBL_CACHE_VERSION);
+    hash.updateString(hdrPath);
+    if (!hash.updateFile(hdrPath))
+        std::cout << "IBL cache: couldn't hash " << hdrPath << std::endl;
+    for (unsigned int i = 0; i < shaderPaths.size(); ++i)
+    {
+        hash.updateString(shaderPaths[i]);
+        hash.updateFile(shaderPaths[i]);
+    }
+    for (unsigned int i = 0; i < resolutions.size(); ++i)
+        hash.updateValue(resolutions[i]);
+    return hash.value;
+}
+
+inline int iblCacheComponents(GLenum format)
+{
+    return format == GL_RG ? 2 : (format == GL_RED ? 1 : 3);
+}
+
+// 16-bit values per texel
+inline int iblCacheTexelSize(GLenum internalFormat, GLenum format)
+{
+    return internalFormat == GL_RGB9_E5 ? 2 : iblCacheComponents(format);
+}
+
+inline GLenum iblCacheType(GLenum internalFormat)
+{
+    return internalFormat == GL_RGB9_E5 ? GL_UNSIGNED_INT_5_9_9_9_REV : GL_HALF_FLOAT;
+}
+
+inline int iblCacheFaces(GLenum target)
+{
+    return target == GL_TEXTURE_CUBE_MAP ? 6 : 1;
+}
+
+inline GLenum iblCacheFaceTarget(GLenum target, int face)
+{
+    return target == GL_TEXTURE_CUBE_MAP ? GL_TEXTURE_CUBE_MAP_POSITIVE_X + face : target;
+}
+
+// writes a set of images to disk. Used by the runtime after a GPU bake and by the offline CPU baker.
+inline bool writeIblCache(const std::string &path, uint64_t key, const std::vector<IblCacheImage> &images)
+{
+    BinaryWriter writer(path);
+    if (!writer.good())
+    {
+        std::cout << "IBL cache: couldn't open " << path << " for writing" << std::endl;
+        return false;
+    }
+    writeCacheHeader(writer, IBL_CACHE_MAGIC, IBL_CACHE_VERSION, key);
+    writer.writeValue((uint32_t)images.size());
+    for (unsigned int t = 0; t < images.size(); ++t)
+    {
+        const IblCacheImage &image = images[t];
+        writer.writeValue((uint32_t)image.target);
+        writer.writeValue((uint32_t)image.internalFormat);
+        writer.writeValue((uint32_t)image.format);
+        writer.writeValue((uint32_t)image.levels.size());
+        for (unsigned int level = 0; level < image.levels.size(); ++level)
+        {
+            const IblCacheLevel &l = image.levels[level];
+            writer.writeValue(l.width);
+            writer.writeValue(l.height);
+            writer.write(l.pixels.data(), l.pixels.size() * sizeof(unsigned short));
+        }
+    }
+    return writer.good();
+}
+
+// parses a whole cache file. Returns false for a missing, stale or truncated file.
+inline bool readIblCache(const std::string &path, uint64_t key, std::vector<IblCacheImage> &images)
+{
+    BinaryReader reader(path);
+    if (!reader.good() || !readCacheHeader(reader, IBL_CACHE_MAGIC, IBL_CACHE_VERSION, key))
+        return false;
+    uint32_t count = 0;
+    if (!reader.readValue(count) || count > 64)
+        return false;
+
+    images.resize(count);
+    for (unsigned int t = 0; t < count; ++t)
+    {
+        IblCacheImage &image = images[t];
+        uint32_t target, internalFormat, format, levelCount;
+        reader.readValue(target);
+        reader.readValue(internalFormat);
+        reader.readValue(format);
+        reader.readValue(levelCount);
+        if (!reader.good() || levelCount > 16)
+            return false;
+        image.target = target;
+        image.internalFormat = internalFormat;
+        image.format = format;
+
+        image.levels.resize(levelCount);
+        for (uint32_t level = 0; level < levelCount; ++level)
+        {
+            IblCacheLevel &l = image.levels[level];
+            reader.readValue(l.width);
+            reader.readValue(l.height);
+            if (!reader.good() || l.width > 16384 || l.height > 16384)
+                return false;
+            l.pixels.resize((size_t)l.width * l.height * iblCacheTexelSize(internalFormat, format) * iblCacheFaces(target));
+            if (!reader.read(l.pixels.data(), l.pixels.size() * sizeof(unsigned short)))
+                return false;
+        }
+    }
+    return true;
+}
+
+// reads back every level of a texture in its cache storage.
+inline IblCacheImage readbackIblTexture(const IblCacheTexture &tex)
+{
+    IblCacheImage image;
+    image.target = tex.target;
+    image.internalFormat = tex.internalFormat;
+    image.format = tex.format;
+    image.levels.resize(tex.levels);
+
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glBindTexture(tex.target, tex.id);
+    for (int level = 0; level < tex.levels; ++level)
+    {
+        IblCacheLevel &l = image.levels[level];
+        GLint width = 0, height = 0;
+        glGetTexLevelParameteriv(iblCacheFaceTarget(tex.target, 0), level, GL_TEXTURE_WIDTH, &width);
+        glGetTexLevelParameteriv(iblCacheFaceTarget(tex.target, 0), level, GL_TEXTURE_HEIGHT, &height);
+        l.width = width;
+        l.height = height;
+
+        size_t faceSize = (size_t)width * height * iblCacheTexelSize(tex.internalFormat, tex.format);
+        l.pixels.resize(faceSize * iblCacheFaces(tex.target));
+        for (int face = 0; face < iblCacheFaces(tex.target); ++face)
+            glGetTexImage(iblCacheFaceTarget(tex.target, face), level, tex.format, iblCacheType(tex.internalFormat), &l.pixels[face * faceSize]);
+    }
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    return image;
+}
+
+// readbackIblTexture() without the stall: start() has the GPU copy every level into a pixel pack buffer
+// behind a fence, ready() polls that fence, and take() maps the buffer once it has signaled.
+class IblTextureReadback {
+public:
+    IblTextureReadback() {}
+    IblTextureReadback(const IblTextureReadback &) = delete;
+    IblTextureReadback &operator=(const IblTextureReadback &) = delete;
+
+    ~IblTextureReadback()
+    {
+        release();
+    }
+
+    void start(const IblCacheTexture &tex)
+    {
+        release();
+        image.target = tex.target;
+        image.internalFormat = tex.internalFormat;
+        image.format = tex.format;
+        image.levels.resize(tex.levels);
+        offsets.clear();
+
+        size_t total = 0;
+        glBindTexture(tex.target, tex.id);
+        for (int level = 0; level < tex.levels; ++level)
+        {
+            IblCacheLevel &l = image.levels[level];
+            GLint width = 0, height = 0;
+            glGetTexLevelParameteriv(iblCacheFaceTarget(tex.target, 0), level, GL_TEXTURE_WIDTH, &width);
+            glGetTexLevelParameteriv(iblCacheFaceTarget(tex.target, 0), level, GL_TEXTURE_HEIGHT, &height);
+            l.width = width;
+            l.height = height;
+            offsets.push_back(total);
+            total += levelBytes(level);
+        }
+
+        glGenBuffers(1, &buffer);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer);
+        glBufferData(GL_PIXEL_PACK_BUFFER, total, nullptr, GL_STREAM_READ);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        for (int level = 0; level < tex.levels; ++level)
+        {
+            size_t faceBytes = levelBytes(level) / iblCacheFaces(tex.target);
+            for (int face = 0; face < iblCacheFaces(tex.target); ++face)
+                glGetTexImage(iblCacheFaceTarget(tex.target, face), level, tex.format, iblCacheType(tex.internalFormat),
+                              (void *)(offsets[level] + face * faceBytes));
+        }
+        glPixelStorei(GL_PACK_ALIGNMENT, 4);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glFlush();
+    }
+
+    bool ready() const
+    {
+        GLenum state = glClientWaitSync(fence, 0, 0);
+        return state == GL_ALREADY_SIGNALED || state == GL_CONDITION_SATISFIED;
+    }
+
+    // the levels read back; only once ready()
+    IblCacheImage take()
+    {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer);
+        const unsigned char *mapped = (const unsigned char *)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0,
+            offsets.empty() ? 0 : (GLsizeiptr)(offsets.back() + levelBytes(image.levels.size() - 1)), GL_MAP_READ_BIT);
+        for (unsigned int level = 0; level < image.levels.size(); ++level)
+        {
+            IblCacheLevel &l = image.levels[level];
+            l.pixels.resize(levelBytes(level) / sizeof(unsigned short));
+            if (mapped)
+                memcpy(l.pixels.data(), mapped + offsets[level], levelBytes(level));
+        }
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        release();
+        IblCacheImage result;
+        std::swap(result, image);
+        return result;
+    }
+
+private:
+    IblCacheImage image;            // everything but the pixels until take()
+    std::vector<size_t> offsets;    // of each level in the buffer
+    unsigned int buffer = 0;
+    GLsync fence = 0;
+
+    size_t levelBytes(size_t level) const
+    {
+        const IblCacheLevel &l = image.levels[level];
+        return (size_t)l.width * l.height * iblCacheTexelSize(image.internalFormat, image.format) * iblCacheFaces(image.target) * sizeof(unsigned short);
+    }
+
+    void release()
+    {
+        if (fence)
+            glDeleteSync(fence);
+        if (buffer)
+            glDeleteBuffers(1, &buffer);
+        fence = 0;
+        buffer = 0;
+    }
+};
+
+// re-specifies every level of a texture from a cached image.
+inline void uploadIblTexture(const IblCacheTexture &tex, const IblCacheImage &image)
+{
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glBindTexture(tex.target, tex.id);
+    for (unsigned int level = 0; level < image.levels.size(); ++level)
+    {
+        const IblCacheLevel &l = image.levels[level];
+        size_t faceSize = (size_t)l.width * l.height * iblCacheTexelSize(tex.internalFormat, tex.format);
+        for (int face = 0; face < iblCacheFaces(tex.target); ++face)
+            glTexImage2D(iblCacheFaceTarget(tex.target, face), level, tex.internalFormat, l.width, l.height, 0, tex.format, iblCacheType(tex.internalFormat), &l.pixels[face * faceSize]);
+    }
+    glTexParameteri(tex.target, GL_TEXTURE_MAX_LEVEL, (GLint)image.levels.size() - 1);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+}
+
+// reads back all levels of the given textures and writes them to disk.
+inline bool saveIblCache(const std::string &path, uint64_t key, const std::vector<IblCacheTexture> &textures)
+{
+    std::vector<IblCacheImage> images;
+    for (unsigned int t = 0; t < textures.size(); ++t)
+        images.push_back(readbackIblTexture(textures[t]));
+    return writeIblCache(path, key, images);
+}
+
+// whether parsed images have the layout of the textures they're meant for
+inline bool iblCacheMatches(const std::vector<IblCacheImage> &images, const std::vector<IblCacheTexture> &textures)
+{
+    if (images.size() != textures.size())
+        return false;
+    for (unsigned int t = 0; t < textures.size(); ++t)
+    {
+        const IblCacheTexture &tex = textures[t];
+        const IblCacheImage &image = images[t];
+        if (image.target != tex.target || image.internalFormat != tex.internalFormat || image.format != tex.format || image.levels.size() != (size_t)tex.levels)
+            return false;
+    }
+    return true;
+}
+
+// loads a cache written by saveIblCache (or the offline baker). The whole file is parsed and validated
+// against the expected key and texture layout before anything is uploaded, so a stale or truncated
+// cache leaves the textures untouched and simply returns false.
+inline bool loadIblCache(const std::string &path, uint64_t key, const std::vector<IblCacheTexture> &textures)
+{
+    std::vector<IblCacheImage> images;
+    if (!readIblCache(path, key, images) || !iblCacheMatches(images, textures))
+        return false;
+    for (unsigned int t = 0; t < textures.size(); ++t)
+        uploadIblTexture(textures[t], images[t]);
+    return true;
+}
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef _IBL_COMPUTE_BAKE_H_
+#define _IBL_COMPUTE_BAKE_H_
+
+#pragma once
+
+// the compute path of the IBL bake (IBL_BAKE_COMPUTE, GL 4.3): the 2.2.2.*.cs shaders write the map levels and
+// the BRDF LUT through image stores, one invocation per texel in 8x8 workgroups, so the bake needs no
+// framebuffer, renderbuffer or capture geometry. Every dispatch covers a band of rows of all faces of one
+// level, like the raster captures, so it fits the same bake slices.
+
+#include <GL/glew.h>
+#include <learnopengl/shader.h>
+
+#include "ibl_settings.h"
+
+const unsigned int IBL_COMPUTE_GROUP_SIZE = 8; // local_size_x/y of the 2.2.2.*.cs shaders
+
+inline bool iblComputeSupported()
+{
+    return GLEW_VERSION_4_3 != 0;
+}
+
+inline unsigned int computeGroups(unsigned int texels)
+{
+    return (texels + IBL_COMPUTE_GROUP_SIZE - 1) / IBL_COMPUTE_GROUP_SIZE;
+}
+
+// builds a map bake shader; the target layout is fixed by IBL_LAYOUT like in captureShader
+inline Shader computeMapShader(const char *computePath)
+{
+    Shader shader(computePath);
+    shader.use();
+    shader.setBool("octahedralTarget", IBL_LAYOUT == IBL_LAYOUT_OCTAHEDRAL);
+    return shader;
+}
+
+// runs a map bake shader over rows [rowBegin, rowEnd) of every face of one size x size level. The level is
+// bound as image 0 (all six faces of a cubemap, as an imageCube) or image 1 (an octahedral map); the maps are
+// RGBA16F while they're baked since image stores can't write RGB16F.
+inline void dispatchMapRows(Shader &shader, unsigned int map, unsigned int mip, unsigned int size, unsigned int rowBegin, unsigned int rowEnd)
+{
+    bool cubemap = iblMapTarget() == GL_TEXTURE_CUBE_MAP;
+    shader.use();
+    shader.setInt("size", size);
+    shader.setInt("rowBegin", rowBegin);
+    shader.setInt("rowEnd", rowEnd);
+    glBindImageTexture(cubemap ? 0 : 1, map, mip, cubemap ? GL_TRUE : GL_FALSE, 0, GL_WRITE_ONLY, GL_RGBA16F);
+    glDispatchCompute(computeGroups(size), computeGroups(rowEnd - rowBegin), iblCacheFaces(iblMapTarget()));
+    // the level is read next by texture fetches (the following passes), mipmap generation or a readback
+    glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT | GL_TEXTURE_UPDATE_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+}
+
+// rows [rowBegin, rowEnd) of the RG16F BRDF LUT through 2.2.2.brdf.cs
+inline void dispatchBrdfRows(Shader &shader, unsigned int lut, unsigned int size, unsigned int rowBegin, unsigned int rowEnd)
+{
+    shader.use();
+    shader.setInt("size", size);
+    shader.setInt("rowBegin", rowBegin);
+    shader.setInt("rowEnd", rowEnd);
+    glBindImageTexture(1, lut, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_RG16F);
+    glDispatchCompute(computeGroups(size), computeGroups(rowEnd - rowBegin), 1);
+    glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT | GL_TEXTURE_UPDATE_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+}
+
+#endif
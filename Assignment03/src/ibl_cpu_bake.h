@@ -0,0 +1,612 @@
+#ifndef _IBL_CPU_BAKE_H_
+#define _IBL_CPU_BAKE_H_
+
+#pragma once
+
+// CPU implementation of the IBL bake. Every function here mirrors one of the 2.2.2.* bake shaders
+// (same sample sequences, same mip selection) so the results can be used as a numeric reference for
+// the GPU path, or written to the IBL cache on machines without a GPU.
+
+#include <glm/glm.hpp>
+#include <learnopengl/parallel.h>
+#include <learnopengl/simd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+const float IBL_PI = 3.14159265359f;
+// texels per side of the square tiles the bake work is split into
+const int IBL_CPU_TILE = 16;
+
+// a float image with 2 (BRDF LUT) or 3 (HDR) channels; row 0 is the first row uploaded to GL.
+struct CpuImage {
+    int width, height, channels;
+    std::vector<float> pixels;
+};
+
+// an RGB float cubemap with a mip chain. levels[l] stores the 6 faces of that level back to back
+// in GL face order (+X, -X, +Y, -Y, +Z, -Z), each face row-major with row 0 at t = 0.
+struct CpuCubemap {
+    int size;
+    std::vector<std::vector<float> > levels;
+
+    int levelSize(int level) const { return std::max(size >> level, 1); }
+    size_t levelTexels(int level) const { return (size_t)6 * levelSize(level) * levelSize(level); }
+    float *texel(int level, int face, int x, int y)
+    {
+        int s = levelSize(level);
+        return &levels[level][((size_t)(face * s + y) * s + x) * 3];
+    }
+    const float *texel(int level, int face, int x, int y) const
+    {
+        int s = levelSize(level);
+        return &levels[level][((size_t)(face * s + y) * s + x) * 3];
+    }
+};
+
+// a sample of a hemisphere integral, expressed in the tangent space of the normal (N = +Z).
+struct IblSample {
+    glm::vec3 L;    // direction to fetch
+    float weight;   // weight of the fetch in the sum
+    float lod;      // environment mip level to fetch from
+};
+
+// direction through the centre of a cubemap texel, matching the captureViews used by the GPU bake.
+inline glm::vec3 cubeTexelDirection(int face, int x, int y, int size)
+{
+    float sc = 2.0f * (x + 0.5f) / size - 1.0f;
+    float tc = 2.0f * (y + 0.5f) / size - 1.0f;
+    glm::vec3 dir;
+    switch (face)
+    {
+    case 0:  dir = glm::vec3( 1.0f,  -tc,  -sc); break;
+    case 1:  dir = glm::vec3(-1.0f,  -tc,   sc); break;
+    case 2:  dir = glm::vec3(   sc, 1.0f,   tc); break;
+    case 3:  dir = glm::vec3(   sc,-1.0f,  -tc); break;
+    case 4:  dir = glm::vec3(   sc,  -tc, 1.0f); break;
+    default: dir = glm::vec3(  -sc,  -tc,-1.0f); break;
+    }
+    return glm::normalize(dir);
+}
+
+// GL cubemap face selection; returns the face and the [0, 1] coordinates within it.
+inline int cubeFaceCoords(const glm::vec3 &dir, float &s, float &t)
+{
+    float ax = std::fabs(dir.x), ay = std::fabs(dir.y), az = std::fabs(dir.z);
+    int face;
+    float sc, tc, ma;
+    if (ax >= ay && ax >= az)
+    {
+        face = dir.x >= 0.0f ? 0 : 1;
+        sc = dir.x >= 0.0f ? -dir.z : dir.z;
+        tc = -dir.y;
+        ma = ax;
+    }
+    else if (ay >= az)
+    {
+        face = dir.y >= 0.0f ? 2 : 3;
+        sc = dir.x;
+        tc = dir.y >= 0.0f ? dir.z : -dir.z;
+        ma = ay;
+    }
+    else
+    {
+        face = dir.z >= 0.0f ? 4 : 5;
+        sc = dir.z >= 0.0f ? dir.x : -dir.x;
+        tc = -dir.y;
+        ma = az;
+    }
+    s = 0.5f * (sc / ma + 1.0f);
+    t = 0.5f * (tc / ma + 1.0f);
+    return face;
+}
+
+// bilinear fetch with GL_CLAMP_TO_EDGE addressing from an interleaved float image.
+inline void sampleBilinear(const float *pixels, int width, int height, int channels, float u, float v, float *out)
+{
+    float x = u * width - 0.5f;
+    float y = v * height - 0.5f;
+    int x0 = (int)std::floor(x), y0 = (int)std::floor(y);
+    float fx = x - x0, fy = y - y0;
+    int x1 = std::min(std::max(x0 + 1, 0), width - 1);
+    int y1 = std::min(std::max(y0 + 1, 0), height - 1);
+    x0 = std::min(std::max(x0, 0), width - 1);
+    y0 = std::min(std::max(y0, 0), height - 1);
+    const float *p00 = pixels + ((size_t)y0 * width + x0) * channels;
+    const float *p10 = pixels + ((size_t)y0 * width + x1) * channels;
+    const float *p01 = pixels + ((size_t)y1 * width + x0) * channels;
+    const float *p11 = pixels + ((size_t)y1 * width + x1) * channels;
+    for (int c = 0; c < channels; ++c)
+    {
+        float top = p00[c] + (p10[c] - p00[c]) * fx;
+        float bottom = p01[c] + (p11[c] - p01[c]) * fx;
+        out[c] = top + (bottom - top) * fy;
+    }
+}
+
+// trilinear cubemap lookup, the CPU equivalent of textureLod(samplerCube, dir, lod).
+inline glm::vec3 sampleCubemap(const CpuCubemap &cube, const glm::vec3 &dir, float lod)
+{
+    float s, t;
+    int face = cubeFaceCoords(dir, s, t);
+    lod = std::min(std::max(lod, 0.0f), (float)(cube.levels.size() - 1));
+    int l0 = (int)lod;
+    int l1 = std::min(l0 + 1, (int)cube.levels.size() - 1);
+    float f = lod - l0;
+
+    glm::vec3 c0, c1;
+    int s0 = cube.levelSize(l0);
+    sampleBilinear(cube.texel(l0, face, 0, 0), s0, s0, 3, s, t, &c0[0]);
+    if (f == 0.0f || l0 == l1)
+        return c0;
+    int s1 = cube.levelSize(l1);
+    sampleBilinear(cube.texel(l1, face, 0, 0), s1, s1, 3, s, t, &c1[0]);
+    return c0 + (c1 - c0) * f;
+}
+
+// the environment lookups of the bake kernels below, which also take the octahedral maps of ibl_octahedral.h
+inline glm::vec3 sampleEnvironment(const CpuCubemap &cube, const glm::vec3 &dir, float lod)
+{
+    return sampleCubemap(cube, dir, lod);
+}
+
+// face size of a cubemap with the same solid angle per texel, which prefilterSamples picks its mips from
+inline float environmentResolution(const CpuCubemap &cube)
+{
+    return (float)cube.size;
+}
+
+// ----------------------------------------------------------------------------
+// sample generation, identical to the helpers in 2.2.2.brdf.fs
+// ----------------------------------------------------------------------------
+inline float radicalInverseVdC(unsigned int bits)
+{
+    bits = (bits << 16u) | (bits >> 16u);
+    bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);
+    bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);
+    bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);
+    bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);
+    return float(bits) * 2.3283064365386963e-10f; // / 0x100000000
+}
+
+// GGX importance-sampled half vector in tangent space
+inline glm::vec3 importanceSampleGGX(unsigned int i, unsigned int count, float roughness)
+{
+    float a = roughness * roughness;
+    float xi0 = float(i) / float(count);
+    float xi1 = radicalInverseVdC(i);
+
+    float phi = 2.0f * IBL_PI * xi0;
+    float cosTheta = std::sqrt((1.0f - xi1) / (1.0f + (a * a - 1.0f) * xi1));
+    float sinTheta = std::sqrt(1.0f - cosTheta * cosTheta);
+    return glm::normalize(glm::vec3(std::cos(phi) * sinTheta, std::sin(phi) * sinTheta, cosTheta));
+}
+
+inline float distributionGGX(float NdotH, float roughness)
+{
+    float a = roughness * roughness;
+    float a2 = a * a;
+    float denom = NdotH * NdotH * (a2 - 1.0f) + 1.0f;
+    return a2 / (IBL_PI * denom * denom);
+}
+
+// the prefilter samples for one roughness, with V = R = N. Only depends on the roughness, so it is computed
+// once per mip; samples with NdotL <= 0 contribute nothing and are dropped. The demo uploads the same table
+// for 2.2.2.prefilter.fs.
+inline std::vector<IblSample> prefilterSamples(float roughness, unsigned int sampleCount, float envResolution)
+{
+    std::vector<IblSample> samples;
+    float saTexel = 4.0f * IBL_PI / (6.0f * envResolution * envResolution);
+    for (unsigned int i = 0; i < sampleCount; ++i)
+    {
+        glm::vec3 H = importanceSampleGGX(i, sampleCount, roughness);
+        glm::vec3 L = glm::normalize(2.0f * H.z * H - glm::vec3(0.0f, 0.0f, 1.0f));
+        float NdotL = std::max(L.z, 0.0f);
+        if (NdotL > 0.0f)
+        {
+            float NdotH = std::max(H.z, 0.0f);
+            float HdotV = std::max(H.z, 0.0f);
+            float pdf = distributionGGX(NdotH, roughness) * NdotH / (4.0f * HdotV) + 0.0001f;
+            float saSample = 1.0f / (float(sampleCount) * pdf + 0.0001f);
+
+            IblSample sample;
+            sample.L = L;
+            sample.weight = NdotL;
+            sample.lod = roughness == 0.0f ? 0.0f : 0.5f * std::log2(saSample / saTexel);
+            samples.push_back(sample);
+        }
+    }
+    return samples;
+}
+
+// the irradiance samples, walking phi/theta with the same float steps as 2.2.2.irradiance_convolution.fs.
+// weights already include the PI / nrSamples normalisation.
+inline std::vector<IblSample> irradianceSamples(float sampleDelta, float lod)
+{
+    std::vector<IblSample> samples;
+    for (float phi = 0.0f; phi < 2.0f * IBL_PI; phi += sampleDelta)
+    {
+        for (float theta = 0.0f; theta < 0.5f * IBL_PI; theta += sampleDelta)
+        {
+            IblSample sample;
+            sample.L = glm::vec3(std::sin(theta) * std::cos(phi), std::sin(theta) * std::sin(phi), std::cos(theta));
+            sample.weight = std::cos(theta) * std::sin(theta);
+            sample.lod = lod;
+            samples.push_back(sample);
+        }
+    }
+    float scale = IBL_PI / float(samples.size());
+    for (unsigned int i = 0; i < samples.size(); ++i)
+        samples[i].weight *= scale;
+    return samples;
+}
+
+// samples transposed to structure-of-arrays form (padded to a multiple of 4 with zero weights), which the
+// SIMD kernels (integrateBRDF) read four at a time.
+struct IblSampleSoA {
+    std::vector<float> x, y, z, weight, lod;
+    unsigned int count;
+
+    IblSampleSoA(const std::vector<IblSample> &samples) : count((unsigned int)samples.size())
+    {
+        size_t padded = (samples.size() + 3) & ~(size_t)3;
+        x.assign(padded, 0.0f); y.assign(padded, 0.0f); z.assign(padded, 1.0f);
+        weight.assign(padded, 0.0f); lod.assign(padded, 0.0f);
+        for (size_t i = 0; i < samples.size(); ++i)
+        {
+            x[i] = samples[i].L.x; y[i] = samples[i].L.y; z[i] = samples[i].L.z;
+            weight[i] = samples[i].weight; lod[i] = samples[i].lod;
+        }
+    }
+};
+
+// sum of weight * env(T * L.x + B * L.y + N * L.z) over all samples. Scalar: the environment fetches, where
+// the time goes, are scattered lookups with a face choice per sample.
+template <typename Environment>
+glm::vec3 integrateSamples(const Environment &env, const IblSampleSoA &samples, const glm::vec3 &T, const glm::vec3 &B, const glm::vec3 &N)
+{
+    glm::vec3 sum(0.0f);
+    for (size_t i = 0; i < samples.x.size(); ++i)
+    {
+        float w = samples.weight[i];
+        if (w != 0.0f)
+            sum += sampleEnvironment(env, T * samples.x[i] + B * samples.y[i] + N * samples.z[i], samples.lod[i]) * w;
+    }
+    return sum;
+}
+
+// runs kernel(face, x, y) for every texel of a size x size cubemap level, in parallel over face tiles.
+template <typename Kernel>
+void forEachCubeTexel(int size, const Kernel &kernel)
+{
+    int tiles = (size + IBL_CPU_TILE - 1) / IBL_CPU_TILE;
+    parallelFor(6 * tiles * tiles, [&](unsigned int task)
+    {
+        int face = task / (tiles * tiles);
+        int tx = (task % (tiles * tiles)) % tiles * IBL_CPU_TILE;
+        int ty = (task % (tiles * tiles)) / tiles * IBL_CPU_TILE;
+        for (int y = ty; y < std::min(ty + IBL_CPU_TILE, size); ++y)
+            for (int x = tx; x < std::min(tx + IBL_CPU_TILE, size); ++x)
+                kernel(face, x, y);
+    });
+}
+
+// averages 2x2 blocks of the previous level into every following level (what glGenerateMipmap does).
+inline void generateCubemapMips(CpuCubemap &cube, int fromLevel)
+{
+    for (int level = fromLevel + 1; level < (int)cube.levels.size(); ++level)
+    {
+        int size = cube.levelSize(level);
+        int src = cube.levelSize(level - 1);
+        forEachCubeTexel(size, [&](int face, int x, int y)
+        {
+            int x0 = std::min(2 * x, src - 1), x1 = std::min(2 * x + 1, src - 1);
+            int y0 = std::min(2 * y, src - 1), y1 = std::min(2 * y + 1, src - 1);
+            float *out = cube.texel(level, face, x, y);
+            for (int c = 0; c < 3; ++c)
+                out[c] = 0.25f * (cube.texel(level - 1, face, x0, y0)[c] + cube.texel(level - 1, face, x1, y0)[c] +
+                                  cube.texel(level - 1, face, x0, y1)[c] + cube.texel(level - 1, face, x1, y1)[c]);
+        });
+    }
+}
+
+inline CpuCubemap allocateCubemap(int size, int levels)
+{
+    CpuCubemap cube;
+    cube.size = size;
+    cube.levels.resize(levels);
+    for (int level = 0; level < levels; ++level)
+        cube.levels[level].assign((size_t)6 * cube.levelSize(level) * cube.levelSize(level) * 3, 0.0f);
+    return cube;
+}
+
+// tangent frame used by ImportanceSampleGGX
+inline void ggxTangentFrame(const glm::vec3 &N, glm::vec3 &T, glm::vec3 &B)
+{
+    glm::vec3 up = std::fabs(N.z) < 0.999f ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(1.0f, 0.0f, 0.0f);
+    T = glm::normalize(glm::cross(up, N));
+    B = glm::cross(N, T);
+}
+
+// index of the level of the map (cubemap or octahedral) that is size x size, or -1
+template <typename Map>
+int mipLevelOfSize(const Map &map, int size)
+{
+    for (int level = 0; level < (int)map.levels.size(); ++level)
+        if (map.levelSize(level) == size)
+            return level;
+    return -1;
+}
+
+inline float sampleWeightSum(const IblSampleSoA &samples)
+{
+    float total = 0.0f;
+    for (unsigned int i = 0; i < samples.count; ++i)
+        total += samples.weight[i];
+    return total;
+}
+
+// 2.2.2.prefilter.fs for one direction
+template <typename Environment>
+glm::vec3 prefilterTexel(const Environment &env, const IblSampleSoA &samples, float totalWeight, const glm::vec3 &N)
+{
+    glm::vec3 T, B;
+    ggxTangentFrame(N, T, B);
+    return integrateSamples(env, samples, T, B, N) / totalWeight;
+}
+
+// 2.2.2.irradiance_convolution.fs for one direction
+template <typename Environment>
+glm::vec3 irradianceTexel(const Environment &env, const IblSampleSoA &samples, const glm::vec3 &N)
+{
+    // same (unnormalised) tangent frame as the shader
+    glm::vec3 up(0.0f, 1.0f, 0.0f);
+    glm::vec3 right = glm::cross(up, N);
+    up = glm::cross(N, right);
+    return integrateSamples(env, samples, right, up, N);
+}
+
+// 2.2.2.equirectangular_to_cubemap.fs for one direction
+inline glm::vec3 sampleEquirect(const CpuImage &equirect, const glm::vec3 &v)
+{
+    float u = std::atan2(v.z, v.x) * 0.1591f + 0.5f;
+    float w = std::asin(v.y) * 0.3183f + 0.5f;
+    glm::vec3 rgb;
+    sampleBilinear(equirect.pixels.data(), equirect.width, equirect.height, 3, u, w, &rgb[0]);
+    return rgb;
+}
+
+// ----------------------------------------------------------------------------
+// the four bake products
+// ----------------------------------------------------------------------------
+
+// 2.2.2.equirectangular_to_cubemap.fs, followed by a full mip chain.
+inline CpuCubemap bakeEnvironmentCubemap(const CpuImage &equirect, int size, int levels)
+{
+    CpuCubemap cube = allocateCubemap(size, levels);
+    forEachCubeTexel(size, [&](int face, int x, int y)
+    {
+        glm::vec3 rgb = sampleEquirect(equirect, cubeTexelDirection(face, x, y, size));
+        float *out = cube.texel(0, face, x, y);
+        out[0] = rgb[0]; out[1] = rgb[1]; out[2] = rgb[2];
+    });
+    generateCubemapMips(cube, 0);
+    return cube;
+}
+
+// 2.2.2.irradiance_convolution.fs. The shader's texture() call picks its mip from screen-space
+// derivatives, which for a size-texel face over the environment comes out at log2(envSize / size).
+inline CpuCubemap bakeIrradiance(const CpuCubemap &env, int size)
+{
+    CpuCubemap cube = allocateCubemap(size, 1);
+    IblSampleSoA samples(irradianceSamples(0.025f, std::log2((float)env.size / size)));
+    forEachCubeTexel(size, [&](int face, int x, int y)
+    {
+        glm::vec3 irradiance = irradianceTexel(env, samples, cubeTexelDirection(face, x, y, size));
+        float *out = cube.texel(0, face, x, y);
+        out[0] = irradiance.r; out[1] = irradiance.g; out[2] = irradiance.b;
+    });
+    return cube;
+}
+
+// 2.2.2.prefilter.fs for the first sampleCounts.size() mips, each with its own sample count; the remaining
+// levels of the chain are box-filtered from the last baked one so the texture is mip-complete.
+inline CpuCubemap bakePrefilter(const CpuCubemap &env, int size, int levels, const std::vector<unsigned int> &sampleCounts)
+{
+    int bakedLevels = (int)sampleCounts.size();
+    CpuCubemap cube = allocateCubemap(size, levels);
+    for (int mip = 0; mip < bakedLevels; ++mip)
+    {
+        // roughness 0 is a plain copy of the environment level with the same size
+        if (sampleCounts[mip] == 0)
+        {
+            cube.levels[mip] = env.levels[mipLevelOfSize(env, cube.levelSize(mip))];
+            continue;
+        }
+        float roughness = (float)mip / (float)(bakedLevels - 1);
+        IblSampleSoA samples(prefilterSamples(roughness, sampleCounts[mip], environmentResolution(env)));
+        float totalWeight = sampleWeightSum(samples);
+
+        int mipSize = cube.levelSize(mip);
+        forEachCubeTexel(mipSize, [&](int face, int x, int y)
+        {
+            glm::vec3 color = prefilterTexel(env, samples, totalWeight, cubeTexelDirection(face, x, y, mipSize));
+            float *out = cube.texel(mip, face, x, y);
+            out[0] = color.r; out[1] = color.g; out[2] = color.b;
+        });
+    }
+    generateCubemapMips(cube, bakedLevels - 1);
+    return cube;
+}
+
+// per-mip sample counts of the prefilter bake, chosen from a target error
+struct PrefilterBudget {
+    std::vector<unsigned int> sampleCounts; // 0 = copied from the environment level of the same size
+    std::vector<float> errors;              // relative RMS error against the reference that was achieved
+};
+
+// picks the smallest power-of-two sample count per mip (between minSamples and maxSamples) whose result
+// stays within targetError (relative RMS) of a 4 * maxSamples reference. The error is measured on a grid
+// of at most 8x8 probe texels per face, so this costs a small fraction of a full bake. Mip 0 (roughness 0)
+// is a copy whenever the environment has a level of the same size. The environment can be a cubemap or an
+// octahedral map; the probes are cubemap texel directions either way.
+template <typename Environment>
+PrefilterBudget choosePrefilterBudget(const Environment &env, int size, int bakedLevels, float targetError,
+                                      unsigned int minSamples, unsigned int maxSamples)
+{
+    PrefilterBudget budget;
+    budget.sampleCounts.resize(bakedLevels);
+    budget.errors.assign(bakedLevels, 0.0f);
+    for (int mip = 0; mip < bakedLevels; ++mip)
+    {
+        int mipSize = std::max(size >> mip, 1);
+        if (mip == 0 && mipLevelOfSize(env, mipSize) >= 0)
+        {
+            budget.sampleCounts[mip] = 0;
+            continue;
+        }
+        float roughness = (float)mip / (float)(bakedLevels - 1);
+
+        int grid = std::min(mipSize, 8);
+        std::vector<glm::vec3> probes;
+        for (int face = 0; face < 6; ++face)
+            for (int j = 0; j < grid; ++j)
+                for (int i = 0; i < grid; ++i)
+                    probes.push_back(cubeTexelDirection(face, i * mipSize / grid, j * mipSize / grid, mipSize));
+
+        // prefilters every probe with the given sample count
+        auto evaluate = [&](unsigned int sampleCount)
+        {
+            IblSampleSoA samples(prefilterSamples(roughness, sampleCount, environmentResolution(env)));
+            float totalWeight = sampleWeightSum(samples);
+            std::vector<glm::vec3> colors(probes.size());
+            parallelFor((unsigned int)probes.size(), [&](unsigned int p)
+            {
+                colors[p] = prefilterTexel(env, samples, totalWeight, probes[p]);
+            });
+            return colors;
+        };
+        std::vector<glm::vec3> reference = evaluate(4 * maxSamples);
+
+        unsigned int count = minSamples;
+        while (true)
+        {
+            std::vector<glm::vec3> colors = evaluate(count);
+            double diff = 0.0, ref = 0.0;
+            for (size_t p = 0; p < probes.size(); ++p)
+            {
+                glm::vec3 d = colors[p] - reference[p];
+                diff += glm::dot(d, d);
+                ref += glm::dot(reference[p], reference[p]);
+            }
+            budget.sampleCounts[mip] = count;
+            budget.errors[mip] = ref > 0.0 ? (float)std::sqrt(diff / ref) : 0.0f;
+            if (budget.errors[mip] <= targetError || count >= maxSamples)
+                break;
+            count = std::min(count * 2, maxSamples);
+        }
+    }
+    return budget;
+}
+
+// IntegrateBRDF from 2.2.2.brdf.fs for one texel, given the row's half vectors in SoA form.
+inline glm::vec2 integrateBRDF(float NdotV, float roughness, const IblSampleSoA &H)
+{
+    float Vx = std::sqrt(1.0f - NdotV * NdotV), Vz = NdotV;
+    float k = (roughness * roughness) / 2.0f;
+    float A = 0.0f, B = 0.0f;
+    size_t padded = H.x.size();
+#ifdef SIMD_SSE2
+    const __m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f), two = _mm_set1_ps(2.0f);
+    const __m128 vx = _mm_set1_ps(Vx), vz = _mm_set1_ps(Vz), kk = _mm_set1_ps(k), oneMinusK = _mm_set1_ps(1.0f - k);
+    const __m128 nDotV = _mm_set1_ps(NdotV);
+    const __m128 gV = _mm_div_ps(nDotV, _mm_add_ps(_mm_mul_ps(nDotV, oneMinusK), kk));
+    __m128 sumA = zero, sumB = zero;
+    for (size_t i = 0; i < padded; i += 4)
+    {
+        __m128 hx = _mm_loadu_ps(&H.x[i]), hz = _mm_loadu_ps(&H.z[i]);
+        __m128 valid = _mm_cmpgt_ps(_mm_loadu_ps(&H.weight[i]), zero);
+        __m128 vDotH = _mm_add_ps(_mm_mul_ps(vx, hx), _mm_mul_ps(vz, hz));
+        __m128 lz = _mm_sub_ps(_mm_mul_ps(_mm_mul_ps(two, vDotH), hz), vz);
+        __m128 nDotL = _mm_max_ps(lz, zero);
+        __m128 nDotH = _mm_max_ps(hz, zero);
+        vDotH = _mm_max_ps(vDotH, zero);
+        valid = _mm_and_ps(valid, _mm_cmpgt_ps(nDotL, zero));
+
+        __m128 gL = _mm_div_ps(nDotL, _mm_add_ps(_mm_mul_ps(nDotL, oneMinusK), kk));
+        __m128 gVis = _mm_div_ps(_mm_mul_ps(_mm_mul_ps(gL, gV), vDotH), _mm_mul_ps(nDotH, nDotV));
+        __m128 f = _mm_sub_ps(one, vDotH);
+        __m128 f2 = _mm_mul_ps(f, f);
+        __m128 fc = _mm_mul_ps(_mm_mul_ps(f2, f2), f);
+        gVis = _mm_and_ps(gVis, valid);
+        sumA = _mm_add_ps(sumA, _mm_mul_ps(_mm_sub_ps(one, fc), gVis));
+        sumB = _mm_add_ps(sumB, _mm_mul_ps(fc, gVis));
+    }
+    alignas(16) float a[4], b[4];
+    _mm_store_ps(a, sumA);
+    _mm_store_ps(b, sumB);
+    A = (a[0] + a[1]) + (a[2] + a[3]);
+    B = (b[0] + b[1]) + (b[2] + b[3]);
+#else
+    for (size_t i = 0; i < padded; ++i)
+    {
+        if (H.weight[i] == 0.0f)
+            continue;
+        float VdotH = Vx * H.x[i] + Vz * H.z[i];
+        float NdotL = std::max(2.0f * VdotH * H.z[i] - Vz, 0.0f);
+        float NdotH = std::max(H.z[i], 0.0f);
+        VdotH = std::max(VdotH, 0.0f);
+        if (NdotL > 0.0f)
+        {
+            float G = (NdotV / (NdotV * (1.0f - k) + k)) * (NdotL / (NdotL * (1.0f - k) + k));
+            float G_Vis = (G * VdotH) / (NdotH * NdotV);
+            float Fc = std::pow(1.0f - VdotH, 5.0f);
+            A += (1.0f - Fc) * G_Vis;
+            B += Fc * G_Vis;
+        }
+    }
+#endif
+    return glm::vec2(A, B) / float(H.count);
+}
+
+// EnvBRDFApprox from 2.2.2.pbr.fs
+inline glm::vec2 envBrdfApprox(float NdotV, float roughness)
+{
+    const glm::vec4 c0(-1.0f, -0.0275f, -0.572f, 0.022f);
+    const glm::vec4 c1(1.0f, 0.0425f, 1.04f, -0.04f);
+    glm::vec4 r = roughness * c0 + c1;
+    float a004 = std::min(r.x * r.x, std::exp2(-9.28f * NdotV)) * r.x + r.y;
+    return glm::vec2(-1.04f, 1.04f) * a004 + glm::vec2(r.z, r.w);
+}
+
+// 2.2.2.brdf.fs; x = NdotV, y = roughness, sampled at texel centres like the full-screen quad.
+inline CpuImage bakeBrdfLut(int size, unsigned int sampleCount)
+{
+    CpuImage lut;
+    lut.width = size;
+    lut.height = size;
+    lut.channels = 2;
+    lut.pixels.assign((size_t)size * size * 2, 0.0f);
+    parallelFor(size, [&](unsigned int y)
+    {
+        float roughness = (y + 0.5f) / size;
+        std::vector<IblSample> halfVectors(sampleCount);
+        for (unsigned int i = 0; i < sampleCount; ++i)
+        {
+            halfVectors[i].L = importanceSampleGGX(i, sampleCount, roughness);
+            halfVectors[i].weight = 1.0f;
+            halfVectors[i].lod = 0.0f;
+        }
+        IblSampleSoA H(halfVectors);
+        for (int x = 0; x < size; ++x)
+        {
+            glm::vec2 ab = integrateBRDF((x + 0.5f) / size, roughness, H);
+            lut.pixels[((size_t)y * size + x) * 2 + 0] = ab.x;
+            lut.pixels[((size_t)y * size + x) * 2 + 1] = ab.y;
+        }
+    });
+    return lut;
+}
+
+#endif
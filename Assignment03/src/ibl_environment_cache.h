@@ -0,0 +1,335 @@
+#ifndef _IBL_ENVIRONMENT_CACHE_H_
+#define _IBL_ENVIRONMENT_CACHE_H_
+
+#pragma once
+
+#include <GL/glew.h>
+#include <learnopengl/asset_pipeline.h>
+
+#include "ibl_bake_queue.h"
+#include "ibl_cache.h"
+#include "ibl_hdr.h"
+#include "ibl_rgb9e5.h"
+#include "ibl_settings.h"
+#include "ibl_sh.h"
+
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+// one registered environment and its baked maps, cubemaps or octahedral 2D maps depending on IBL_LAYOUT. The
+// textures only exist while the set is resident.
+struct IblEnvironment {
+    std::string hdrPath;
+    std::string cachePath;
+    unsigned int envCubemap = 0;
+    unsigned int irradianceMap = 0;     // stays 0 when the diffuse term comes from SH
+    unsigned int prefilterMap = 0;
+    ShCoefficients sh;
+    // what has been loaded or baked so far; a bake fills these in one at a time
+    bool environmentReady = false, irradianceReady = false, prefilterReady = false, shReady = false;
+    bool resident = false;              // textures allocated (loading or complete)
+    bool complete = false;
+    bool failed = false;                // the HDR image couldn't be read, not retried
+    unsigned long long lastUsed = 0;
+    // GPU memory of each map as it's allocated right now: RGBA16F bake targets, or the storage format once
+    // re-uploaded
+    size_t envBytes = 0, irradianceBytes = 0, prefilterBytes = 0;
+
+    // the baked textures in cache file order (IBL_bake writes the same order)
+    std::vector<IblCacheTexture> cacheTextures() const
+    {
+        std::vector<IblCacheTexture> textures;
+        textures.push_back({ envCubemap, iblMapTarget(), iblStorageFormat(), GL_RGB, mipLevelCount(iblMapSize(ENV_CUBEMAP_SIZE)) });
+        if (!USE_SH_IRRADIANCE)
+            textures.push_back({ irradianceMap, iblMapTarget(), iblStorageFormat(), GL_RGB, 1 });
+        textures.push_back({ prefilterMap, iblMapTarget(), iblStorageFormat(), GL_RGB, (int)PREFILTER_MIP_LEVELS });
+        return textures;
+    }
+
+    // GPU memory of the set while resident
+    size_t bytes() const
+    {
+        return envBytes + irradianceBytes + prefilterBytes;
+    }
+
+    // the maps as bake targets (allocate()), the most a set takes
+    void setBakeTargetBytes()
+    {
+        envBytes = mapBytes(iblMapSize(ENV_CUBEMAP_SIZE), mipLevelCount(iblMapSize(ENV_CUBEMAP_SIZE)), GL_RGBA16F);
+        irradianceBytes = USE_SH_IRRADIANCE ? 0 : mapBytes(iblMapSize(IRRADIANCE_SIZE), 1, GL_RGBA16F);
+        prefilterBytes = mapBytes(iblMapSize(PREFILTER_SIZE), PREFILTER_MIP_LEVELS, GL_RGBA16F);
+    }
+
+    // re-specifies one of the maps from a cached image and counts it in its new format
+    void upload(const IblCacheTexture &tex, const IblCacheImage &image)
+    {
+        uploadIblTexture(tex, image);
+        size_t total = image.levels.empty() ? 0 : mapBytes(image.levels[0].width, (int)image.levels.size(), image.internalFormat);
+        if (tex.id == envCubemap)
+            envBytes = total;
+        else if (tex.id == irradianceMap)
+            irradianceBytes = total;
+        else if (tex.id == prefilterMap)
+            prefilterBytes = total;
+    }
+
+    // RGB16F is padded to four channels like RGBA16F by the drivers
+    static size_t mapBytes(size_t size, int levels, GLenum internalFormat)
+    {
+        size_t texelBytes = internalFormat == GL_RGB9_E5 ? 4 : 8;
+        size_t total = 0;
+        for (int level = 0; level < levels; ++level, size = size > 1 ? size / 2 : 1)
+            total += iblCacheFaces(iblMapTarget()) * size * size * texelBytes;
+        return total;
+    }
+};
+
+// what a worker thread found on disk for an environment: its cache key, the cached maps and SH if they're
+// valid, and otherwise the decoded HDR image to bake from.
+struct IblEnvironmentSource {
+    uint64_t key = 0;
+    bool mapsCached = false, shCached = false;
+    std::vector<IblCacheImage> images;
+    ShCoefficients sh;
+    HdrImage hdr;                      // decoded straight into the storage format of the bake's equirect texture
+};
+
+// keeps a list of environments and switches between them without stalling the render loop. The selected
+// environment is loaded from its cache (read and validated on a worker, uploaded in bake slices) or baked
+// through the slices the bake function queues; the previous one stays on screen until it's complete.
+// complete sets stay resident for quick switching back, up to budgetBytes, beyond which the least recently
+// used ones are freed.
+class IblEnvironmentCache {
+public:
+    // queues the bake slices for whatever the source didn't find on disk. It's called from a slice of the
+    // load, which completes once the slices it added have run.
+    typedef std::function<void(IblEnvironment &, std::shared_ptr<IblEnvironmentSource>)> BakeFunction;
+
+    IblEnvironmentCache(IblBakeQueue &queue, AssetPipeline &assets, size_t budgetBytes, const BakeFunction &bake)
+        : queue(queue), assets(assets), budgetBytes(budgetBytes), bake(bake)
+    {
+    }
+
+    int add(const std::string &hdrPath)
+    {
+        environments.push_back(IblEnvironment());
+        environments.back().hdrPath = hdrPath;
+        environments.back().cachePath = iblCachePath(hdrPath);
+        return (int)environments.size() - 1;
+    }
+
+    size_t size() const
+    {
+        return environments.size();
+    }
+
+    // switches right away when the environment is complete, otherwise once its load has finished.
+    void select(int index)
+    {
+        selected = index;
+        environments[index].lastUsed = ++useClock;
+        if (environments[index].complete)
+            displayed = index;
+        update();
+    }
+
+    // call once per frame: starts the load of the selected environment and frees sets beyond the budget.
+    void update()
+    {
+        if (loading < 0 && selected >= 0)
+        {
+            IblEnvironment &environment = environments[selected];
+            if (!environment.resident && !environment.failed)
+                startLoad(selected);
+        }
+        makeRoom(0);
+    }
+
+    // the complete environment on screen, or while there's none yet, the one being loaded (partially ready)
+    const IblEnvironment *shown() const
+    {
+        if (displayed >= 0)
+            return &environments[displayed];
+        return loading >= 0 ? &environments[loading] : nullptr;
+    }
+
+    size_t residentBytes() const
+    {
+        size_t total = 0;
+        for (unsigned int i = 0; i < environments.size(); ++i)
+            if (environments[i].resident)
+                total += environments[i].bytes();
+        return total;
+    }
+
+private:
+    IblBakeQueue &queue;
+    AssetPipeline &assets;
+    size_t budgetBytes;
+    BakeFunction bake;
+    std::deque<IblEnvironment> environments; // stable addresses, the slices hold on to them
+    int selected = -1, displayed = -1, loading = -1;
+    unsigned long long useClock = 0;
+
+    void startLoad(int index)
+    {
+        IblEnvironment &environment = environments[index];
+        // the set counts as its RGBA16F bake targets until the maps are re-uploaded
+        allocate(environment);
+        loading = index;
+        makeRoom(0);
+
+        // 1. the cache key hashes the HDR file, so it's computed on a worker along with the cache read
+        std::string hdrPath = environment.hdrPath, cachePath = environment.cachePath;
+        std::vector<IblCacheTexture> layout = environment.cacheTextures();
+        std::shared_future<std::shared_ptr<IblEnvironmentSource> > read = assets.async([hdrPath, cachePath, layout]()
+        {
+            std::shared_ptr<IblEnvironmentSource> source = std::make_shared<IblEnvironmentSource>();
+            source->key = iblBakeKey(hdrPath);
+            source->mapsCached = readIblCache(cachePath, source->key, source->images) && iblCacheMatches(source->images, layout);
+            source->shCached = !USE_SH_IRRADIANCE || loadShCache(shCachePath(cachePath), source->key, source->sh);
+            // flipped like every image the demo loads through stb_image
+            if (!source->mapsCached || !source->shCached)
+                source->hdr = loadHdrImage(hdrPath, IBL_STORAGE == IBL_STORAGE_RGB9E5 ? HDR_PIXELS_RGB9E5 : HDR_PIXELS_HALF, true);
+            return source;
+        });
+        queue.add([read]()
+        {
+            return read.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        });
+
+        // 2. cached maps are uploaded one texture per slice
+        for (unsigned int t = 0; t < layout.size(); ++t)
+        {
+            queue.add([&environment, read, t]()
+            {
+                if (read.get()->mapsCached)
+                    environment.upload(environment.cacheTextures()[t], read.get()->images[t]);
+                return true;
+            });
+        }
+
+        // 3. whatever wasn't cached is baked
+        queue.add([this, index, &environment, read]()
+        {
+            IblEnvironmentSource &found = *read.get();
+            found.images.clear();
+            if (found.shCached)
+            {
+                environment.sh = found.sh;
+                environment.shReady = true;
+            }
+            if (found.mapsCached)
+            {
+                environment.environmentReady = environment.prefilterReady = environment.irradianceReady = true;
+                std::cout << "Loaded baked IBL maps from " << environment.cachePath << std::endl;
+            }
+            if ((!found.mapsCached || !found.shCached) && !found.hdr.valid())
+            {
+                // keep showing what's there rather than baking (and caching) black maps
+                std::cout << "Failed to load HDR image " << environment.hdrPath << std::endl;
+                environment.failed = true;
+                release(environment);
+                loading = -1;
+                return true;
+            }
+            if (!found.mapsCached || !found.shCached)
+                bake(environment, read.get());
+            queue.add([this, index, &environment]()
+            {
+                environment.complete = true;
+                if (selected == index)
+                {
+                    displayed = index;
+                    environment.lastUsed = ++useClock;
+                }
+                loading = -1;
+                return true;
+            });
+            return true;
+        });
+    }
+
+    // the maps start out as RGBA16F bake targets; a cache load or the end of a bake re-specifies them in
+    // the storage format
+    void allocate(IblEnvironment &environment)
+    {
+        // pbr: setup cubemap to render to and attach to framebuffer
+        // enable pre-filter mipmap sampling (combatting visible dots artifact)
+        environment.envCubemap = createMap(iblMapSize(ENV_CUBEMAP_SIZE), GL_LINEAR_MIPMAP_LINEAR);
+
+        // pbr: create an irradiance cubemap (not needed when the diffuse term comes from SH)
+        if (!USE_SH_IRRADIANCE)
+            environment.irradianceMap = createMap(iblMapSize(IRRADIANCE_SIZE), GL_LINEAR);
+
+        // pbr: create a pre-filter cubemap
+        // be sure to set minification filter to mip_linear
+        environment.prefilterMap = createMap(iblMapSize(PREFILTER_SIZE), GL_LINEAR_MIPMAP_LINEAR);
+        // generate mipmaps for the cubemap so OpenGL automatically allocates the required memory; only the
+        // levels the bake fills, which are all the sampler may read
+        glTexParameteri(iblMapTarget(), GL_TEXTURE_MAX_LEVEL, PREFILTER_MIP_LEVELS - 1);
+        glGenerateMipmap(iblMapTarget());
+
+        environment.setBakeTargetBytes();
+        environment.resident = true;
+    }
+
+    // an empty cubemap or octahedral map of the given size to bake into. It's RGBA16F rather than RGB16F so the
+    // compute bake can bind it as an image; drivers pad RGB16F texels to four channels anyway.
+    static unsigned int createMap(unsigned int size, GLenum minFilter)
+    {
+        GLenum target = iblMapTarget();
+        unsigned int map;
+        glGenTextures(1, &map);
+        glBindTexture(target, map);
+        for (int face = 0; face < iblCacheFaces(target); ++face)
+            glTexImage2D(iblCacheFaceTarget(target, face), 0, GL_RGBA16F, size, size, 0, GL_RGBA, GL_FLOAT, nullptr);
+        glTexParameteri(target, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(target, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexParameteri(target, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+        glTexParameteri(target, GL_TEXTURE_MIN_FILTER, minFilter);
+        glTexParameteri(target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        return map;
+    }
+
+    void release(IblEnvironment &environment)
+    {
+        if (!environment.resident)
+            return;
+        glDeleteTextures(1, &environment.envCubemap);
+        if (environment.irradianceMap)
+            glDeleteTextures(1, &environment.irradianceMap);
+        glDeleteTextures(1, &environment.prefilterMap);
+        environment.envCubemap = environment.irradianceMap = environment.prefilterMap = 0;
+        environment.envBytes = environment.irradianceBytes = environment.prefilterBytes = 0;
+        environment.environmentReady = environment.irradianceReady = environment.prefilterReady = environment.shReady = false;
+        environment.resident = environment.complete = false;
+    }
+
+    // frees the least recently used complete sets until extraBytes more fit in the budget. The selected,
+    // displayed and loading sets are never freed, so the budget can be exceeded while switching.
+    void makeRoom(size_t extraBytes)
+    {
+        while (residentBytes() + extraBytes > budgetBytes)
+        {
+            int victim = -1;
+            for (unsigned int i = 0; i < environments.size(); ++i)
+            {
+                const IblEnvironment &environment = environments[i];
+                if (!environment.complete || (int)i == selected || (int)i == displayed || (int)i == loading)
+                    continue;
+                if (victim < 0 || environment.lastUsed < environments[victim].lastUsed)
+                    victim = i;
+            }
+            if (victim < 0)
+                return;
+            release(environments[victim]);
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,423 @@
+#ifndef _IBL_HDR_H_
+#define _IBL_HDR_H_
+
+#pragma once
+
+// Radiance .hdr (RGBE) reader for the environment images. The file is memory-mapped, a quick pass over the
+// run-length headers finds where every scanline starts, and the scanlines are then decoded in parallel chunks
+// straight into the pixel format the image is uploaded in: half floats or RGB9_E5 (or floats, for the offline
+// baker). stbi_loadf goes through 12 bytes per pixel of floats on one thread before anything can be packed.
+// Reads the same subset of the format as stb_image: 32-bit_rle_rgbe, "-Y height +X width", flat or new-style
+// RLE scanlines.
+
+#include <GL/glew.h>
+#include <glm/gtc/packing.hpp>
+#include <learnopengl/mapped_file.h>
+#include <learnopengl/parallel.h>
+#include <learnopengl/simd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ibl_rgb9e5.h"
+
+enum HdrPixelFormat { HDR_PIXELS_FLOAT, HDR_PIXELS_HALF, HDR_PIXELS_RGB9E5 };
+
+inline size_t hdrPixelBytes(HdrPixelFormat format)
+{
+    return format == HDR_PIXELS_FLOAT ? 12 : format == HDR_PIXELS_HALF ? 6 : 4;
+}
+
+// a decoded RGB image, rows bottom to top when it was loaded flipped (like stbi_set_flip_vertically_on_load)
+struct HdrImage {
+    int width = 0, height = 0;
+    HdrPixelFormat format = HDR_PIXELS_FLOAT;
+    std::vector<unsigned char> pixels;
+
+    bool valid() const { return !pixels.empty(); }
+    const unsigned char *row(int y) const { return pixels.data() + (size_t)y * width * hdrPixelBytes(format); }
+
+    // the width RGB floats of row y
+    void rowRGB(int y, float *rgb) const
+    {
+        const unsigned char *data = row(y);
+        if (format == HDR_PIXELS_FLOAT)
+            std::memcpy(rgb, data, (size_t)width * 12);
+        else if (format == HDR_PIXELS_HALF)
+            for (int i = 0; i < width * 3; ++i)
+                rgb[i] = glm::unpackHalf1x16(((const uint16_t *)data)[i]);
+        else
+            for (int x = 0; x < width; ++x)
+            {
+                glm::vec3 c = decodeRGB9E5(((const uint32_t *)data)[x]);
+                rgb[x * 3 + 0] = c.r; rgb[x * 3 + 1] = c.g; rgb[x * 3 + 2] = c.b;
+            }
+    }
+};
+
+// ----------------------------------------------------------------------------
+// RGBE -> output pixels, from one scanline in planar form (all R, then G, B and E bytes)
+// ----------------------------------------------------------------------------
+
+inline void rgbeToFloat(unsigned char r, unsigned char g, unsigned char b, unsigned char e, float *out)
+{
+    // same as stb_image: a zero exponent is black, otherwise mantissa * 2^(e - 128 - 8)
+    float scale = e ? std::ldexp(1.0f, e - 136) : 0.0f;
+    out[0] = r * scale; out[1] = g * scale; out[2] = b * scale;
+}
+
+#ifdef SIMD_SSE2
+inline __m128i loadBytes4(const unsigned char *p)
+{
+    int32_t v;
+    std::memcpy(&v, p, 4);
+    __m128i zero = _mm_setzero_si128();
+    return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(v), zero), zero);
+}
+#endif
+
+// RGBE and RGB9_E5 both share one exponent, so normalized RGBE texels (top mantissa bit set) map exactly:
+// mantissas doubled, exponent - 113. That gives the bits encodeRGB9E5 would for the same floats. Exponents
+// outside RGB9_E5's range (darker than 2^-16, brighter than its max) go through the float encoder, and so
+// does everything without SSE2.
+inline void rgbeRowToRGB9E5(const unsigned char *planar, int width, uint32_t *out)
+{
+    const unsigned char *r = planar, *g = planar + width, *b = planar + 2 * width, *e = planar + 3 * width;
+    int x = 0;
+#ifdef SIMD_SSE2
+    const __m128i zero = _mm_setzero_si128(), low = _mm_set1_epi32(112), high = _mm_set1_epi32(145), bias = _mm_set1_epi32(113);
+    for (; x + 4 <= width; x += 4)
+    {
+        __m128i ev = loadBytes4(e + x);
+        __m128i black = _mm_cmpeq_epi32(ev, zero);
+        __m128i inRange = _mm_and_si128(_mm_cmpgt_epi32(ev, low), _mm_cmplt_epi32(ev, high));
+        if (_mm_movemask_ps(_mm_castsi128_ps(_mm_or_si128(black, inRange))) != 0xf)
+        {
+            for (int i = x; i < x + 4; ++i)
+            {
+                float rgb[3];
+                rgbeToFloat(r[i], g[i], b[i], e[i], rgb);
+                out[i] = encodeRGB9E5(rgb[0], rgb[1], rgb[2]);
+            }
+            continue;
+        }
+        __m128i packed = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(loadBytes4(r + x), 1), _mm_slli_epi32(loadBytes4(g + x), 10)),
+                                      _mm_or_si128(_mm_slli_epi32(loadBytes4(b + x), 19), _mm_slli_epi32(_mm_sub_epi32(ev, bias), 27)));
+        _mm_storeu_si128((__m128i *)(out + x), _mm_andnot_si128(black, packed));
+    }
+#endif
+    for (; x < width; ++x)
+    {
+        float rgb[3];
+        rgbeToFloat(r[x], g[x], b[x], e[x], rgb);
+        out[x] = encodeRGB9E5(rgb[0], rgb[1], rgb[2]);
+    }
+}
+
+#ifdef SIMD_SSE2
+// mantissa * 2^(e - 136) for four texels, built from the exponent bits; exponents 1-9 are subnormal floats
+// and come out wrong, the callers catch them
+inline void rgbeToFloat4(const unsigned char *r, const unsigned char *g, const unsigned char *b, const unsigned char *e,
+                         __m128 &rf, __m128 &gf, __m128 &bf)
+{
+    __m128i ev = loadBytes4(e);
+    __m128 scale = _mm_andnot_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(ev, _mm_setzero_si128())), exp2i(_mm_sub_epi32(ev, _mm_set1_epi32(136))));
+    rf = _mm_mul_ps(_mm_cvtepi32_ps(loadBytes4(r)), scale);
+    gf = _mm_mul_ps(_mm_cvtepi32_ps(loadBytes4(g)), scale);
+    bf = _mm_mul_ps(_mm_cvtepi32_ps(loadBytes4(b)), scale);
+}
+
+inline bool rgbeSubnormal4(const unsigned char *e)
+{
+    __m128i ev = loadBytes4(e);
+    __m128i tiny = _mm_andnot_si128(_mm_cmpeq_epi32(ev, _mm_setzero_si128()), _mm_cmplt_epi32(ev, _mm_set1_epi32(10)));
+    return _mm_movemask_ps(_mm_castsi128_ps(tiny)) != 0;
+}
+#endif
+
+inline void rgbeRowToFloat(const unsigned char *planar, int width, float *out)
+{
+    const unsigned char *r = planar, *g = planar + width, *b = planar + 2 * width, *e = planar + 3 * width;
+    int x = 0;
+#ifdef SIMD_SSE2
+    for (; x + 4 <= width; x += 4)
+    {
+        if (rgbeSubnormal4(e + x))
+        {
+            for (int i = x; i < x + 4; ++i)
+                rgbeToFloat(r[i], g[i], b[i], e[i], out + i * 3);
+            continue;
+        }
+        __m128 rf, gf, bf;
+        rgbeToFloat4(r + x, g + x, b + x, e + x, rf, gf, bf);
+        float lanes[12];
+        _mm_storeu_ps(lanes, rf);
+        _mm_storeu_ps(lanes + 4, gf);
+        _mm_storeu_ps(lanes + 8, bf);
+        float *p = out + x * 3;
+        for (int i = 0; i < 4; ++i)
+        {
+            p[i * 3 + 0] = lanes[i];
+            p[i * 3 + 1] = lanes[4 + i];
+            p[i * 3 + 2] = lanes[8 + i];
+        }
+    }
+#endif
+    for (; x < width; ++x)
+        rgbeToFloat(r[x], g[x], b[x], e[x], out + x * 3);
+}
+
+inline uint16_t floatToHalfClamped(float v)
+{
+    // like the RGB9_E5 encoder, clamp to the largest finite value rather than overflowing to infinity
+    return glm::packHalf1x16(std::min(v, 65504.0f));
+}
+
+// an 8-bit mantissa times a power of two has at most 8 significant bits, so it's exact in a half float as
+// long as it's in the normal half range (float exponent 113-142): the half bits are the float bits shifted
+// down with the exponent re-biased, no rounding. Anything else (half subnormals, overflow) takes the scalar path.
+#ifdef SIMD_SSE2
+inline __m128i floatToHalfExact4(__m128 v, __m128i &outOfRange)
+{
+    __m128i bits = _mm_castps_si128(v);
+    __m128i exponent = _mm_srli_epi32(bits, 23);
+    __m128i zero = _mm_cmpeq_epi32(bits, _mm_setzero_si128());
+    __m128i normal = _mm_and_si128(_mm_cmpgt_epi32(exponent, _mm_set1_epi32(112)), _mm_cmplt_epi32(exponent, _mm_set1_epi32(143)));
+    outOfRange = _mm_or_si128(outOfRange, _mm_andnot_si128(_mm_or_si128(zero, normal), _mm_set1_epi32(-1)));
+    __m128i half = _mm_sub_epi32(_mm_srli_epi32(bits, 13), _mm_set1_epi32(112 << 10));
+    return _mm_andnot_si128(zero, half);
+}
+#endif
+
+inline void rgbeRowToHalf(const unsigned char *planar, int width, uint16_t *out)
+{
+    const unsigned char *r = planar, *g = planar + width, *b = planar + 2 * width, *e = planar + 3 * width;
+    int x = 0;
+#ifdef SIMD_SSE2
+    for (; x + 4 <= width; x += 4)
+    {
+        __m128i outOfRange = _mm_setzero_si128();
+        __m128i rh = _mm_setzero_si128(), gh = rh, bh = rh;
+        if (!rgbeSubnormal4(e + x))
+        {
+            __m128 rf, gf, bf;
+            rgbeToFloat4(r + x, g + x, b + x, e + x, rf, gf, bf);
+            rh = floatToHalfExact4(rf, outOfRange);
+            gh = floatToHalfExact4(gf, outOfRange);
+            bh = floatToHalfExact4(bf, outOfRange);
+        }
+        else
+            outOfRange = _mm_set1_epi32(-1);
+        if (_mm_movemask_ps(_mm_castsi128_ps(outOfRange)))
+        {
+            for (int i = x; i < x + 4; ++i)
+            {
+                float rgb[3];
+                rgbeToFloat(r[i], g[i], b[i], e[i], rgb);
+                for (int c = 0; c < 3; ++c)
+                    out[i * 3 + c] = floatToHalfClamped(rgb[c]);
+            }
+            continue;
+        }
+        // finite positive halfs fit in a signed 16-bit lane, so packs doesn't saturate them
+        uint16_t lanes[12];
+        _mm_storeu_si128((__m128i *)lanes, _mm_packs_epi32(rh, gh));
+        _mm_storel_epi64((__m128i *)(lanes + 8), _mm_packs_epi32(bh, bh));
+        uint16_t *p = out + x * 3;
+        for (int i = 0; i < 4; ++i)
+        {
+            p[i * 3 + 0] = lanes[i];
+            p[i * 3 + 1] = lanes[4 + i];
+            p[i * 3 + 2] = lanes[8 + i];
+        }
+    }
+#endif
+    for (; x < width; ++x)
+    {
+        float rgb[3];
+        rgbeToFloat(r[x], g[x], b[x], e[x], rgb);
+        for (int c = 0; c < 3; ++c)
+            out[x * 3 + c] = floatToHalfClamped(rgb[c]);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// file structure
+// ----------------------------------------------------------------------------
+
+// reads one header line starting at pos; false at the end of the data
+inline bool readHdrLine(const unsigned char *data, size_t size, size_t &pos, std::string &line)
+{
+    if (pos >= size)
+        return false;
+    const unsigned char *end = (const unsigned char *)std::memchr(data + pos, '\n', size - pos);
+    size_t lineEnd = end ? (size_t)(end - data) : size;
+    line.assign((const char *)data + pos, lineEnd - pos);
+    pos = end ? lineEnd + 1 : size;
+    return true;
+}
+
+// start of every scanline after the header, or an empty list if the data is cut short or malformed.
+// rle tells whether the scanlines use new-style run-length encoding (otherwise they're flat RGBE).
+inline std::vector<size_t> indexHdrScanlines(const unsigned char *data, size_t size, size_t pos, int width, int height, bool &rle)
+{
+    std::vector<size_t> offsets(height);
+    rle = width >= 8 && width < 32768 && pos + 4 <= size && data[pos] == 2 && data[pos + 1] == 2 && !(data[pos + 2] & 0x80);
+    for (int y = 0; y < height; ++y)
+    {
+        offsets[y] = pos;
+        if (!rle)
+        {
+            pos += (size_t)width * 4;
+            if (pos > size)
+                return std::vector<size_t>();
+            continue;
+        }
+        if (pos + 4 > size || data[pos] != 2 || data[pos + 1] != 2 || ((data[pos + 2] << 8) | data[pos + 3]) != width)
+            return std::vector<size_t>();
+        pos += 4;
+        // only the run headers are read here, the pixel bytes are skipped
+        for (int channel = 0; channel < 4; ++channel)
+        {
+            for (int x = 0; x < width;)
+            {
+                if (pos >= size)
+                    return std::vector<size_t>();
+                int count = data[pos++];
+                if (count > 128)
+                {
+                    count -= 128;
+                    pos += 1;
+                }
+                else
+                    pos += count;
+                if (count == 0 || x + count > width)
+                    return std::vector<size_t>();
+                x += count;
+            }
+        }
+        if (pos > size)
+            return std::vector<size_t>();
+    }
+    return offsets;
+}
+
+// decodes the scanline at pos into planar R, G, B, E bytes; the scanline was validated by indexHdrScanlines
+inline void decodeHdrScanline(const unsigned char *data, size_t pos, int width, bool rle, unsigned char *planar)
+{
+    if (!rle)
+    {
+        const unsigned char *p = data + pos;
+        for (int x = 0; x < width; ++x, p += 4)
+            for (int c = 0; c < 4; ++c)
+                planar[c * width + x] = p[c];
+        return;
+    }
+    pos += 4;
+    for (int channel = 0; channel < 4; ++channel)
+    {
+        unsigned char *out = planar + channel * width;
+        for (int x = 0; x < width;)
+        {
+            int count = data[pos++];
+            if (count > 128)
+            {
+                count -= 128;
+                std::memset(out + x, data[pos++], count);
+            }
+            else
+            {
+                std::memcpy(out + x, data + pos, count);
+                pos += count;
+            }
+            x += count;
+        }
+    }
+}
+
+// loads a .hdr file in the given pixel format. Returns an invalid image (and says why) if the file can't be
+// read or isn't in a supported layout.
+inline HdrImage loadHdrImage(const std::string &path, HdrPixelFormat format, bool flipVertically)
+{
+    HdrImage image;
+    MappedFile file(path);
+    const unsigned char *data = file.data();
+    size_t size = file.size(), pos = 0;
+    if (!data)
+    {
+        std::cout << "Failed to open HDR image " << path << std::endl;
+        return image;
+    }
+
+    std::string line;
+    readHdrLine(data, size, pos, line);
+    if (line != "#?RADIANCE" && line != "#?RGBE")
+    {
+        std::cout << "Not a Radiance HDR image: " << path << std::endl;
+        return image;
+    }
+    bool rgbe = false;
+    while (readHdrLine(data, size, pos, line) && !line.empty())
+        if (line == "FORMAT=32-bit_rle_rgbe")
+            rgbe = true;
+    int width = 0, height = 0;
+    char resolution[64] = { 0 };
+    if (readHdrLine(data, size, pos, line))
+        std::snprintf(resolution, sizeof(resolution), "%s", line.c_str());
+    if (!rgbe || std::sscanf(resolution, "-Y %d +X %d", &height, &width) != 2 || width <= 0 || height <= 0 ||
+        (size_t)width * height > (size_t)1 << 28)
+    {
+        std::cout << "Unsupported HDR image format: " << path << std::endl;
+        return image;
+    }
+
+    bool rle;
+    std::vector<size_t> offsets = indexHdrScanlines(data, size, pos, width, height, rle);
+    if (offsets.empty())
+    {
+        std::cout << "Corrupt HDR image data: " << path << std::endl;
+        return image;
+    }
+
+    image.width = width;
+    image.height = height;
+    image.format = format;
+    image.pixels.resize((size_t)width * height * hdrPixelBytes(format));
+    const int rowsPerTask = 8;
+    parallelFor((unsigned int)((height + rowsPerTask - 1) / rowsPerTask), [&](unsigned int task)
+    {
+        std::vector<unsigned char> planar((size_t)width * 4);
+        int rowEnd = std::min(height, (int)(task + 1) * rowsPerTask);
+        for (int y = task * rowsPerTask; y < rowEnd; ++y)
+        {
+            decodeHdrScanline(data, offsets[y], width, rle, planar.data());
+            unsigned char *out = (unsigned char *)image.row(flipVertically ? height - 1 - y : y);
+            if (format == HDR_PIXELS_RGB9E5)
+                rgbeRowToRGB9E5(planar.data(), width, (uint32_t *)out);
+            else if (format == HDR_PIXELS_HALF)
+                rgbeRowToHalf(planar.data(), width, (uint16_t *)out);
+            else
+                rgbeRowToFloat(planar.data(), width, (float *)out);
+        }
+    });
+    return image;
+}
+
+// specifies the bound GL_TEXTURE_2D from the image: RGB16F from halfs or floats, RGB9_E5 as packed texels
+inline void uploadHdrImage(const HdrImage &image)
+{
+    GLenum internalFormat = image.format == HDR_PIXELS_RGB9E5 ? GL_RGB9_E5 : GL_RGB16F;
+    GLenum type = image.format == HDR_PIXELS_RGB9E5 ? GL_UNSIGNED_INT_5_9_9_9_REV : image.format == HDR_PIXELS_HALF ? GL_HALF_FLOAT : GL_FLOAT;
+    // rows of half floats are only 2-byte aligned for odd widths
+    glPixelStorei(GL_UNPACK_ALIGNMENT, image.format == HDR_PIXELS_HALF ? 2 : 4);
+    glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, image.width, image.height, 0, GL_RGB, type, image.pixels.data());
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+}
+
+#endif
@@ -0,0 +1,213 @@
+#ifndef _IBL_OCTAHEDRAL_H_
+#define _IBL_OCTAHEDRAL_H_
+
+#pragma once
+
+// octahedral parameterization of the sphere (Engelhardt & Dachsbacher, "Octahedron Environment Maps"): the unit
+// octahedron is unfolded into a square with +Z in the centre and -Z in the four corners. Each of its eight
+// triangles maps linearly onto a face of the octahedron, so a map is baked by drawing those triangles into a 2D
+// texture (renderOctahedron and 2.2.2.octahedral.vs), one draw per mip. The lookups below match octahedralUV and
+// textureOctahedral in the 2.2.2.* shaders.
+
+#include <glm/glm.hpp>
+#include <learnopengl/parallel.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "ibl_cpu_bake.h"
+
+// an RGB float octahedral map with a mip chain, each level row-major with row 0 at v = 0.
+struct CpuOctahedralMap {
+    int size;
+    std::vector<std::vector<float> > levels;
+
+    int levelSize(int level) const { return std::max(size >> level, 1); }
+    size_t levelTexels(int level) const { return (size_t)levelSize(level) * levelSize(level); }
+    float *texel(int level, int x, int y)
+    {
+        return &levels[level][((size_t)y * levelSize(level) + x) * 3];
+    }
+    const float *texel(int level, int x, int y) const
+    {
+        return &levels[level][((size_t)y * levelSize(level) + x) * 3];
+    }
+};
+
+inline float signNotZero(float v)
+{
+    return v >= 0.0f ? 1.0f : -1.0f;
+}
+
+// [0, 1] map coordinates of a direction
+inline glm::vec2 octahedralUV(const glm::vec3 &dir)
+{
+    glm::vec3 d = dir / (std::fabs(dir.x) + std::fabs(dir.y) + std::fabs(dir.z));
+    glm::vec2 p(d.x, d.y);
+    if (d.z < 0.0f)
+        p = glm::vec2((1.0f - std::fabs(d.y)) * signNotZero(d.x), (1.0f - std::fabs(d.x)) * signNotZero(d.y));
+    return p * 0.5f + 0.5f;
+}
+
+// the unit direction at [0, 1] map coordinates
+inline glm::vec3 octahedralDirection(const glm::vec2 &uv)
+{
+    glm::vec2 p = uv * 2.0f - 1.0f;
+    glm::vec3 d(p.x, p.y, 1.0f - std::fabs(p.x) - std::fabs(p.y));
+    if (d.z < 0.0f)
+    {
+        float x = d.x;
+        d.x = (1.0f - std::fabs(d.y)) * signNotZero(x);
+        d.y = (1.0f - std::fabs(x)) * signNotZero(d.y);
+    }
+    return glm::normalize(d);
+}
+
+inline glm::vec3 octahedralTexelDirection(int x, int y, int size)
+{
+    return octahedralDirection(glm::vec2((x + 0.5f) / size, (y + 0.5f) / size));
+}
+
+// the map is mirrored across each edge, so a lookup stays half a texel (of the coarser mip it reads) inside the
+// border instead of letting the bilinear filter clamp into texels of the wrong side
+inline float octahedralBorder(int size, float lod)
+{
+    int level = (int)std::ceil(lod);
+    return level >= 31 ? 0.5f : std::min(0.5f * (float)(1u << level) / size, 0.5f);
+}
+
+// trilinear lookup, the CPU equivalent of textureOctahedral in the shaders.
+inline glm::vec3 sampleOctahedral(const CpuOctahedralMap &map, const glm::vec3 &dir, float lod)
+{
+    lod = std::min(std::max(lod, 0.0f), (float)(map.levels.size() - 1));
+    float border = octahedralBorder(map.size, lod);
+    glm::vec2 uv = glm::clamp(octahedralUV(dir), glm::vec2(border), glm::vec2(1.0f - border));
+    int l0 = (int)lod;
+    int l1 = std::min(l0 + 1, (int)map.levels.size() - 1);
+    float f = lod - l0;
+
+    glm::vec3 c0, c1;
+    int s0 = map.levelSize(l0);
+    sampleBilinear(map.levels[l0].data(), s0, s0, 3, uv.x, uv.y, &c0[0]);
+    if (f == 0.0f || l0 == l1)
+        return c0;
+    int s1 = map.levelSize(l1);
+    sampleBilinear(map.levels[l1].data(), s1, s1, 3, uv.x, uv.y, &c1[0]);
+    return c0 + (c1 - c0) * f;
+}
+
+inline glm::vec3 sampleEnvironment(const CpuOctahedralMap &map, const glm::vec3 &dir, float lod)
+{
+    return sampleOctahedral(map, dir, lod);
+}
+
+// a size x size octahedral map has size^2 texels over the sphere where a cubemap has 6 * faceSize^2
+inline float environmentResolution(const CpuOctahedralMap &map)
+{
+    return map.size / std::sqrt(6.0f);
+}
+
+// runs kernel(x, y) for every texel of a size x size level, in parallel over tiles.
+template <typename Kernel>
+void forEachOctahedralTexel(int size, const Kernel &kernel)
+{
+    int tiles = (size + IBL_CPU_TILE - 1) / IBL_CPU_TILE;
+    parallelFor(tiles * tiles, [&](unsigned int task)
+    {
+        int tx = task % tiles * IBL_CPU_TILE;
+        int ty = task / tiles * IBL_CPU_TILE;
+        for (int y = ty; y < std::min(ty + IBL_CPU_TILE, size); ++y)
+            for (int x = tx; x < std::min(tx + IBL_CPU_TILE, size); ++x)
+                kernel(x, y);
+    });
+}
+
+inline CpuOctahedralMap allocateOctahedralMap(int size, int levels)
+{
+    CpuOctahedralMap map;
+    map.size = size;
+    map.levels.resize(levels);
+    for (int level = 0; level < levels; ++level)
+        map.levels[level].assign(map.levelTexels(level) * 3, 0.0f);
+    return map;
+}
+
+// 2x2 box filter into every following level, like glGenerateMipmap on the GL_TEXTURE_2D.
+inline void generateOctahedralMips(CpuOctahedralMap &map, int fromLevel)
+{
+    for (int level = fromLevel + 1; level < (int)map.levels.size(); ++level)
+    {
+        int src = map.levelSize(level - 1);
+        forEachOctahedralTexel(map.levelSize(level), [&](int x, int y)
+        {
+            int x0 = std::min(2 * x, src - 1), x1 = std::min(2 * x + 1, src - 1);
+            int y0 = std::min(2 * y, src - 1), y1 = std::min(2 * y + 1, src - 1);
+            float *out = map.texel(level, x, y);
+            for (int c = 0; c < 3; ++c)
+                out[c] = 0.25f * (map.texel(level - 1, x0, y0)[c] + map.texel(level - 1, x1, y0)[c] +
+                                  map.texel(level - 1, x0, y1)[c] + map.texel(level - 1, x1, y1)[c]);
+        });
+    }
+}
+
+// ----------------------------------------------------------------------------
+// the bake products in the octahedral layout, see their cubemap versions in ibl_cpu_bake.h
+// ----------------------------------------------------------------------------
+
+inline CpuOctahedralMap bakeEnvironmentOctahedral(const CpuImage &equirect, int size, int levels)
+{
+    CpuOctahedralMap map = allocateOctahedralMap(size, levels);
+    forEachOctahedralTexel(size, [&](int x, int y)
+    {
+        glm::vec3 rgb = sampleEquirect(equirect, octahedralTexelDirection(x, y, size));
+        float *out = map.texel(0, x, y);
+        out[0] = rgb.r; out[1] = rgb.g; out[2] = rgb.b;
+    });
+    generateOctahedralMips(map, 0);
+    return map;
+}
+
+// the environment mip is log2(envSize / size) like in the cubemap bake, which the shader passes explicitly:
+// texture() would pick a huge mip where its derivatives cross a fold of the map
+inline CpuOctahedralMap bakeIrradianceOctahedral(const CpuOctahedralMap &env, int size)
+{
+    CpuOctahedralMap map = allocateOctahedralMap(size, 1);
+    IblSampleSoA samples(irradianceSamples(0.025f, std::log2((float)env.size / size)));
+    forEachOctahedralTexel(size, [&](int x, int y)
+    {
+        glm::vec3 irradiance = irradianceTexel(env, samples, octahedralTexelDirection(x, y, size));
+        float *out = map.texel(0, x, y);
+        out[0] = irradiance.r; out[1] = irradiance.g; out[2] = irradiance.b;
+    });
+    return map;
+}
+
+inline CpuOctahedralMap bakePrefilterOctahedral(const CpuOctahedralMap &env, int size, int levels, const std::vector<unsigned int> &sampleCounts)
+{
+    int bakedLevels = (int)sampleCounts.size();
+    CpuOctahedralMap map = allocateOctahedralMap(size, levels);
+    for (int mip = 0; mip < bakedLevels; ++mip)
+    {
+        if (sampleCounts[mip] == 0)
+        {
+            map.levels[mip] = env.levels[mipLevelOfSize(env, map.levelSize(mip))];
+            continue;
+        }
+        float roughness = (float)mip / (float)(bakedLevels - 1);
+        IblSampleSoA samples(prefilterSamples(roughness, sampleCounts[mip], environmentResolution(env)));
+        float totalWeight = sampleWeightSum(samples);
+
+        int mipSize = map.levelSize(mip);
+        forEachOctahedralTexel(mipSize, [&](int x, int y)
+        {
+            glm::vec3 color = prefilterTexel(env, samples, totalWeight, octahedralTexelDirection(x, y, mipSize));
+            float *out = map.texel(mip, x, y);
+            out[0] = color.r; out[1] = color.g; out[2] = color.b;
+        });
+    }
+    generateOctahedralMips(map, bakedLevels - 1);
+    return map;
+}
+
+#endif
@@ -0,0 +1,162 @@
+#ifndef _IBL_RGB9E5_H_
+#define _IBL_RGB9E5_H_
+
+#pragma once
+
+// shared-exponent RGB (GL_RGB9_E5): three 9-bit mantissas and one 5-bit exponent in 32 bits, as laid out by
+// GL_UNSIGNED_INT_5_9_9_9_REV. It's filterable and samples as plain RGB, so the shaders don't change, and
+// takes 4 bytes per texel against 6 (often padded to 8) for GL_RGB16F. Encoding follows
+// EXT_texture_shared_exponent; the SSE2 encoder (where the target has SSE2) gives the same bits as the scalar one.
+
+#include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
+#include <learnopengl/parallel.h>
+#include <learnopengl/simd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "ibl_cache.h"
+
+const int RGB9E5_MANTISSA_BITS = 9;
+const int RGB9E5_EXPONENT_BIAS = 15;
+const float RGB9E5_MAX = 65408.0f; // (2^9 - 1) / 2^9 * 2^16
+
+inline uint32_t encodeRGB9E5(float r, float g, float b)
+{
+    // max() drops NaNs
+    float rc = std::min(std::max(r, 0.0f), RGB9E5_MAX);
+    float gc = std::min(std::max(g, 0.0f), RGB9E5_MAX);
+    float bc = std::min(std::max(b, 0.0f), RGB9E5_MAX);
+    float maxc = std::max(rc, std::max(gc, bc));
+
+    // floor(log2(maxc)) straight from the float exponent, clamped to the smallest shared exponent
+    uint32_t bits;
+    std::memcpy(&bits, &maxc, 4);
+    int exponent = std::max(-RGB9E5_EXPONENT_BIAS - 1, (int)((bits >> 23) & 0xff) - 127) + 1 + RGB9E5_EXPONENT_BIAS;
+    float scale = std::ldexp(1.0f, RGB9E5_EXPONENT_BIAS + RGB9E5_MANTISSA_BITS - exponent);
+    if ((int)(maxc * scale + 0.5f) == 1 << RGB9E5_MANTISSA_BITS)
+    {
+        ++exponent;
+        scale *= 0.5f;
+    }
+    uint32_t rs = (uint32_t)(rc * scale + 0.5f), gs = (uint32_t)(gc * scale + 0.5f), bs = (uint32_t)(bc * scale + 0.5f);
+    return rs | (gs << 9) | (bs << 18) | ((uint32_t)exponent << 27);
+}
+
+inline glm::vec3 decodeRGB9E5(uint32_t texel)
+{
+    float scale = std::ldexp(1.0f, (int)(texel >> 27) - RGB9E5_EXPONENT_BIAS - RGB9E5_MANTISSA_BITS);
+    return glm::vec3((float)(texel & 0x1ff), (float)((texel >> 9) & 0x1ff), (float)((texel >> 18) & 0x1ff)) * scale;
+}
+
+#ifdef SIMD_SSE2
+// 2^e for integer exponents in the normal float range, built from the exponent bits
+inline __m128 exp2i(__m128i e)
+{
+    return _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(e, _mm_set1_epi32(127)), 23));
+}
+#endif
+
+// encodes count interleaved RGB floats, four texels at a time with SSE2
+inline void encodeRGB9E5(const float *rgb, size_t count, uint32_t *out)
+{
+    size_t i = 0;
+#ifdef SIMD_SSE2
+    const __m128 zero = _mm_setzero_ps(), maxValue = _mm_set1_ps(RGB9E5_MAX), half = _mm_set1_ps(0.5f);
+    const __m128i minExponent = _mm_set1_epi32(-RGB9E5_EXPONENT_BIAS - 1), exponentOffset = _mm_set1_epi32(1 + RGB9E5_EXPONENT_BIAS);
+    const __m128i scaleOffset = _mm_set1_epi32(RGB9E5_EXPONENT_BIAS + RGB9E5_MANTISSA_BITS), overflow = _mm_set1_epi32(1 << RGB9E5_MANTISSA_BITS);
+    for (; i + 4 <= count; i += 4)
+    {
+        const float *p = rgb + i * 3;
+        __m128 r = _mm_min_ps(_mm_max_ps(_mm_setr_ps(p[0], p[3], p[6], p[9]), zero), maxValue);
+        __m128 g = _mm_min_ps(_mm_max_ps(_mm_setr_ps(p[1], p[4], p[7], p[10]), zero), maxValue);
+        __m128 b = _mm_min_ps(_mm_max_ps(_mm_setr_ps(p[2], p[5], p[8], p[11]), zero), maxValue);
+        __m128 maxc = _mm_max_ps(r, _mm_max_ps(g, b));
+
+        __m128i floorLog2 = _mm_sub_epi32(_mm_srli_epi32(_mm_castps_si128(maxc), 23), _mm_set1_epi32(127));
+        __m128i belowMin = _mm_cmplt_epi32(floorLog2, minExponent);
+        floorLog2 = _mm_or_si128(_mm_and_si128(belowMin, minExponent), _mm_andnot_si128(belowMin, floorLog2));
+        __m128i exponent = _mm_add_epi32(floorLog2, exponentOffset);
+        __m128 scale = exp2i(_mm_sub_epi32(scaleOffset, exponent));
+
+        // rounding maxc up to 2^9 needs the next exponent
+        __m128i maxs = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(maxc, scale), half));
+        __m128i bump = _mm_cmpeq_epi32(maxs, overflow);
+        exponent = _mm_sub_epi32(exponent, bump);
+        scale = _mm_or_ps(_mm_and_ps(_mm_castsi128_ps(bump), _mm_mul_ps(scale, half)), _mm_andnot_ps(_mm_castsi128_ps(bump), scale));
+
+        __m128i rs = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(r, scale), half));
+        __m128i gs = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(g, scale), half));
+        __m128i bs = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(b, scale), half));
+        __m128i packed = _mm_or_si128(_mm_or_si128(rs, _mm_slli_epi32(gs, 9)), _mm_or_si128(_mm_slli_epi32(bs, 18), _mm_slli_epi32(exponent, 27)));
+        _mm_storeu_si128((__m128i *)(out + i), packed);
+    }
+#endif
+    for (; i < count; ++i)
+        out[i] = encodeRGB9E5(rgb[i * 3 + 0], rgb[i * 3 + 1], rgb[i * 3 + 2]);
+}
+
+// converts an RGB half-float cache image (as read back from a GL_RGB16F texture) to GL_RGB9_E5, in parallel
+// blocks of texels. The packed texels take the place of two half floats each.
+inline IblCacheImage encodeRGB9E5Image(const IblCacheImage &image)
+{
+    IblCacheImage encoded;
+    encoded.target = image.target;
+    encoded.internalFormat = GL_RGB9_E5;
+    encoded.format = GL_RGB;
+    encoded.levels.resize(image.levels.size());
+    for (unsigned int level = 0; level < image.levels.size(); ++level)
+    {
+        const IblCacheLevel &source = image.levels[level];
+        IblCacheLevel &target = encoded.levels[level];
+        target.width = source.width;
+        target.height = source.height;
+        size_t texels = source.pixels.size() / 3;
+        target.pixels.resize(texels * 2);
+        uint32_t *packed = (uint32_t *)target.pixels.data();
+
+        const size_t blockTexels = 4096;
+        parallelFor((unsigned int)((texels + blockTexels - 1) / blockTexels), [&](unsigned int block)
+        {
+            size_t begin = block * blockTexels, end = std::min(texels, begin + blockTexels);
+            float rgb[blockTexels * 3];
+            for (size_t i = begin * 3; i < end * 3; ++i)
+                rgb[i - begin * 3] = glm::unpackHalf1x16(source.pixels[i]);
+            encodeRGB9E5(rgb, end - begin, packed + begin);
+        });
+    }
+    return encoded;
+}
+
+// the RGB floats of one level of a cache image in either storage
+inline std::vector<float> cacheLevelRGB(const IblCacheImage &image, unsigned int level)
+{
+    const IblCacheLevel &l = image.levels[level];
+    std::vector<float> rgb;
+    if (image.internalFormat == GL_RGB9_E5)
+    {
+        const uint32_t *packed = (const uint32_t *)l.pixels.data();
+        size_t texels = l.pixels.size() / 2;
+        rgb.resize(texels * 3);
+        for (size_t i = 0; i < texels; ++i)
+        {
+            glm::vec3 c = decodeRGB9E5(packed[i]);
+            rgb[i * 3 + 0] = c.r;
+            rgb[i * 3 + 1] = c.g;
+            rgb[i * 3 + 2] = c.b;
+        }
+    }
+    else
+    {
+        rgb.resize(l.pixels.size());
+        for (size_t i = 0; i < rgb.size(); ++i)
+            rgb[i] = glm::unpackHalf1x16(l.pixels[i]);
+    }
+    return rgb;
+}
+
+#endif
@@ -0,0 +1,138 @@
+#ifndef _IBL_SETTINGS_H_
+#define _IBL_SETTINGS_H_
+
+#pragma once
+
+#include "ibl_cache.h"
+
+#include <cmath>
+
+// ibl bake settings, shared by the demo and the offline baker so both agree on the cache key.
+const char * const HDR_PATH = "resources/textures/hdr/newport_loft.hdr";
+// environments the demo can switch between (keys 1-9); each one is baked into its own cache next to the HDR file
+const char * const IBL_ENVIRONMENTS[] = { HDR_PATH };
+// GPU memory the baked environment/irradiance/pre-filter sets may keep resident; the least recently used
+// sets beyond it are dropped and reloaded from their cache (or re-baked) when they're selected again.
+const size_t IBL_ENVIRONMENT_BUDGET_BYTES = 48u << 20;
+// the runtime BRDF LUT doesn't depend on the environment, so it's cached on its own
+const char * const BRDF_LUT_CACHE_PATH = "resources/textures/brdf_lut.iblcache";
+const unsigned int ENV_CUBEMAP_SIZE = 512;
+const unsigned int IRRADIANCE_SIZE = 32;
+const unsigned int PREFILTER_SIZE = 128;
+const unsigned int PREFILTER_MIP_LEVELS = 5;
+// the prefilter sample count is chosen per mip (see choosePrefilterBudget in ibl_cpu_bake.h): the smallest
+// power of two in [PREFILTER_MIN_SAMPLES, PREFILTER_SAMPLE_COUNT] that meets PREFILTER_TARGET_ERROR.
+const unsigned int PREFILTER_SAMPLE_COUNT = 1024;
+const unsigned int PREFILTER_MIN_SAMPLES = 32;
+const float PREFILTER_TARGET_ERROR = 0.01f;       // relative RMS against a 4x sample reference
+const unsigned int PREFILTER_MAX_SAMPLES = 1024;  // size of samples[] in 2.2.2.prefilter.fs
+const unsigned int BRDF_LUT_SIZE = 512;
+const unsigned int BRDF_SAMPLE_COUNT = 1024;      // keep in sync with SAMPLE_COUNT in 2.2.2.brdf.fs
+// diffuse IBL from 9 spherical-harmonics coefficients instead of the convolved irradiance cubemap
+const bool USE_SH_IRRADIANCE = true;
+// where the split-sum BRDF term comes from: the 2.2.2.brdf.fs pass, the precomputed table in
+// brdf_lut_table.h (regenerate it with IBL_bake --brdf-table), or the analytic fit in 2.2.2.pbr.fs
+enum BrdfLutMode { BRDF_LUT_RUNTIME, BRDF_LUT_EMBEDDED, BRDF_LUT_ANALYTIC };
+const BrdfLutMode BRDF_LUT_MODE = BRDF_LUT_EMBEDDED;
+// storage of the baked cubemaps and of the equirect image a bake samples: GL_RGB9_E5 shared exponent (4 bytes
+// per texel) or GL_RGB16F (6, often padded to 8). The bake still renders RGB16F, which unlike RGB9_E5 is
+// color-renderable, and the result is encoded on the CPU (ibl_rgb9e5.h) before it's uploaded and cached.
+enum IblStorage { IBL_STORAGE_RGB16F, IBL_STORAGE_RGB9E5 };
+const IblStorage IBL_STORAGE = IBL_STORAGE_RGB9E5;
+// layout of the baked maps: six-face cubemaps, or octahedral 2D maps (ibl_octahedral.h) of twice the face size
+// per side (2/3 of the texels) that bake with one draw per mip and are sampled through textureOctahedral in
+// the shaders. IBL_bake --layout-benchmark compares the two.
+enum IblLayout { IBL_LAYOUT_CUBEMAP, IBL_LAYOUT_OCTAHEDRAL };
+const IblLayout IBL_LAYOUT = IBL_LAYOUT_CUBEMAP;
+// capture all six cubemap faces in one layered draw (2.2.2.cubemap_layered.gs) instead of one draw per face
+const bool USE_LAYERED_CAPTURE = true;
+// how the bake writes the maps and the BRDF LUT: rasterized into a framebuffer, or with compute shaders and
+// image stores (ibl_compute_bake.h), which needs a GL 4.3 context and falls back to raster without one.
+// IBL_BAKE_COMPARE_PATHS runs every pass both ways (the compute result is kept) and prints the GPU time of
+// each, to pick the faster path for a device.
+enum IblBakePath { IBL_BAKE_RASTER, IBL_BAKE_COMPUTE };
+const IblBakePath IBL_BAKE_PATH = IBL_BAKE_RASTER;
+const bool IBL_BAKE_COMPARE_PATHS = false;
+// progressive bake: start rendering right away with a placeholder environment and run the bake in slices of
+// about IBL_BAKE_SLICE_SAMPLES texture fetches between frames, at most IBL_BAKE_FRAME_SLICES of them and
+// IBL_BAKE_FRAME_BUDGET_MS of CPU time per frame.
+const bool USE_PROGRESSIVE_BAKE = true;
+const unsigned int IBL_BAKE_FRAME_SLICES = 2;
+const double IBL_BAKE_FRAME_BUDGET_MS = 4.0;
+const unsigned long long IBL_BAKE_SLICE_SAMPLES = 1ull << 22;
+
+inline GLenum iblStorageFormat()
+{
+    return IBL_STORAGE == IBL_STORAGE_RGB9E5 ? GL_RGB9_E5 : GL_RGB16F;
+}
+
+inline GLenum iblMapTarget()
+{
+    return IBL_LAYOUT == IBL_LAYOUT_OCTAHEDRAL ? GL_TEXTURE_2D : GL_TEXTURE_CUBE_MAP;
+}
+
+inline unsigned int octahedralMapSize(unsigned int faceSize)
+{
+    return 2 * faceSize;
+}
+
+// side of a baked map in the current layout, given the cubemap face size of the settings above
+inline unsigned int iblMapSize(unsigned int faceSize)
+{
+    return IBL_LAYOUT == IBL_LAYOUT_OCTAHEDRAL ? octahedralMapSize(faceSize) : faceSize;
+}
+
+// face size of a cubemap with the environment's solid angle per texel, which the prefilter sample mips are
+// computed for (environmentResolution in ibl_cpu_bake.h and ibl_octahedral.h)
+inline float iblEnvironmentResolution()
+{
+    return IBL_LAYOUT == IBL_LAYOUT_OCTAHEDRAL ? octahedralMapSize(ENV_CUBEMAP_SIZE) / std::sqrt(6.0f) : (float)ENV_CUBEMAP_SIZE;
+}
+
+// number of levels in a full mip chain for a square texture of the given size
+inline int mipLevelCount(unsigned int size)
+{
+    int levels = 1;
+    while (size > 1)
+    {
+        size /= 2;
+        ++levels;
+    }
+    return levels;
+}
+
+inline std::string iblCachePath(const std::string &hdrPath)
+{
+    return hdrPath + ".iblcache";
+}
+
+// cache key of the baked maps for the given environment.
+inline uint64_t iblBakeKey(const std::string &hdrPath)
+{
+    return iblCacheKey(hdrPath,
+        { "src/2.2.2.cubemap.vs", "src/2.2.2.cubemap_layered.vs", "src/2.2.2.cubemap_layered.gs", "src/2.2.2.octahedral.vs", "src/2.2.2.equirectangular_to_cubemap.fs",
+          "src/2.2.2.irradiance_convolution.fs", "src/2.2.2.prefilter.fs", "src/2.2.2.equirectangular_to_cubemap.cs",
+          "src/2.2.2.irradiance_convolution.cs", "src/2.2.2.prefilter.cs" },
+        { ENV_CUBEMAP_SIZE, IRRADIANCE_SIZE, PREFILTER_SIZE, PREFILTER_MIP_LEVELS, PREFILTER_SAMPLE_COUNT,
+          PREFILTER_MIN_SAMPLES, (unsigned int)(PREFILTER_TARGET_ERROR * 1e6f), USE_SH_IRRADIANCE ? 1u : 0u, (unsigned int)IBL_STORAGE,
+          (unsigned int)IBL_LAYOUT, (unsigned int)IBL_BAKE_PATH });
+}
+
+// cache key of the runtime BRDF LUT (BRDF_LUT_RUNTIME mode).
+inline uint64_t brdfLutKey()
+{
+    Fnv1a64 hash;
+    hash.updateValue(IBL_CACHE_VERSION);
+    const char * const shaders[] = { "src/2.2.2.brdf.vs", "src/2.2.2.brdf.fs", "src/2.2.2.brdf.cs" };
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        hash.updateString(shaders[i]);
+        hash.updateFile(shaders[i]);
+    }
+    hash.updateValue(BRDF_LUT_SIZE);
+    hash.updateValue(BRDF_SAMPLE_COUNT);
+    hash.updateValue(IBL_BAKE_PATH);
+    return hash.value;
+}
+
+#endif
@@ -0,0 +1,143 @@
+#ifndef _IBL_SH_H_
+#define _IBL_SH_H_
+
+#pragma once
+
+// L2 spherical-harmonics irradiance. The environment is projected into 9 RGB coefficients and convolved
+// with the clamped cosine lobe, so 2.2.2.pbr.fs can evaluate the diffuse term with a handful of
+// multiply-adds instead of sampling a convolved irradiance cubemap.
+
+#include <glm/glm.hpp>
+#include <learnopengl/binary_cache.h>
+#include <learnopengl/parallel.h>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+const uint32_t SH_CACHE_VERSION = 1;
+const char SH_CACHE_MAGIC[4] = { 'I', 'B', 'S', 'H' };
+
+struct ShCoefficients {
+    glm::vec3 c[9];
+};
+
+// the 9 real SH basis functions for a unit direction
+inline void shBasis(const glm::vec3 &n, float *y)
+{
+    y[0] = 0.282095f;
+    y[1] = 0.488603f * n.y;
+    y[2] = 0.488603f * n.z;
+    y[3] = 0.488603f * n.x;
+    y[4] = 1.092548f * n.x * n.y;
+    y[5] = 1.092548f * n.y * n.z;
+    y[6] = 0.315392f * (3.0f * n.z * n.z - 1.0f);
+    y[7] = 1.092548f * n.x * n.z;
+    y[8] = 0.546274f * (n.x * n.x - n.y * n.y);
+}
+
+// projects an equirectangular RGB image (as laid out for the GL upload, see SampleSphericalMap in
+// 2.2.2.equirectangular_to_cubemap.fs) into radiance SH. readRow(row, rgb) writes the width RGB floats of a
+// row, so packed images are unpacked one row at a time. Rows are reduced in parallel into per-block
+// partial sums, which are then added in a fixed order so the result doesn't depend on the thread count.
+template <typename RowReader>
+ShCoefficients projectEquirectToSH(int width, int height, const RowReader &readRow)
+{
+    const double PI = 3.14159265358979323846;
+    const unsigned int blocks = 64;
+    std::vector<double> partial(blocks * 27, 0.0);
+    parallelFor(blocks, [&](unsigned int block)
+    {
+        double *sum = &partial[block * 27];
+        std::vector<float> pixels((size_t)width * 3);
+        int rowBegin = height * block / blocks;
+        int rowEnd = height * (block + 1) / blocks;
+        for (int row = rowBegin; row < rowEnd; ++row)
+        {
+            readRow(row, pixels.data());
+            double lat = ((row + 0.5) / height - 0.5) * PI;
+            // solid angle of one texel of this row
+            double dOmega = (2.0 * PI / width) * (PI / height) * std::cos(lat);
+            for (int x = 0; x < width; ++x)
+            {
+                double phi = ((x + 0.5) / width - 0.5) * 2.0 * PI;
+                glm::vec3 dir((float)(std::cos(lat) * std::cos(phi)), (float)std::sin(lat), (float)(std::cos(lat) * std::sin(phi)));
+                float y[9];
+                shBasis(dir, y);
+                const float *rgb = &pixels[(size_t)x * 3];
+                for (int i = 0; i < 9; ++i)
+                {
+                    double w = y[i] * dOmega;
+                    sum[i * 3 + 0] += rgb[0] * w;
+                    sum[i * 3 + 1] += rgb[1] * w;
+                    sum[i * 3 + 2] += rgb[2] * w;
+                }
+            }
+        }
+    });
+
+    double total[27] = { 0.0 };
+    for (unsigned int block = 0; block < blocks; ++block)
+        for (int i = 0; i < 27; ++i)
+            total[i] += partial[block * 27 + i];
+
+    ShCoefficients sh;
+    for (int i = 0; i < 9; ++i)
+        sh.c[i] = glm::vec3((float)total[i * 3 + 0], (float)total[i * 3 + 1], (float)total[i * 3 + 2]);
+    return sh;
+}
+
+inline ShCoefficients projectEquirectToSH(const float *pixels, int width, int height)
+{
+    return projectEquirectToSH(width, height, [&](int row, float *rgb)
+    {
+        std::copy(pixels + (size_t)row * width * 3, pixels + (size_t)(row + 1) * width * 3, rgb);
+    });
+}
+
+// turns radiance SH into coefficients whose evaluation gives irradiance / PI, which is what the irradiance
+// cubemap stores (so diffuse = irradiance * albedo keeps working). Cosine lobe bands: PI, 2PI/3, PI/4.
+inline ShCoefficients shRadianceToIrradiance(const ShCoefficients &radiance)
+{
+    const float band[3] = { 1.0f, 2.0f / 3.0f, 0.25f };
+    ShCoefficients irradiance;
+    for (int i = 0; i < 9; ++i)
+        irradiance.c[i] = radiance.c[i] * band[i == 0 ? 0 : (i < 4 ? 1 : 2)];
+    return irradiance;
+}
+
+// the same evaluation 2.2.2.pbr.fs does
+inline glm::vec3 evaluateSH(const ShCoefficients &sh, const glm::vec3 &n)
+{
+    float y[9];
+    shBasis(n, y);
+    glm::vec3 result(0.0f);
+    for (int i = 0; i < 9; ++i)
+        result += sh.c[i] * y[i];
+    return glm::max(result, glm::vec3(0.0f));
+}
+
+// the coefficients live next to the IBL cache and share its key
+inline std::string shCachePath(const std::string &iblCachePath)
+{
+    return iblCachePath + ".sh";
+}
+
+inline bool saveShCache(const std::string &path, uint64_t key, const ShCoefficients &sh)
+{
+    BinaryWriter writer(path);
+    writeCacheHeader(writer, SH_CACHE_MAGIC, SH_CACHE_VERSION, key);
+    writer.write(&sh.c[0][0], sizeof(float) * 27);
+    return writer.good();
+}
+
+inline bool loadShCache(const std::string &path, uint64_t key, ShCoefficients &sh)
+{
+    BinaryReader reader(path);
+    if (!reader.good() || !readCacheHeader(reader, SH_CACHE_MAGIC, SH_CACHE_VERSION, key))
+        return false;
+    return reader.read(&sh.c[0][0], sizeof(float) * 27);
+}
+
+#endif
@@ -8,14 +8,28 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
+#include <glm/gtc/packing.hpp>
 
 #include <learnopengl/filesystem.h>
 #include <learnopengl/shader.h>
 #include <learnopengl/camera.h>
 #include <learnopengl/model.h>
+#include <learnopengl/asset_pipeline.h>
+#include <learnopengl/index_buffer.h>
 
 #include <iostream>
+#include <future>
+#include <memory>
 #include "object_rot.h"
+#include "ibl_cache.h"
+#include "ibl_settings.h"
+#include "ibl_sh.h"
+#include "ibl_cpu_bake.h"
+#include "ibl_octahedral.h"
+#include "brdf_lut_table.h"
+#include "ibl_bake_queue.h"
+#include "ibl_compute_bake.h"
+#include "ibl_environment_cache.h"
 
 #pragma comment(lib, "opengl32.lib")
 #pragma comment(lib, "glew32.lib")
@@ -25,11 +39,22 @@
 void framebuffer_size_callback(GLFWwindow* window, int width, int height);
 void mouse_callback(GLFWwindow* window, double xpos, double ypos);
 void scroll_callback(GLFWwindow* window, double xoffset, double yoffset);
+void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods);
 void processInput(GLFWwindow *window);
-unsigned int loadTexture(const char *path);
 void renderSphere();
 void renderCube();
 void renderQuad();
+void renderOctahedron();
+Shader captureShader(const char *fragmentPath, const glm::mat4 &projection, const glm::mat4 *views);
+void captureCubemap(Shader &shader, unsigned int captureFBO, unsigned int cubemap, unsigned int mip, unsigned int size,
+                    unsigned int rowBegin, unsigned int rowEnd, const glm::mat4 *views);
+void captureOctahedral(Shader &shader, unsigned int captureFBO, unsigned int map, unsigned int mip, unsigned int size,
+                       unsigned int rowBegin, unsigned int rowEnd);
+void copyMapLevel(unsigned int src, unsigned int srcLevel, unsigned int dst, unsigned int dstLevel, unsigned int size);
+template <typename Map> Map toCpuMap(const IblCacheImage &image);
+ShCoefficients placeholderSH();
+unsigned int createPlaceholderMap(const ShCoefficients &sh);
+void fillPlaceholderMap(unsigned int map, const ShCoefficients &sh);
 
 // settings
 const unsigned int SCR_WIDTH = 1280;
@@ -41,6 +66,7 @@ float lastX = 800.0f / 2.0;
 float lastY = 600.0 / 2.0;
 bool firstMouse = true;
 ObjectRot objRotate;
+int requestedEnvironment = -1; // set by the number keys, picked up by the render loop
 
 // timing
 float deltaTime = 0.0f;
@@ -51,7 +77,9 @@ int main()
     // glfw: initialize and configure
     // ------------------------------
     glfwInit();
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    // the compute bake path needs GL 4.3; without it the context is 3.3 and the bake rasterizes
+    bool wantComputeBake = IBL_BAKE_PATH == IBL_BAKE_COMPUTE || IBL_BAKE_COMPARE_PATHS;
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, wantComputeBake ? 4 : 3);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
     glfwWindowHint(GLFW_SAMPLES, 4);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
@@ -63,6 +91,11 @@ int main()
     // glfw window creation
     // --------------------
     GLFWwindow* window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "LearnOpenGL", NULL, NULL);
+    if (window == NULL && wantComputeBake)
+    {
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "LearnOpenGL", NULL, NULL);
+    }
     glfwMakeContextCurrent(window);
     if (window == NULL)
     {
@@ -73,6 +106,7 @@ int main()
     glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
     glfwSetCursorPosCallback(window, mouse_callback);
     glfwSetScrollCallback(window, scroll_callback);
+    glfwSetKeyCallback(window, key_callback);
 
     // tell GLFW to capture our mouse
     glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
@@ -81,6 +115,13 @@ int main()
     // ---------------------------------------
 	glewInit();
 
+    // which paths the IBL bake runs: compute when it was asked for and the context has GL 4.3, raster otherwise
+    // (or as well, to compare the two)
+    bool computeBake = wantComputeBake && iblComputeSupported();
+    bool rasterBake = !computeBake || IBL_BAKE_COMPARE_PATHS;
+    if (wantComputeBake && !computeBake)
+        std::cout << "No GL 4.3 context, the IBL bake falls back to the raster path" << std::endl;
+
     // configure global opengl state
     // -----------------------------
     glEnable(GL_DEPTH_TEST);
@@ -89,51 +130,73 @@ int main()
     // enable seamless cubemap sampling for lower mip levels in the pre-filter map.
     glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
 
+    // queue every startup asset: worker threads read and decode the files and import the model while this
+    // thread sets up the IBL resources below; each shader compile and upload runs as soon as its input is ready.
+    // textures come from the shared texture cache, which flips each image as it decodes it.
+    // ---------------------------------------------------------------------------------------------------------
+    AssetPipeline assets;
+
     // build and compile shaders
     // -------------------------
-    Shader pbrShader("src/2.2.2.pbr.vs", "src/2.2.2.pbr.fs");
-    Shader equirectangularToCubemapShader("src/2.2.2.cubemap.vs", "src/2.2.2.equirectangular_to_cubemap.fs");
-    Shader irradianceShader("src/2.2.2.cubemap.vs", "src/2.2.2.irradiance_convolution.fs");
-    Shader prefilterShader("src/2.2.2.cubemap.vs", "src/2.2.2.prefilter.fs");
-    Shader brdfShader("src/2.2.2.brdf.vs", "src/2.2.2.brdf.fs");
-    Shader backgroundShader("src/2.2.2.background.vs", "src/2.2.2.background.fs");
-
-
-    pbrShader.use();
-    pbrShader.setInt("irradianceMap", 0);
-    pbrShader.setInt("prefilterMap", 1);
-    pbrShader.setInt("brdfLUT", 2);
-    pbrShader.setInt("albedoMap", 3);
-    pbrShader.setInt("normalMap", 4);
-    pbrShader.setInt("metallicMap", 5);
-    pbrShader.setInt("roughnessMap", 6);
-    pbrShader.setInt("aoMap", 7);
-
-    backgroundShader.use();
-    backgroundShader.setInt("environmentMap", 0);
-    stbi_set_flip_vertically_on_load(true);
-
-
-    // load PBR material textures
-    unsigned int modelAlbedoMap = loadTexture("resources/backpack/albedo.jpg");
-    unsigned int modelNormalMap = loadTexture("resources/backpack//normal.png");
-    unsigned int modelMetallicMap = loadTexture("resources/backpack/metallic.jpg");
-    unsigned int modelRoughnessMap = loadTexture("resources/backpack/roughness.jpg");
-    unsigned int modelAOMap = loadTexture("resources/backpack/ao.jpg");
+    Shader pbrShader;
+    Shader backgroundShader;
+    assets.add([]() { return readShaderSources("src/2.2.2.pbr.vs", "src/2.2.2.pbr.fs"); }, [&](const ShaderSources &sources)
+    {
+        pbrShader = Shader(sources);
+        pbrShader.use();
+        pbrShader.setInt("irradianceMap", 0);
+        pbrShader.setInt("prefilterMap", 1);
+        pbrShader.setInt("brdfLUT", 2);
+        pbrShader.setInt("albedoMap", 3);
+        pbrShader.setInt("normalMap", 4);
+        pbrShader.setInt("metallicMap", 5);
+        pbrShader.setInt("roughnessMap", 6);
+        pbrShader.setInt("aoMap", 7);
+        pbrShader.setInt("irradianceOctahedral", 8);
+        pbrShader.setInt("prefilterOctahedral", 9);
+    });
+    assets.add([]() { return readShaderSources("src/2.2.2.background.vs", "src/2.2.2.background.fs"); }, [&](const ShaderSources &sources)
+    {
+        backgroundShader = Shader(sources);
+        backgroundShader.use();
+        backgroundShader.setInt("environmentMap", 0);
+        backgroundShader.setInt("environmentOctahedral", 1);
+    });
+
+    // load PBR material textures; the albedo and normal maps are told apart so their mips are filtered right
+    unsigned int modelAlbedoMap = 0, modelNormalMap = 0, modelMetallicMap = 0, modelRoughnessMap = 0, modelAOMap = 0;
+    assets.addTexture("resources/backpack/albedo.jpg", modelAlbedoMap, TextureParams(TEXTURE_CONTENT_COLOR));
+    assets.addTexture("resources/backpack//normal.png", modelNormalMap, TextureParams(TEXTURE_CONTENT_NORMAL));
+    assets.addTexture("resources/backpack/metallic.jpg", modelMetallicMap);
+    assets.addTexture("resources/backpack/roughness.jpg", modelRoughnessMap);
+    assets.addTexture("resources/backpack/ao.jpg", modelAOMap);
 
     // gold
-    unsigned int goldAlbedoMap = loadTexture("resources/textures/pbr/gold/albedo.png");
-    unsigned int goldNormalMap = loadTexture("resources/textures/pbr/gold/normal.png");
-    unsigned int goldMetallicMap = loadTexture("resources/textures/pbr/gold/metallic.png");
-    unsigned int goldRoughnessMap = loadTexture("resources/textures/pbr/gold/roughness.png");
-    unsigned int goldAOMap = loadTexture("resources/textures/pbr/gold/ao.png");
+    unsigned int goldAlbedoMap = 0, goldNormalMap = 0, goldMetallicMap = 0, goldRoughnessMap = 0, goldAOMap = 0;
+    assets.addTexture("resources/textures/pbr/gold/albedo.png", goldAlbedoMap, TextureParams(TEXTURE_CONTENT_COLOR));
+    assets.addTexture("resources/textures/pbr/gold/normal.png", goldNormalMap, TextureParams(TEXTURE_CONTENT_NORMAL));
+    assets.addTexture("resources/textures/pbr/gold/metallic.png", goldMetallicMap);
+    assets.addTexture("resources/textures/pbr/gold/roughness.png", goldRoughnessMap);
+    assets.addTexture("resources/textures/pbr/gold/ao.png", goldAOMap);
 
     // plastic
-    unsigned int plasticAlbedoMap = loadTexture("resources/textures/pbr/plastic/albedo.png");
-    unsigned int plasticNormalMap = loadTexture("resources/textures/pbr/plastic/normal.png");
-    unsigned int plasticMetallicMap = loadTexture("resources/textures/pbr/plastic/metallic.png");
-    unsigned int plasticRoughnessMap = loadTexture("resources/textures/pbr/plastic/roughness.png");
-    unsigned int plasticAOMap = loadTexture("resources/textures/pbr/plastic/ao.png");
+    unsigned int plasticAlbedoMap = 0, plasticNormalMap = 0, plasticMetallicMap = 0, plasticRoughnessMap = 0, plasticAOMap = 0;
+    assets.addTexture("resources/textures/pbr/plastic/albedo.png", plasticAlbedoMap, TextureParams(TEXTURE_CONTENT_COLOR));
+    assets.addTexture("resources/textures/pbr/plastic/normal.png", plasticNormalMap, TextureParams(TEXTURE_CONTENT_NORMAL));
+    assets.addTexture("resources/textures/pbr/plastic/metallic.png", plasticMetallicMap);
+    assets.addTexture("resources/textures/pbr/plastic/roughness.png", plasticRoughnessMap);
+    assets.addTexture("resources/textures/pbr/plastic/ao.png", plasticAOMap);
+
+    // the Assimp import and the model's own textures are decoded off this thread too; only the buffers and the
+    // texture names are made here, the pixels stream in
+    // every model of the scene shares one vertex and index buffer
+    std::shared_ptr<ModelArena> sceneGeometry = std::make_shared<ModelArena>();
+    std::shared_ptr<Model> ourModel;
+    assets.add([]() { return std::make_shared<Model>("resources/backpack/backpack.obj", false, true); }, [&](const std::shared_ptr<Model> &model)
+    {
+        model->Upload(sceneGeometry, &assets.textureStreamer());
+        ourModel = model;
+    });
 
     // lights
     // ------
@@ -150,56 +213,88 @@ int main()
         glm::vec3(300.0f, 300.0f, 300.0f)
     };
 
-    // pbr: setup framebuffer
-    // ----------------------
-    unsigned int captureFBO;
-    unsigned int captureRBO;
-    glGenFramebuffers(1, &captureFBO);
-    glGenRenderbuffers(1, &captureRBO);
-
-    glBindFramebuffer(GL_FRAMEBUFFER, captureFBO);
-    glBindRenderbuffer(GL_RENDERBUFFER, captureRBO);
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, 512, 512);
-    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, captureRBO);
-
-    // pbr: load the HDR environment map
-    // ---------------------------------
-    int width, height, nrComponents;
-    Model ourModel("resources/backpack/backpack.obj");
-    float *data = stbi_loadf("resources/textures/hdr/newport_loft.hdr", &width, &height, &nrComponents, 0);
-    unsigned int hdrTexture;
-    if (data)
+    // pbr: setup framebuffer (only the raster bake renders into one)
+    // ----------------------------------------------------------------
+    unsigned int captureFBO = 0;
+    unsigned int captureRBO = 0;
+    unsigned int mapCaptureFBO = 0;
+    if (rasterBake)
     {
-        glGenTextures(1, &hdrTexture);
-        glBindTexture(GL_TEXTURE_2D, hdrTexture);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB16F, width, height, 0, GL_RGB, GL_FLOAT, data); // note how we specify the texture's data value to be float
+        glGenFramebuffers(1, &captureFBO);
+        glGenRenderbuffers(1, &captureRBO);
 
+        glBindFramebuffer(GL_FRAMEBUFFER, captureFBO);
+        glBindRenderbuffer(GL_RENDERBUFFER, captureRBO);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, ENV_CUBEMAP_SIZE, ENV_CUBEMAP_SIZE);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, captureRBO);
+
+        // the layered and octahedral captures get their own framebuffer without the depth renderbuffer: every
+        // attachment of a layered framebuffer has to be layered, an octahedral map is larger than the renderbuffer,
+        // and neither the cube seen from the inside nor the unfolded octahedron overlaps itself anyway.
+        mapCaptureFBO = captureFBO;
+        if (USE_LAYERED_CAPTURE || IBL_LAYOUT == IBL_LAYOUT_OCTAHEDRAL)
+            glGenFramebuffers(1, &mapCaptureFBO);
+    }
+
+    // pbr: create the 2D LUT for the BRDF equations used (the analytic fit needs no texture).
+    // ----------------------------------------------------------------------------------------
+    unsigned int brdfLUTTexture = 0;
+    if (BRDF_LUT_MODE != BRDF_LUT_ANALYTIC)
+    {
+        glGenTextures(1, &brdfLUTTexture);
+        glBindTexture(GL_TEXTURE_2D, brdfLUTTexture);
+        if (BRDF_LUT_MODE == BRDF_LUT_EMBEDDED)
+        {
+            // the LUT doesn't depend on the scene, so it's compiled in instead of rendered
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RG16F, BRDF_LUT_TABLE_SIZE, BRDF_LUT_TABLE_SIZE, 0, GL_RG, GL_HALF_FLOAT, BRDF_LUT_TABLE);
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        }
+        else
+        {
+            // pre-allocate enough memory for the LUT texture.
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RG16F, BRDF_LUT_SIZE, BRDF_LUT_SIZE, 0, GL_RG, GL_FLOAT, 0);
+        }
+        // be sure to set wrapping mode to GL_CLAMP_TO_EDGE
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-        stbi_image_free(data);
     }
-    else
+
+    // pbr: the runtime BRDF LUT doesn't depend on the environment, so it has a cache of its own.
+    // -------------------------------------------------------------------------------------------
+    std::vector<IblCacheTexture> brdfTextures = { { brdfLUTTexture, GL_TEXTURE_2D, GL_RG16F, GL_RG, 1 } };
+    uint64_t brdfKey = brdfLutKey();
+    bool brdfCached = BRDF_LUT_MODE != BRDF_LUT_RUNTIME || loadIblCache(BRDF_LUT_CACHE_PATH, brdfKey, brdfTextures);
+
+    // everything the first frame needs
+    try
     {
-        std::cout << "Failed to load HDR image." << std::endl;
+        assets.finish();
     }
-
-    // pbr: setup cubemap to render to and attach to framebuffer
-    // ---------------------------------------------------------
-    unsigned int envCubemap;
-    glGenTextures(1, &envCubemap);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, envCubemap);
-    for (unsigned int i = 0; i < 6; ++i)
+    catch (const std::exception &e)
     {
-        glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB16F, 512, 512, 0, GL_RGB, GL_FLOAT, nullptr);
+        std::cout << "Failed to load assets: " << e.what() << std::endl;
+        glfwTerminate();
+        return -1;
     }
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR); // enable pre-filter mipmap sampling (combatting visible dots artifact)
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    // pbr: until a baked map is ready the scene is lit by a placeholder: a 1x1 cubemap (flat grey, then the
+    // SH irradiance once it's known) stands in for the environment, irradiance and pre-filter maps, and the
+    // analytic fit stands in for a BRDF LUT that still has to be rendered.
+    // -------------------------------------------------------------------------------------------------------
+    const ShCoefficients defaultSH = placeholderSH();
+    const ShCoefficients *appliedSH = nullptr; // the SH in the pbr shader's uniforms (and the placeholder)
+    unsigned int placeholderMap = createPlaceholderMap(defaultSH);
+    bool analyticBRDF = BRDF_LUT_MODE == BRDF_LUT_ANALYTIC || !brdfCached;
+
+    // pbr: everything that still has to be loaded or baked is queued as slices of bounded size. In progressive
+    // mode a few of them run between frames (IBL_BAKE_FRAME_SLICES, IBL_BAKE_FRAME_BUDGET_MS), otherwise the
+    // queue is drained here.
+    // ------------------------------------------------------------------------------------------------------------
+    IblBakeQueue iblBake;
+    IblPassTimings bakeTimings(IBL_BAKE_COMPARE_PATHS);
 
     // pbr: set up projection and view matrices for capturing data onto the 6 cubemap face directions
     // ----------------------------------------------------------------------------------------------
@@ -214,144 +309,429 @@ int main()
         glm::lookAt(glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3( 0.0f,  0.0f, -1.0f), glm::vec3(0.0f, -1.0f,  0.0f))
     };
 
-    // pbr: convert HDR equirectangular environment map to cubemap equivalent
-    // ----------------------------------------------------------------------
-    equirectangularToCubemapShader.use();
-    equirectangularToCubemapShader.setInt("equirectangularMap", 0);
-    equirectangularToCubemapShader.setMat4("projection", captureProjection);
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, hdrTexture);
-
-    glViewport(0, 0, 512, 512); // don't forget to configure the viewport to the capture dimensions.
-    glBindFramebuffer(GL_FRAMEBUFFER, captureFBO);
-    for (unsigned int i = 0; i < 6; ++i)
+    // queues one capture into a mip of a cubemap (or octahedral map) as bands of rows of about
+    // IBL_BAKE_SLICE_SAMPLES fetches each, rasterized and/or dispatched as compute (shader(true) is the compute
+    // program). setup() binds the program's inputs again for every band, since frames are rendered in between;
+    // when it returns false the band is skipped.
+    auto queueMapCapture = [&](const char *pass, std::function<Shader &(bool)> shader, std::function<bool(Shader &)> setup,
+                               unsigned int map, unsigned int mip, unsigned int size, unsigned int samplesPerTexel)
     {
-        equirectangularToCubemapShader.setMat4("view", captureViews[i]);
-        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, envCubemap, 0);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-
-        renderCube();
-    }
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-
-    // then let OpenGL generate mipmaps from first mip face (combatting visible dots artifact)
-    glBindTexture(GL_TEXTURE_CUBE_MAP, envCubemap);
-    glGenerateMipmap(GL_TEXTURE_CUBE_MAP);
+        unsigned long long rowSamples = (unsigned long long)iblCacheFaces(iblMapTarget()) * size * samplesPerTexel;
+        unsigned int bandRows = std::max(1u, (unsigned int)(IBL_BAKE_SLICE_SAMPLES / rowSamples));
+        for (unsigned int row = 0; row < size; row += bandRows)
+        {
+            unsigned int rowEnd = std::min(row + bandRows, size);
+            iblBake.add([=, &mapCaptureFBO, &captureViews, &bakeTimings]()
+            {
+                // with both paths the compute one runs last, so its result is the one kept
+                for (int compute = rasterBake ? 0 : 1; compute <= (computeBake ? 1 : 0); ++compute)
+                {
+                    Shader &program = shader(compute != 0);
+                    if (!setup(program))
+                        return true;
+                    bakeTimings.begin();
+                    if (compute)
+                        dispatchMapRows(program, map, mip, size, row, rowEnd);
+                    else if (IBL_LAYOUT == IBL_LAYOUT_OCTAHEDRAL)
+                        captureOctahedral(program, mapCaptureFBO, map, mip, size, row, rowEnd);
+                    else
+                        captureCubemap(program, mapCaptureFBO, map, mip, size, row, rowEnd, captureViews);
+                    bakeTimings.end(pass, compute != 0);
+                }
+                glBindFramebuffer(GL_FRAMEBUFFER, 0);
+                return true;
+            });
+        }
+    };
 
-    // pbr: create an irradiance cubemap, and re-scale capture FBO to irradiance scale.
-    // --------------------------------------------------------------------------------
-    unsigned int irradianceMap;
-    glGenTextures(1, &irradianceMap);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, irradianceMap);
-    for (unsigned int i = 0; i < 6; ++i)
-    {
-        glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB16F, 32, 32, 0, GL_RGB, GL_FLOAT, nullptr);
-    }
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    // the capture shaders are shared by every bake and compiled by the first one that needs them, the raster
+    // and/or the compute version
+    std::unique_ptr<Shader> equirectangularToCubemapShader, irradianceShader, prefilterShader, brdfShader;
+    std::unique_ptr<Shader> equirectangularToCubemapCompute, irradianceCompute, prefilterCompute, brdfCompute;
+
+    // the state of one environment's bake, kept alive by its slices
+    struct EnvironmentBake {
+        std::shared_ptr<IblEnvironmentSource> source;
+        unsigned int hdrTexture = 0;
+        IblTextureReadback environmentReadback;
+        std::vector<std::unique_ptr<IblTextureReadback> > storeReadbacks;
+        std::future<PrefilterBudget> prefilterBudgetTask;
+        PrefilterBudget prefilterBudget;
+        unsigned int prefilterSampleUBO = 0;
+        size_t sampleBlockStride = 0;
+        std::vector<int> sampleCounts = std::vector<int>(PREFILTER_MIP_LEVELS, 0);
+        std::vector<float> totalWeights = std::vector<float>(PREFILTER_MIP_LEVELS, 0.0f);
+        std::future<std::vector<IblCacheImage> > storedImages;
+        double startMs = 0.0;
+    };
+    const size_t sampleBlockSize = PREFILTER_MAX_SAMPLES * sizeof(glm::vec4);
 
-    glBindFramebuffer(GL_FRAMEBUFFER, captureFBO);
-    glBindRenderbuffer(GL_RENDERBUFFER, captureRBO);
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, 32, 32);
-
-    // pbr: solve diffuse integral by convolution to create an irradiance (cube)map.
-    // -----------------------------------------------------------------------------
-    irradianceShader.use();
-    irradianceShader.setInt("environmentMap", 0);
-    irradianceShader.setMat4("projection", captureProjection);
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, envCubemap);
-
-    glViewport(0, 0, 32, 32); // don't forget to configure the viewport to the capture dimensions.
-    glBindFramebuffer(GL_FRAMEBUFFER, captureFBO);
-    for (unsigned int i = 0; i < 6; ++i)
+    // queues the bake of whatever wasn't found in the environment's cache
+    auto bakeEnvironment = [&](IblEnvironment &environment, std::shared_ptr<IblEnvironmentSource> source)
     {
-        irradianceShader.setMat4("view", captureViews[i]);
-        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, irradianceMap, 0);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        IblEnvironment *env = &environment;
+        std::shared_ptr<EnvironmentBake> bake = std::make_shared<EnvironmentBake>();
+        bake->source = source;
+        std::function<bool(Shader &)> bindEnvironment = [env](Shader &)
+        {
+            // environmentOctahedral is on unit 1, next to the unused environmentMap cube sampler
+            glActiveTexture(IBL_LAYOUT == IBL_LAYOUT_OCTAHEDRAL ? GL_TEXTURE1 : GL_TEXTURE0);
+            glBindTexture(iblMapTarget(), env->envCubemap);
+            return true;
+        };
 
-        renderCube();
-    }
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        // pbr: project the environment into L2 spherical harmonics for the diffuse term.
+        // -------------------------------------------------------------------------------
+        if (!source->shCached)
+        {
+            iblBake.add([env, bake]()
+            {
+                const HdrImage &hdr = bake->source->hdr;
+                env->sh = shRadianceToIrradiance(projectEquirectToSH(hdr.width, hdr.height, [&](int row, float *rgb) { hdr.rowRGB(row, rgb); }));
+                env->shReady = true;
+                saveShCache(shCachePath(env->cachePath), bake->source->key, env->sh);
+                return true;
+            });
+        }
+        if (source->mapsCached)
+            return;
 
-    // pbr: create a pre-filter cubemap, and re-scale capture FBO to pre-filter scale.
-    // --------------------------------------------------------------------------------
-    unsigned int prefilterMap;
-    glGenTextures(1, &prefilterMap);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, prefilterMap);
-    for (unsigned int i = 0; i < 6; ++i)
-    {
-        glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB16F, 128, 128, 0, GL_RGB, GL_FLOAT, nullptr);
-    }
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR); // be sure to set minification filter to mip_linear 
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    // generate mipmaps for the cubemap so OpenGL automatically allocates the required memory.
-    glGenerateMipmap(GL_TEXTURE_CUBE_MAP);
-
-    // pbr: run a quasi monte-carlo simulation on the environment lighting to create a prefilter (cube)map.
-    // ----------------------------------------------------------------------------------------------------
-    prefilterShader.use();
-    prefilterShader.setInt("environmentMap", 0);
-    prefilterShader.setMat4("projection", captureProjection);
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, envCubemap);
+        iblBake.add([&, bake]()
+        {
+            bake->startMs = iblBake.elapsedMs();
+            glGenTextures(1, &bake->hdrTexture);
+            glBindTexture(GL_TEXTURE_2D, bake->hdrTexture);
+            uploadHdrImage(bake->source->hdr); // half floats or RGB9_E5 texels, as decoded by the worker
+
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            return true;
+        });
+
+        // pbr: convert HDR equirectangular environment map to cubemap equivalent
+        // ----------------------------------------------------------------------
+        iblBake.add([&]()
+        {
+            if (rasterBake && !equirectangularToCubemapShader)
+            {
+                equirectangularToCubemapShader.reset(new Shader(captureShader("src/2.2.2.equirectangular_to_cubemap.fs", captureProjection, captureViews)));
+                equirectangularToCubemapShader->setInt("equirectangularMap", 0);
+            }
+            if (computeBake && !equirectangularToCubemapCompute)
+            {
+                equirectangularToCubemapCompute.reset(new Shader(computeMapShader("src/2.2.2.equirectangular_to_cubemap.cs")));
+                equirectangularToCubemapCompute->setInt("equirectangularMap", 0);
+            }
+            return true;
+        });
+        queueMapCapture("environment", [&](bool compute) -> Shader & { return compute ? *equirectangularToCubemapCompute : *equirectangularToCubemapShader; },
+                        [bake](Shader &)
+        {
+            glActiveTexture(GL_TEXTURE0);
+            glBindTexture(GL_TEXTURE_2D, bake->hdrTexture);
+            return true;
+        }, env->envCubemap, 0, iblMapSize(ENV_CUBEMAP_SIZE), 1);
+        iblBake.add([env]()
+        {
+            // then let OpenGL generate mipmaps from first mip face (combatting visible dots artifact)
+            glBindTexture(iblMapTarget(), env->envCubemap);
+            glGenerateMipmap(iblMapTarget());
+            env->environmentReady = true;
+            return true;
+        });
+
+        if (!USE_SH_IRRADIANCE)
+        {
+            // pbr: solve diffuse integral by convolution to create an irradiance (cube)map.
+            // -----------------------------------------------------------------------------
+            iblBake.add([&]()
+            {
+                if (rasterBake)
+                {
+                    // pbr: re-scale capture FBO to irradiance scale.
+                    glBindRenderbuffer(GL_RENDERBUFFER, captureRBO);
+                    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, IRRADIANCE_SIZE, IRRADIANCE_SIZE);
+                }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, captureFBO);
-    unsigned int maxMipLevels = 5;
-    for (unsigned int mip = 0; mip < maxMipLevels; ++mip)
-    {
-        // reisze framebuffer according to mip-level size.
-        unsigned int mipWidth = 128 * std::pow(0.5, mip);
-        unsigned int mipHeight = 128 * std::pow(0.5, mip);
-        glBindRenderbuffer(GL_RENDERBUFFER, captureRBO);
-        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, mipWidth, mipHeight);
-        glViewport(0, 0, mipWidth, mipHeight);
+                if (rasterBake && !irradianceShader)
+                {
+                    irradianceShader.reset(new Shader(captureShader("src/2.2.2.irradiance_convolution.fs", captureProjection, captureViews)));
+                    irradianceShader->setInt("environmentMap", 0);
+                    irradianceShader->setInt("environmentOctahedral", 1);
+                    irradianceShader->setBool("octahedralSource", IBL_LAYOUT == IBL_LAYOUT_OCTAHEDRAL);
+                    irradianceShader->setFloat("octahedralLod", std::log2((float)ENV_CUBEMAP_SIZE / IRRADIANCE_SIZE));
+                }
+                if (computeBake && !irradianceCompute)
+                {
+                    // convolves the environment level of the irradiance map's size
+                    irradianceCompute.reset(new Shader(computeMapShader("src/2.2.2.irradiance_convolution.cs")));
+                    irradianceCompute->setInt("environmentMap", 0);
+                    irradianceCompute->setInt("environmentOctahedral", 1);
+                    irradianceCompute->setBool("octahedralSource", IBL_LAYOUT == IBL_LAYOUT_OCTAHEDRAL);
+                    irradianceCompute->setInt("sourceLevel", mipLevelCount(ENV_CUBEMAP_SIZE / IRRADIANCE_SIZE) - 1);
+                }
+                return true;
+            });
+            // 2.2.2.irradiance_convolution.fs walks phi and theta in steps of 0.025; the compute version sums
+            // the texels of one environment level, fewer than that and read from shared memory
+            queueMapCapture("irradiance", [&](bool compute) -> Shader & { return compute ? *irradianceCompute : *irradianceShader; }, bindEnvironment,
+                            env->irradianceMap, 0, iblMapSize(IRRADIANCE_SIZE), (unsigned int)irradianceSamples(0.025f, 0.0f).size());
+            iblBake.add([env]()
+            {
+                env->irradianceReady = true;
+                return true;
+            });
+        }
 
-        float roughness = (float)mip / (float)(maxMipLevels - 1);
-        prefilterShader.setFloat("roughness", roughness);
-        for (unsigned int i = 0; i < 6; ++i)
+        // pbr: run a quasi monte-carlo simulation on the environment lighting to create a prefilter (cube)map.
+        // ----------------------------------------------------------------------------------------------------
+        // the sample count of every mip is picked from the target error, measured on a CPU copy of the
+        // environment by a worker thread; mip 0 (roughness 0) is copied from the environment level of the same size.
+        // The probes sample every level of the environment, which is read back through a pixel pack buffer: one
+        // slice queues the copy, and a later one takes it once its fence has signaled instead of waiting for it.
+        iblBake.add([env, bake]()
+        {
+            bake->environmentReadback.start({ env->envCubemap, iblMapTarget(), GL_RGB16F, GL_RGB, mipLevelCount(iblMapSize(ENV_CUBEMAP_SIZE)) });
+            return true;
+        });
+        iblBake.add([bake]()
         {
-            prefilterShader.setMat4("view", captureViews[i]);
-            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, prefilterMap, mip);
+            if (!bake->environmentReadback.ready())
+                return false;
+            std::shared_ptr<IblCacheImage> image = std::make_shared<IblCacheImage>(bake->environmentReadback.take());
+            bake->prefilterBudgetTask = std::async(std::launch::async, [image]()
+            {
+                auto chooseBudget = [](const auto &cpuEnvironment)
+                {
+                    return choosePrefilterBudget(cpuEnvironment, iblMapSize(PREFILTER_SIZE), PREFILTER_MIP_LEVELS, PREFILTER_TARGET_ERROR,
+                                                 PREFILTER_MIN_SAMPLES, PREFILTER_SAMPLE_COUNT);
+                };
+                if (IBL_LAYOUT == IBL_LAYOUT_OCTAHEDRAL)
+                    return chooseBudget(toCpuMap<CpuOctahedralMap>(*image));
+                return chooseBudget(toCpuMap<CpuCubemap>(*image));
+            });
+            return true;
+        });
+        iblBake.add([&, bake]()
+        {
+            if (bake->prefilterBudgetTask.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+                return false;
+            PrefilterBudget &prefilterBudget = bake->prefilterBudget;
+            prefilterBudget = bake->prefilterBudgetTask.get();
+            for (unsigned int mip = 0; mip < PREFILTER_MIP_LEVELS; ++mip)
+            {
+                if (prefilterBudget.sampleCounts[mip] == 0)
+                    std::cout << "Prefilter mip " << mip << ": copied from the environment" << std::endl;
+                else
+                    std::cout << "Prefilter mip " << mip << ": " << prefilterBudget.sampleCounts[mip] << " samples, relative RMS "
+                              << prefilterBudget.errors[mip] << " against " << 4 * PREFILTER_SAMPLE_COUNT << " samples" << std::endl;
+            }
 
-            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-            renderCube();
+            // the GGX sample directions, weights and source mips only depend on the roughness, so they're
+            // generated once per mip on the CPU and handed to the shader through one uniform buffer, with
+            // one aligned block per mip.
+            GLint uboAlignment = 256;
+            glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uboAlignment);
+            bake->sampleBlockStride = (sampleBlockSize + uboAlignment - 1) / uboAlignment * uboAlignment;
+            std::vector<glm::vec4> sampleTable(bake->sampleBlockStride / sizeof(glm::vec4) * PREFILTER_MIP_LEVELS, glm::vec4(0.0f));
+            for (unsigned int mip = 0; mip < PREFILTER_MIP_LEVELS; ++mip)
+            {
+                if (prefilterBudget.sampleCounts[mip] == 0)
+                    continue;
+                float roughness = (float)mip / (float)(PREFILTER_MIP_LEVELS - 1);
+                std::vector<IblSample> samples = prefilterSamples(roughness, prefilterBudget.sampleCounts[mip], iblEnvironmentResolution());
+                bake->sampleCounts[mip] = (int)std::min<size_t>(samples.size(), PREFILTER_MAX_SAMPLES);
+                glm::vec4 *block = &sampleTable[mip * bake->sampleBlockStride / sizeof(glm::vec4)];
+                for (int i = 0; i < bake->sampleCounts[mip]; ++i)
+                {
+                    block[i] = glm::vec4(samples[i].L, samples[i].lod);
+                    bake->totalWeights[mip] += samples[i].weight;
+                }
+            }
+            glGenBuffers(1, &bake->prefilterSampleUBO);
+            glBindBuffer(GL_UNIFORM_BUFFER, bake->prefilterSampleUBO);
+            glBufferData(GL_UNIFORM_BUFFER, sampleTable.size() * sizeof(glm::vec4), sampleTable.data(), GL_STATIC_DRAW);
+            glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+            if (rasterBake && !prefilterShader)
+            {
+                prefilterShader.reset(new Shader(captureShader("src/2.2.2.prefilter.fs", captureProjection, captureViews)));
+                prefilterShader->setInt("environmentMap", 0);
+                prefilterShader->setInt("environmentOctahedral", 1);
+                prefilterShader->setBool("octahedralSource", IBL_LAYOUT == IBL_LAYOUT_OCTAHEDRAL);
+                glUniformBlockBinding(prefilterShader->ID, glGetUniformBlockIndex(prefilterShader->ID, "PrefilterSamples"), 0);
+            }
+            if (computeBake && !prefilterCompute)
+            {
+                // the sample block is on binding 0 through its layout qualifier
+                prefilterCompute.reset(new Shader(computeMapShader("src/2.2.2.prefilter.cs")));
+                prefilterCompute->setInt("environmentMap", 0);
+                prefilterCompute->setInt("environmentOctahedral", 1);
+                prefilterCompute->setBool("octahedralSource", IBL_LAYOUT == IBL_LAYOUT_OCTAHEDRAL);
+            }
+            return true;
+        });
+
+        for (unsigned int mip = 0; mip < PREFILTER_MIP_LEVELS; ++mip)
+        {
+            unsigned int mipSize = iblMapSize(PREFILTER_SIZE) >> mip;
+            iblBake.add([&, env, bake, mip, mipSize]()
+            {
+                if (bake->prefilterBudget.sampleCounts[mip] == 0)
+                    copyMapLevel(env->envCubemap, mipLevelCount(iblMapSize(ENV_CUBEMAP_SIZE) / mipSize) - 1, env->prefilterMap, mip, mipSize);
+                if (rasterBake)
+                {
+                    // reisze framebuffer according to mip-level size.
+                    glBindRenderbuffer(GL_RENDERBUFFER, captureRBO);
+                    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, mipSize, mipSize);
+                }
+                return true;
+            });
+            // the bands are sized for the largest budget; the ones of a copied mip are skipped
+            queueMapCapture("prefilter", [&](bool compute) -> Shader & { return compute ? *prefilterCompute : *prefilterShader; },
+                            [&, bindEnvironment, bake, mip](Shader &program)
+            {
+                if (bake->prefilterBudget.sampleCounts[mip] == 0)
+                    return false;
+                bindEnvironment(program);
+                glBindBufferRange(GL_UNIFORM_BUFFER, 0, bake->prefilterSampleUBO, mip * bake->sampleBlockStride, sampleBlockSize);
+                program.use();
+                program.setInt("sampleCount", bake->sampleCounts[mip]);
+                program.setFloat("totalWeight", bake->totalWeights[mip]);
+                return true;
+            }, env->prefilterMap, mip, mipSize, PREFILTER_SAMPLE_COUNT);
         }
-    }
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        iblBake.add([env]()
+        {
+            env->prefilterReady = true;
+            return true;
+        });
+
+        // pbr: store the baked maps so the next launch can skip all of the above. They're read back through pixel
+        // pack buffers (one slice queues the copies, a later one takes them once they're done); with
+        // shared-exponent storage they're encoded on a worker thread first and re-uploaded as GL_RGB9_E5.
+        // --------------------------------------------------------------------------------------------------------
+        iblBake.add([env, bake]()
+        {
+            std::vector<IblCacheTexture> renderTargets = env->cacheTextures();
+            bake->storeReadbacks.clear();
+            for (unsigned int t = 0; t < renderTargets.size(); ++t)
+            {
+                renderTargets[t].internalFormat = GL_RGB16F;
+                bake->storeReadbacks.push_back(std::unique_ptr<IblTextureReadback>(new IblTextureReadback()));
+                bake->storeReadbacks.back()->start(renderTargets[t]);
+            }
+            return true;
+        });
+        iblBake.add([bake]()
+        {
+            for (unsigned int t = 0; t < bake->storeReadbacks.size(); ++t)
+                if (!bake->storeReadbacks[t]->ready())
+                    return false;
+            std::vector<IblCacheImage> images;
+            for (unsigned int t = 0; t < bake->storeReadbacks.size(); ++t)
+                images.push_back(bake->storeReadbacks[t]->take());
+            bake->storeReadbacks.clear();
+            bake->storedImages = std::async(std::launch::async, [images]()
+            {
+                if (IBL_STORAGE != IBL_STORAGE_RGB9E5)
+                    return images;
+                std::vector<IblCacheImage> encoded;
+                for (unsigned int t = 0; t < images.size(); ++t)
+                    encoded.push_back(encodeRGB9E5Image(images[t]));
+                return encoded;
+            });
+            return true;
+        });
+        iblBake.add([&, env, bake]()
+        {
+            if (bake->storedImages.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+                return false;
+            std::vector<IblCacheImage> images = bake->storedImages.get();
+            std::vector<IblCacheTexture> textures = env->cacheTextures();
+            if (IBL_STORAGE == IBL_STORAGE_RGB9E5)
+            {
+                for (unsigned int t = 0; t < textures.size(); ++t)
+                    env->upload(textures[t], images[t]);
+            }
+            if (writeIblCache(env->cachePath, bake->source->key, images))
+                std::cout << "Saved baked IBL maps to " << env->cachePath << std::endl;
+            // CPU time of the slices (the GPU work and the worker threads aren't counted; IBL_BAKE_COMPARE_PATHS
+            // prints the GPU time)
+            std::cout << "Baked " << (IBL_LAYOUT == IBL_LAYOUT_OCTAHEDRAL ? "octahedral" : "cubemap") << " maps of " << env->hdrPath
+                      << " in " << iblBake.elapsedMs() - bake->startMs << " ms (" << (computeBake ? "compute" : "raster") << ")" << std::endl;
+            bakeTimings.report("IBL bake");
+            glDeleteTextures(1, &bake->hdrTexture);
+            glDeleteBuffers(1, &bake->prefilterSampleUBO);
+            bake->source.reset(); // frees the HDR pixels
+            return true;
+        });
+    };
+
+    // pbr: register the environments and start on the first one; the others are loaded or baked when
+    // they're selected (keys 1-9), while the current one stays on screen.
+    // ------------------------------------------------------------------------------------------------
+    IblEnvironmentCache environments(iblBake, assets, IBL_ENVIRONMENT_BUDGET_BYTES, bakeEnvironment);
+    for (unsigned int i = 0; i < sizeof(IBL_ENVIRONMENTS) / sizeof(IBL_ENVIRONMENTS[0]); ++i)
+        environments.add(IBL_ENVIRONMENTS[i]);
+    environments.select(0);
 
     // pbr: generate a 2D LUT from the BRDF equations used.
     // ----------------------------------------------------
-    unsigned int brdfLUTTexture;
-    glGenTextures(1, &brdfLUTTexture);
-
-    // pre-allocate enough memory for the LUT texture.
-    glBindTexture(GL_TEXTURE_2D, brdfLUTTexture);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RG16F, 512, 512, 0, GL_RG, GL_FLOAT, 0);
-    // be sure to set wrapping mode to GL_CLAMP_TO_EDGE
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-    // then re-configure capture framebuffer object and render screen-space quad with BRDF shader.
-    glBindFramebuffer(GL_FRAMEBUFFER, captureFBO);
-    glBindRenderbuffer(GL_RENDERBUFFER, captureRBO);
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, 512, 512);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, brdfLUTTexture, 0);
-
-    glViewport(0, 0, 512, 512);
-    brdfShader.use();
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-    renderQuad();
-
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if (!brdfCached)
+    {
+        unsigned int bandRows = std::max(1u, (unsigned int)(IBL_BAKE_SLICE_SAMPLES / ((unsigned long long)BRDF_LUT_SIZE * BRDF_SAMPLE_COUNT)));
+        for (unsigned int row = 0; row < BRDF_LUT_SIZE; row += bandRows)
+        {
+            iblBake.add([&, row, bandRows]()
+            {
+                unsigned int rowEnd = std::min(row + bandRows, BRDF_LUT_SIZE);
+                if (rasterBake)
+                {
+                    // re-configure capture framebuffer object and render screen-space quad with BRDF shader.
+                    if (row == 0)
+                    {
+                        brdfShader.reset(new Shader("src/2.2.2.brdf.vs", "src/2.2.2.brdf.fs"));
+                        glBindRenderbuffer(GL_RENDERBUFFER, captureRBO);
+                        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, BRDF_LUT_SIZE, BRDF_LUT_SIZE);
+                    }
+                    bakeTimings.begin();
+                    glBindFramebuffer(GL_FRAMEBUFFER, captureFBO);
+                    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, brdfLUTTexture, 0);
+
+                    glViewport(0, 0, BRDF_LUT_SIZE, BRDF_LUT_SIZE);
+                    glEnable(GL_SCISSOR_TEST);
+                    glScissor(0, row, BRDF_LUT_SIZE, rowEnd - row);
+                    brdfShader->use();
+                    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+                    renderQuad();
+                    glDisable(GL_SCISSOR_TEST);
+
+                    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+                    bakeTimings.end("brdf", false);
+                }
+                if (computeBake)
+                {
+                    if (row == 0)
+                        brdfCompute.reset(new Shader("src/2.2.2.brdf.cs"));
+                    bakeTimings.begin();
+                    dispatchBrdfRows(*brdfCompute, brdfLUTTexture, BRDF_LUT_SIZE, row, rowEnd);
+                    bakeTimings.end("brdf", true);
+                }
+                if (rowEnd >= BRDF_LUT_SIZE)
+                {
+                    analyticBRDF = false;
+                    saveIblCache(BRDF_LUT_CACHE_PATH, brdfKey, brdfTextures);
+                    bakeTimings.report("BRDF LUT");
+                }
+                return true;
+            });
+        }
+    }
+    if (!USE_PROGRESSIVE_BAKE)
+        iblBake.finish();
 
 
     // initialize static shader uniforms before rendering
@@ -359,8 +739,11 @@ int main()
     glm::mat4 projection = glm::perspective(glm::radians(camera.Zoom), (float)SCR_WIDTH / (float)SCR_HEIGHT, 0.1f, 100.0f);
     pbrShader.use();
     pbrShader.setMat4("projection", projection);
+    pbrShader.setBool("useSHIrradiance", USE_SH_IRRADIANCE);
+    pbrShader.setBool("useOctahedralMaps", IBL_LAYOUT == IBL_LAYOUT_OCTAHEDRAL);
     backgroundShader.use();
     backgroundShader.setMat4("projection", projection);
+    backgroundShader.setBool("useOctahedralMaps", IBL_LAYOUT == IBL_LAYOUT_OCTAHEDRAL);
 
     // then before rendering, configure the viewport to the original framebuffer's screen dimensions
     int scrWidth, scrHeight;
@@ -381,6 +764,34 @@ int main()
         // -----
         processInput(window);
 
+        // stream in another frame's budget of texture pixels, while there are any
+        // ------------------------------------------------------------------------
+        assets.poll();
+
+        // environment switching: the selected set is shown once it's complete, until then the previous one
+        // (or at startup the placeholder and whatever has been baked so far)
+        // ------------------------------------------------------------------------------------------------------
+        if (requestedEnvironment >= 0)
+        {
+            if (requestedEnvironment < (int)environments.size())
+                environments.select(requestedEnvironment);
+            requestedEnvironment = -1;
+        }
+        environments.update();
+        const IblEnvironment *shown = environments.shown();
+        unsigned int displayedEnvironment = shown && shown->environmentReady ? shown->envCubemap : placeholderMap;
+        unsigned int displayedIrradiance = shown && shown->irradianceReady ? shown->irradianceMap : placeholderMap;
+        unsigned int displayedPrefilter = shown && shown->prefilterReady ? shown->prefilterMap : placeholderMap;
+        const ShCoefficients &displayedSH = shown && shown->shReady ? shown->sh : defaultSH;
+        if (USE_SH_IRRADIANCE && &displayedSH != appliedSH)
+        {
+            pbrShader.use();
+            for (unsigned int i = 0; i < 9; ++i)
+                pbrShader.setVec3("shCoefficients[" + std::to_string(i) + "]", displayedSH.c[i]);
+            fillPlaceholderMap(placeholderMap, displayedSH);
+            appliedSH = &displayedSH;
+        }
+
         // render
         // ------
         glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
@@ -393,16 +804,29 @@ int main()
         glm::mat4 view = camera.GetViewMatrix();
         pbrShader.setMat4("view", view);
         pbrShader.setVec3("camPos", camera.Position);
+        // the backpacks are drawn at the LOD their size on screen calls for, without what's off screen or facing away;
+        // the size is the framebuffer's, which follows the window as it's resized
+        glfwGetFramebufferSize(window, &scrWidth, &scrHeight);
+        LodView lodView(camera.Position, glm::radians(camera.Zoom), (float)scrHeight);
+        glm::mat4 viewProjection = projection * view;
+        pbrShader.setBool("useAnalyticBRDF", analyticBRDF); // until a progressive bake has rendered the LUT
 
 
 
-        // bind pre-computed IBL data
-        glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_CUBE_MAP, irradianceMap);
-        glActiveTexture(GL_TEXTURE1);
-        glBindTexture(GL_TEXTURE_CUBE_MAP, prefilterMap);
-        glActiveTexture(GL_TEXTURE2);
-        glBindTexture(GL_TEXTURE_2D, brdfLUTTexture);
+        // bind pre-computed IBL data (the octahedral maps have samplers on units of their own)
+        bool octahedral = IBL_LAYOUT == IBL_LAYOUT_OCTAHEDRAL;
+        if (!USE_SH_IRRADIANCE)
+        {
+            glActiveTexture(octahedral ? GL_TEXTURE8 : GL_TEXTURE0);
+            glBindTexture(iblMapTarget(), displayedIrradiance);
+        }
+        glActiveTexture(octahedral ? GL_TEXTURE9 : GL_TEXTURE1);
+        glBindTexture(iblMapTarget(), displayedPrefilter);
+        if (!analyticBRDF)
+        {
+            glActiveTexture(GL_TEXTURE2);
+            glBindTexture(GL_TEXTURE_2D, brdfLUTTexture);
+        }
 
         
         glActiveTexture(GL_TEXTURE3);
@@ -422,7 +846,7 @@ int main()
         model = glm::rotate(model, objRotate.pitch(), glm::vec3(1.0f, 0.0f, 0.0f)); //pitch
         model = glm::rotate(model, objRotate.yaw(), glm::vec3(0.0f, 1.0f, 0.0f)); //yaw
         pbrShader.setMat4("model", model);
-        ourModel.Draw(pbrShader);
+        ourModel->Draw(pbrShader, model, lodView, viewProjection);
 
         // gold
         glActiveTexture(GL_TEXTURE3);
@@ -473,7 +897,7 @@ int main()
             model = glm::translate(model, newPos);
             model = glm::scale(model, glm::vec3(0.5f));
             pbrShader.setMat4("model", model);
-            ourModel.Draw(pbrShader);
+            ourModel->Draw(pbrShader, model, lodView, viewProjection);
             renderSphere();
         }
 
@@ -481,8 +905,8 @@ int main()
         backgroundShader.use();
 
         backgroundShader.setMat4("view", view);
-        glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_CUBE_MAP, envCubemap);
+        glActiveTexture(octahedral ? GL_TEXTURE1 : GL_TEXTURE0);
+        glBindTexture(iblMapTarget(), displayedEnvironment);
         //glBindTexture(GL_TEXTURE_CUBE_MAP, irradianceMap); // display irradiance map
         //glBindTexture(GL_TEXTURE_CUBE_MAP, prefilterMap); // display prefilter map
         renderCube();
@@ -496,8 +920,25 @@ int main()
         // -------------------------------------------------------------------------------
         glfwSwapBuffers(window);
         glfwPollEvents();
+
+        // progressive IBL bake: the next slices once the frame is out (so the first one shows up right away),
+        // then back to the default framebuffer; the pass timings of earlier slices are picked up as they finish
+        // -----------------------------------------------------------------------------------------------------
+        bakeTimings.poll();
+        if (!iblBake.done())
+        {
+            iblBake.run(IBL_BAKE_FRAME_SLICES, IBL_BAKE_FRAME_BUDGET_MS);
+            glBindFramebuffer(GL_FRAMEBUFFER, 0);
+            glfwGetFramebufferSize(window, &scrWidth, &scrHeight);
+            glViewport(0, 0, scrWidth, scrHeight);
+        }
     }
 
+    // the model, its geometry and the textures go while the context is still current
+    ourModel.reset();
+    sceneGeometry.reset();
+    assets.releaseTextures();
+
     // glfw: terminate, clearing all previously allocated GLFW resources.
     // ------------------------------------------------------------------
     glfwTerminate();
@@ -521,6 +962,14 @@ void processInput(GLFWwindow *window)
         camera.ProcessKeyboard(RIGHT, deltaTime);
 }
 
+// glfw: number keys 1-9 select an environment
+// --------------------------------------------
+void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods)
+{
+    if (action == GLFW_PRESS && key >= GLFW_KEY_1 && key <= GLFW_KEY_9)
+        requestedEnvironment = key - GLFW_KEY_1;
+}
+
 // glfw: whenever the window size changed (by OS or user resize) this callback function executes
 // ---------------------------------------------------------------------------------------------
 void framebuffer_size_callback(GLFWwindow* window, int width, int height)
@@ -561,7 +1010,7 @@ void scroll_callback(GLFWwindow* window, double xoffset, double yoffset)
 // renders (and builds at first invocation) a sphere
 // -------------------------------------------------
 unsigned int sphereVAO = 0;
-unsigned int indexCount;
+PackedIndices sphereIndices;
 void renderSphere()
 {
     if (sphereVAO == 0)
@@ -596,28 +1045,19 @@ void renderSphere()
             }
         }
 
-        bool oddRow = false;
+        // one strip per row, all the same way round, cut apart by primitive restart
         for (unsigned int y = 0; y < Y_SEGMENTS; ++y)
         {
-            if (!oddRow) // even rows: y == 0, y == 2; and so on
-            {
-                for (unsigned int x = 0; x <= X_SEGMENTS; ++x)
-                {
-                    indices.push_back(y * (X_SEGMENTS + 1) + x);
-                    indices.push_back((y + 1) * (X_SEGMENTS + 1) + x);
-                }
-            }
-            else
+            if (y > 0)
+                indices.push_back(PRIMITIVE_RESTART);
+            for (unsigned int x = 0; x <= X_SEGMENTS; ++x)
             {
-                for (int x = X_SEGMENTS; x >= 0; --x)
-                {
-                    indices.push_back((y + 1) * (X_SEGMENTS + 1) + x);
-                    indices.push_back(y * (X_SEGMENTS + 1) + x);
-                }
+                indices.push_back(y * (X_SEGMENTS + 1) + x);
+                indices.push_back((y + 1) * (X_SEGMENTS + 1) + x);
             }
-            oddRow = !oddRow;
         }
-        indexCount = indices.size();
+        // 65 x 65 vertices: 16-bit indices
+        sphereIndices = packIndices(indices, (unsigned int)positions.size(), GL_TRIANGLE_STRIP);
 
         std::vector<float> data;
         for (unsigned int i = 0; i < positions.size(); ++i)
@@ -641,7 +1081,7 @@ void renderSphere()
         glBindBuffer(GL_ARRAY_BUFFER, vbo);
         glBufferData(GL_ARRAY_BUFFER, data.size() * sizeof(float), &data[0], GL_STATIC_DRAW);
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), &indices[0], GL_STATIC_DRAW);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sphereIndices.size(), sphereIndices.data(), GL_STATIC_DRAW);
         unsigned int stride = (3 + 2 + 3) * sizeof(float);
         glEnableVertexAttribArray(0);
         glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, (void*)0);
@@ -652,7 +1092,9 @@ void renderSphere()
     }
 
     glBindVertexArray(sphereVAO);
-    glDrawElements(GL_TRIANGLE_STRIP, indexCount, GL_UNSIGNED_INT, 0);
+    enablePrimitiveRestart(sphereIndices.type);
+    drawPackedIndices(GL_TRIANGLE_STRIP, sphereIndices);
+    glDisable(GL_PRIMITIVE_RESTART);
 }
 
 // renderCube() renders a 1x1 3D cube in NDC.
@@ -761,41 +1203,222 @@ void renderQuad()
     glBindVertexArray(0);
 }
 
-// utility function for loading a 2D texture from file
-// ---------------------------------------------------
-unsigned int loadTexture(char const * path)
+// renderOctahedron() renders the unfolded octahedron over the whole viewport: 8 triangles with the [0, 1]
+// octahedral map coordinates of their corners and the (unnormalized) direction they stand for.
+// -----------------------------------------------------------------------------------------------------------
+unsigned int octahedronVAO = 0;
+unsigned int octahedronVBO;
+void renderOctahedron()
 {
-    unsigned int textureID;
-    glGenTextures(1, &textureID);
-
-    int width, height, nrComponents;
-    unsigned char *data = stbi_load(path, &width, &height, &nrComponents, 0);
-    if (data)
+    if (octahedronVAO == 0)
     {
-        GLenum format;
-        if (nrComponents == 1)
-            format = GL_RED;
-        else if (nrComponents == 3)
-            format = GL_RGB;
-        else if (nrComponents == 4)
-            format = GL_RGBA;
-
-        glBindTexture(GL_TEXTURE_2D, textureID);
-        glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
-        glGenerateMipmap(GL_TEXTURE_2D);
+        // +Z in the centre, the four side corners on the edge midpoints, -Z in the four map corners
+        const float top[5] = { 0.5f, 0.5f, 0.0f, 0.0f, 1.0f };
+        const float bottom[4][5] = {
+            { 1.0f, 1.0f, 0.0f, 0.0f, -1.0f },
+            { 0.0f, 1.0f, 0.0f, 0.0f, -1.0f },
+            { 0.0f, 0.0f, 0.0f, 0.0f, -1.0f },
+            { 1.0f, 0.0f, 0.0f, 0.0f, -1.0f },
+        };
+        const float sides[4][5] = {
+            { 1.0f, 0.5f,  1.0f,  0.0f, 0.0f },
+            { 0.5f, 1.0f,  0.0f,  1.0f, 0.0f },
+            { 0.0f, 0.5f, -1.0f,  0.0f, 0.0f },
+            { 0.5f, 0.0f,  0.0f, -1.0f, 0.0f },
+        };
+        std::vector<float> vertices;
+        auto addVertex = [&](const float *v) { vertices.insert(vertices.end(), v, v + 5); };
+        for (unsigned int i = 0; i < 4; ++i)
+        {
+            const float *next = sides[(i + 1) % 4];
+            // the upper face between two side corners, then the lower one folded out into the map corner
+            addVertex(top); addVertex(sides[i]); addVertex(next);
+            addVertex(sides[i]); addVertex(bottom[i]); addVertex(next);
+        }
+        glGenVertexArrays(1, &octahedronVAO);
+        glGenBuffers(1, &octahedronVBO);
+        glBindVertexArray(octahedronVAO);
+        glBindBuffer(GL_ARRAY_BUFFER, octahedronVBO);
+        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(2 * sizeof(float)));
+    }
+    glBindVertexArray(octahedronVAO);
+    glDrawArrays(GL_TRIANGLES, 0, 24);
+    glBindVertexArray(0);
+}
 
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+// captureShader() builds a capture shader for the given fragment stage: for an octahedral map with
+// 2.2.2.octahedral.vs, for a cubemap with the layered vertex and geometry stages when USE_LAYERED_CAPTURE is
+// set (the per-face view matrices are uploaded once here).
+// -----------------------------------------------------------------------------------------------------------
+Shader captureShader(const char *fragmentPath, const glm::mat4 &projection, const glm::mat4 *views)
+{
+    if (IBL_LAYOUT == IBL_LAYOUT_OCTAHEDRAL)
+        return Shader("src/2.2.2.octahedral.vs", fragmentPath);
+    if (!USE_LAYERED_CAPTURE)
+    {
+        Shader shader("src/2.2.2.cubemap.vs", fragmentPath);
+        shader.use();
+        shader.setMat4("projection", projection);
+        return shader;
+    }
+    Shader shader("src/2.2.2.cubemap_layered.vs", fragmentPath, "src/2.2.2.cubemap_layered.gs");
+    shader.use();
+    shader.setMat4("projection", projection);
+    for (unsigned int i = 0; i < 6; ++i)
+        shader.setMat4("views[" + std::to_string(i) + "]", views[i]);
+    return shader;
+}
 
-        stbi_image_free(data);
+// captureCubemap() renders the cube into all six faces of one mip of the cubemap: as a single draw into the
+// layered attachment, or face by face with the view matrix switched in between.
+// -----------------------------------------------------------------------------------------------------------
+void captureCubemap(Shader &shader, unsigned int captureFBO, unsigned int cubemap, unsigned int mip, unsigned int size,
+                    unsigned int rowBegin, unsigned int rowEnd, const glm::mat4 *views)
+{
+    shader.use();
+    glBindFramebuffer(GL_FRAMEBUFFER, captureFBO);
+    glViewport(0, 0, size, size); // don't forget to configure the viewport to the capture dimensions.
+    // only rows [rowBegin, rowEnd) of every face are touched, so a capture can be split into several slices
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(0, rowBegin, size, rowEnd - rowBegin);
+    if (USE_LAYERED_CAPTURE)
+    {
+        glFramebufferTexture(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, cubemap, mip);
+        glClear(GL_COLOR_BUFFER_BIT);
+        renderCube();
     }
     else
     {
-        std::cout << "Texture failed to load at path: " << path << std::endl;
-        stbi_image_free(data);
+        for (unsigned int i = 0; i < 6; ++i)
+        {
+            shader.setMat4("view", views[i]);
+            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, cubemap, mip);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            renderCube();
+        }
     }
+    glDisable(GL_SCISSOR_TEST);
+}
 
-    return textureID;
-}
\ No newline at end of file
+// captureOctahedral() renders the unfolded octahedron into one mip of an octahedral map in a single draw.
+// -------------------------------------------------------------------------------------------------------
+void captureOctahedral(Shader &shader, unsigned int captureFBO, unsigned int map, unsigned int mip, unsigned int size,
+                       unsigned int rowBegin, unsigned int rowEnd)
+{
+    shader.use();
+    glBindFramebuffer(GL_FRAMEBUFFER, captureFBO);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, map, mip);
+    glViewport(0, 0, size, size);
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(0, rowBegin, size, rowEnd - rowBegin);
+    glClear(GL_COLOR_BUFFER_BIT);
+    renderOctahedron();
+    glDisable(GL_SCISSOR_TEST);
+}
+
+// copyMapLevel() copies one size x size level of a baked map (cubemap or octahedral, per IBL_LAYOUT) into a
+// level of another: in one call with GL 4.3, otherwise blitted face by face.
+// ---------------------------------------------------------------------------------------------------------
+void copyMapLevel(unsigned int src, unsigned int srcLevel, unsigned int dst, unsigned int dstLevel, unsigned int size)
+{
+    if (GLEW_VERSION_4_3)
+    {
+        glCopyImageSubData(src, iblMapTarget(), srcLevel, 0, 0, 0, dst, iblMapTarget(), dstLevel, 0, 0, 0, size, size, iblCacheFaces(iblMapTarget()));
+        return;
+    }
+    unsigned int copyFBOs[2];
+    glGenFramebuffers(2, copyFBOs);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, copyFBOs[0]);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, copyFBOs[1]);
+    for (int i = 0; i < iblCacheFaces(iblMapTarget()); ++i)
+    {
+        glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, iblCacheFaceTarget(iblMapTarget(), i), src, srcLevel);
+        glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, iblCacheFaceTarget(iblMapTarget(), i), dst, dstLevel);
+        glBlitFramebuffer(0, 0, size, size, 0, 0, size, size, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glDeleteFramebuffers(2, copyFBOs);
+}
+
+// toCpuMap() converts a RGB16F baked map read back from the GPU into a float CpuCubemap or CpuOctahedralMap
+// (matching IBL_LAYOUT) for the CPU bake helpers; it doesn't touch GL, so it can run on a worker.
+// ------------------------------------------------------------------------------------------------------
+template <typename Map>
+Map toCpuMap(const IblCacheImage &image)
+{
+    int levels = (int)image.levels.size();
+    Map map;
+    map.size = image.levels[0].width;
+    map.levels.resize(levels);
+    for (int level = 0; level < levels; ++level)
+    {
+        const std::vector<unsigned short> &pixels = image.levels[level].pixels;
+        map.levels[level].resize(pixels.size());
+        for (size_t i = 0; i < pixels.size(); ++i)
+            map.levels[level][i] = glm::unpackHalf1x16(pixels[i]);
+    }
+    return map;
+}
+
+// placeholderSH() is a flat grey environment, lighting the scene until the real coefficients are known.
+// ----------------------------------------------------------------------------------------------------
+ShCoefficients placeholderSH()
+{
+    ShCoefficients sh;
+    for (unsigned int i = 0; i < 9; ++i)
+        sh.c[i] = glm::vec3(0.0f);
+    sh.c[0] = glm::vec3(0.5f / 0.282095f);
+    return sh;
+}
+
+// createPlaceholderMap() creates the map that stands in for the baked maps while they're baked: a 1x1
+// cubemap, or an 8x8 octahedral map. fillPlaceholderMap() sets each cubemap face to the SH evaluated at its
+// centre, or each octahedral texel to the SH in its direction.
+// -----------------------------------------------------------------------------------------------------------
+const int PLACEHOLDER_OCTAHEDRAL_SIZE = 8;
+unsigned int createPlaceholderMap(const ShCoefficients &sh)
+{
+    GLenum target = iblMapTarget();
+    unsigned int map;
+    glGenTextures(1, &map);
+    glBindTexture(target, map);
+    glTexParameteri(target, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(target, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(target, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+    // the octahedral lookups size their border from a full mip chain
+    glTexParameteri(target, GL_TEXTURE_MIN_FILTER, IBL_LAYOUT == IBL_LAYOUT_OCTAHEDRAL ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    glTexParameteri(target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    fillPlaceholderMap(map, sh);
+    return map;
+}
+
+void fillPlaceholderMap(unsigned int map, const ShCoefficients &sh)
+{
+    if (IBL_LAYOUT == IBL_LAYOUT_OCTAHEDRAL)
+    {
+        std::vector<glm::vec3> texels;
+        for (int y = 0; y < PLACEHOLDER_OCTAHEDRAL_SIZE; ++y)
+            for (int x = 0; x < PLACEHOLDER_OCTAHEDRAL_SIZE; ++x)
+                texels.push_back(evaluateSH(sh, octahedralTexelDirection(x, y, PLACEHOLDER_OCTAHEDRAL_SIZE)));
+        glBindTexture(GL_TEXTURE_2D, map);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB16F, PLACEHOLDER_OCTAHEDRAL_SIZE, PLACEHOLDER_OCTAHEDRAL_SIZE, 0, GL_RGB, GL_FLOAT, &texels[0][0]);
+        glGenerateMipmap(GL_TEXTURE_2D);
+        return;
+    }
+
+    const glm::vec3 faceDirections[6] = {
+        glm::vec3( 1.0f,  0.0f,  0.0f), glm::vec3(-1.0f,  0.0f,  0.0f),
+        glm::vec3( 0.0f,  1.0f,  0.0f), glm::vec3( 0.0f, -1.0f,  0.0f),
+        glm::vec3( 0.0f,  0.0f,  1.0f), glm::vec3( 0.0f,  0.0f, -1.0f)
+    };
+    glBindTexture(GL_TEXTURE_CUBE_MAP, map);
+    for (unsigned int i = 0; i < 6; ++i)
+    {
+        glm::vec3 color = evaluateSH(sh, faceDirections[i]);
+        glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB16F, 1, 1, 0, GL_RGB, GL_FLOAT, &color[0]);
+    }
+}